@@ -25,6 +25,8 @@
 #include "stdint.h"
 #include "base/base.hpp"
 
+class RVVRegField;
+
 //////////////////////////////////////////////////////////////////////////////////////
 /// \brief This space concludes integer arithmetic helpers
 namespace VARITH_INT {
@@ -35,51 +37,42 @@ namespace VARITH_INT {
 	/// \brief Add vector-vector
 	/// \details For all i: D[i] = L[i] + R[i]
 	VILL::vpu_return_t add_vv(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_rhs, //!< Source vector R [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint16_t vec_elem_start, //!< Starting element [index]
-		bool mask_f //!< Vector mask flag. 1: masking 0: no masking
+		bool mask_f, //!< Vector mask flag. 1: masking 0: no masking
+		bool tail_agnostic, //!< Tail agnostic flag (vta). 1: tail elements may be overwritten, see SVPolicy
+		bool mask_agnostic //!< Mask agnostic flag (vma). 1: masked-off elements may be overwritten, see SVPolicy
 	);
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Add vector-immediate
 	/// \details For all i: D[i] = L[i] + sign_extend(_vimm)
 	VILL::vpu_return_t add_vi(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint8_t s_imm, //!< Sign or zero extending 5-bit immediate
 		uint16_t vec_elem_start, //!< Starting element [index]
-		bool mask_f //!< Vector mask flag. 1: masking 0: no masking
+		bool mask_f, //!< Vector mask flag. 1: masking 0: no masking
+		bool tail_agnostic, //!< Tail agnostic flag (vta). 1: tail elements may be overwritten, see SVPolicy
+		bool mask_agnostic //!< Mask agnostic flag (vma). 1: masked-off elements may be overwritten, see SVPolicy
 	);
 
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Add vector-scalar
 	/// \details For all i: D[i] = L[i] + sign_extend(*X)
 	VILL::vpu_return_t add_vx(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint8_t* scalar_reg_mem, //!< Memory space holding scalar data (min. _xlenb bytes)
 		uint16_t vec_elem_start, //!< Starting element [index]
 		bool mask_f, //!< Vector mask flag. 1: masking 0: no masking
-		uint8_t scalar_reg_len_bytes //!< Length of scalar [bytes]
+		uint8_t scalar_reg_len_bytes, //!< Length of scalar [bytes]
+		bool tail_agnostic, //!< Tail agnostic flag (vta). 1: tail elements may be overwritten, see SVPolicy
+		bool mask_agnostic //!< Mask agnostic flag (vma). 1: masked-off elements may be overwritten, see SVPolicy
 	);
 
 /* SUB */
@@ -87,47 +80,36 @@ namespace VARITH_INT {
 	/// \brief Sub vector-vector
 	/// \details For all i: D[i] = L[i] - R[i]
 	VILL::vpu_return_t sub_vv(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_rhs, //!< Source vector R [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint16_t vec_elem_start, //!< Starting element [index]
-		bool mask_f //!< Vector mask flag. 1: masking 0: no masking
+		bool mask_f, //!< Vector mask flag. 1: masking 0: no masking
+		bool tail_agnostic, //!< Tail agnostic flag (vta). 1: tail elements may be overwritten, see SVPolicy
+		bool mask_agnostic //!< Mask agnostic flag (vma). 1: masked-off elements may be overwritten, see SVPolicy
 	);
 
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Sub vector-scalar
 	/// \details For all i: D[i] = L[i] - sign_extend(*X). No sub_vi (use add_vi with negative immediate
 	VILL::vpu_return_t sub_vx(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint8_t* scalar_reg_mem, //!< Memory space holding scalar data (min. _xlenb bytes)
 		uint16_t vec_elem_start, //!< Starting element [index]
 		bool mask_f, //!< Vector mask flag. 1: masking 0: no masking
-		uint8_t scalar_reg_len_bytes //!< Length of scalar [bytes]
+		uint8_t scalar_reg_len_bytes, //!< Length of scalar [bytes]
+		bool tail_agnostic, //!< Tail agnostic flag (vta). 1: tail elements may be overwritten, see SVPolicy
+		bool mask_agnostic //!< Mask agnostic flag (vma). 1: masked-off elements may be overwritten, see SVPolicy
 	);
 /* Reverse-SUB */
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Sub vector-scalar
 	/// \details For all i: D[i] = sign_extend(*X) - R[i].
 	VILL::vpu_return_t rsub_vx(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_rhs, //!< Source vector R [index]
 		uint8_t* scalar_reg_mem, //!< Memory space holding scalar data (min. _xlenb bytes)
@@ -139,12 +121,7 @@ namespace VARITH_INT {
 	/// \brief Sub vector-scalar
 	/// \details For all i: D[i] = sign_extend(imm) - R[i].
 	VILL::vpu_return_t rsub_vi(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_rhs, //!< Source vector R [index]
 		uint8_t s_imm, //!< Sign or zero extending 5-bit immediate
@@ -241,50 +218,41 @@ namespace VARITH_INT {
 	/// \brief AND vector-vector
 	/// \details For all i: D[i] = L[i] & R[i]
 	VILL::vpu_return_t and_vv(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_rhs, //!< Source vector R [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint16_t vec_elem_start, //!< Starting element [index]
-		bool mask_f //!< Vector mask flag. 1: masking 0: no masking
+		bool mask_f, //!< Vector mask flag. 1: masking 0: no masking
+		bool tail_agnostic, //!< Tail agnostic flag (vta). 1: tail elements may be overwritten, see SVPolicy
+		bool mask_agnostic //!< Mask agnostic flag (vma). 1: masked-off elements may be overwritten, see SVPolicy
 	);
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief AND vector-immediate
 	/// \details For all i: D[i] = L[i] & sign_extend(_vimm)
 	VILL::vpu_return_t and_vi(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint8_t s_imm, //!< Sign or zero extending 5-bit immediate
 		uint16_t vec_elem_start, //!< Starting element [index]
-		bool mask_f //!< Vector mask flag. 1: masking 0: no masking
+		bool mask_f, //!< Vector mask flag. 1: masking 0: no masking
+		bool tail_agnostic, //!< Tail agnostic flag (vta). 1: tail elements may be overwritten, see SVPolicy
+		bool mask_agnostic //!< Mask agnostic flag (vma). 1: masked-off elements may be overwritten, see SVPolicy
 	);
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief AND vector-scalar
 	/// \details For all i: D[i] = L[i] & sign_extend(*X)
 	VILL::vpu_return_t and_vx(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint8_t* scalar_reg_mem, //!< Memory space holding scalar data (min. _xlenb bytes).
 		uint16_t vec_elem_start, //!< Starting element [index]
 		bool mask_f, //!< Vector mask flag. 1: masking 0: no masking
-		uint8_t scalar_reg_len_bytes //!< Length of scalar [bytes]
+		uint8_t scalar_reg_len_bytes, //!< Length of scalar [bytes]
+		bool tail_agnostic, //!< Tail agnostic flag (vta). 1: tail elements may be overwritten, see SVPolicy
+		bool mask_agnostic //!< Mask agnostic flag (vma). 1: masked-off elements may be overwritten, see SVPolicy
 	);
 
 /* OR */
@@ -292,50 +260,41 @@ namespace VARITH_INT {
 	/// \brief OR vector-vector
 	/// \details For all i: D[i] = L[i] | R[i]
 	VILL::vpu_return_t or_vv(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_rhs, //!< Source vector R [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint16_t vec_elem_start, //!< Starting element [index]
-		bool mask_f //!< Vector mask flag. 1: masking 0: no masking
+		bool mask_f, //!< Vector mask flag. 1: masking 0: no masking
+		bool tail_agnostic, //!< Tail agnostic flag (vta). 1: tail elements may be overwritten, see SVPolicy
+		bool mask_agnostic //!< Mask agnostic flag (vma). 1: masked-off elements may be overwritten, see SVPolicy
 	);
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief OR vector-immediate
 	/// \details For all i: D[i] = L[i] | sign_extend(_vimm)
 	VILL::vpu_return_t or_vi(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint8_t s_imm, //!< Sign or zero extending 5-bit immediate
 		uint16_t vec_elem_start, //!< Starting element [index]
-		bool mask_f //!< Vector mask flag. 1: masking 0: no masking
+		bool mask_f, //!< Vector mask flag. 1: masking 0: no masking
+		bool tail_agnostic, //!< Tail agnostic flag (vta). 1: tail elements may be overwritten, see SVPolicy
+		bool mask_agnostic //!< Mask agnostic flag (vma). 1: masked-off elements may be overwritten, see SVPolicy
 	);
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief OR vector-scalar
 	/// \details For all i: D[i] = L[i] | sign_extend(*X)
 	VILL::vpu_return_t or_vx(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint8_t* scalar_reg_mem, //!< Memory space holding scalar data (min. _xlenb bytes)
 		uint16_t vec_elem_start, //!< Starting element [index]
 		bool mask_f, //!< Vector mask flag. 1: masking 0: no masking
-		uint8_t scalar_reg_len_bytes //!< Length of scalar [bytes]
+		uint8_t scalar_reg_len_bytes, //!< Length of scalar [bytes]
+		bool tail_agnostic, //!< Tail agnostic flag (vta). 1: tail elements may be overwritten, see SVPolicy
+		bool mask_agnostic //!< Mask agnostic flag (vma). 1: masked-off elements may be overwritten, see SVPolicy
 	);
 
 /* XOR */
@@ -343,50 +302,41 @@ namespace VARITH_INT {
 	/// \brief XOR vector-vector
 	/// \details For all i: D[i] = L[i] ^ R[i]
 	VILL::vpu_return_t xor_vv(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_rhs, //!< Source vector R [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint16_t vec_elem_start, //!< Starting element [index]
-		bool mask_f //!< Vector mask flag. 1: masking 0: no masking
+		bool mask_f, //!< Vector mask flag. 1: masking 0: no masking
+		bool tail_agnostic, //!< Tail agnostic flag (vta). 1: tail elements may be overwritten, see SVPolicy
+		bool mask_agnostic //!< Mask agnostic flag (vma). 1: masked-off elements may be overwritten, see SVPolicy
 	);
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief XOR vector-immediate
 	/// \details For all i: D[i] = L[i] ^ sign_extend(_vimm)
 	VILL::vpu_return_t xor_vi(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint8_t s_imm, //!< Sign or zero extending 5-bit immediate
 		uint16_t vec_elem_start, //!< Starting element [index]
-		bool mask_f //!< Vector mask flag. 1: masking 0: no masking
+		bool mask_f, //!< Vector mask flag. 1: masking 0: no masking
+		bool tail_agnostic, //!< Tail agnostic flag (vta). 1: tail elements may be overwritten, see SVPolicy
+		bool mask_agnostic //!< Mask agnostic flag (vma). 1: masked-off elements may be overwritten, see SVPolicy
 	);
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief XOR vector-scalar
 	/// \details For all i: D[i] = L[i] ^ X.
 	VILL::vpu_return_t xor_vx(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint8_t* scalar_reg_mem, //!< Memory space holding scalar data (min. _xlenb bytes)
 		uint16_t vec_elem_start, //!< Starting element [index]
 		bool mask_f, //!< Vector mask flag. 1: masking 0: no masking
-		uint8_t scalar_reg_len_bytes //!< Length of scalar [bytes]
+		uint8_t scalar_reg_len_bytes, //!< Length of scalar [bytes]
+		bool tail_agnostic, //!< Tail agnostic flag (vta). 1: tail elements may be overwritten, see SVPolicy
+		bool mask_agnostic //!< Mask agnostic flag (vma). 1: masked-off elements may be overwritten, see SVPolicy
 	);
 
 /* rvv spec. 12.6 - Vector Single-Width Bit Shift Instructions */
@@ -395,50 +345,41 @@ namespace VARITH_INT {
 	/// \brief SLL vector-vector
 	/// \details For all i: D[i] = R[i] << (L[i] & possible SEW bits)
 	VILL::vpu_return_t sll_vv(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_rhs, //!< Source vector R [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint16_t vec_elem_start, //!< Starting element [index]
-		bool mask_f //!< Vector mask flag. 1: masking 0: no masking
+		bool mask_f, //!< Vector mask flag. 1: masking 0: no masking
+		bool tail_agnostic, //!< Tail agnostic flag (vta). 1: tail elements may be overwritten, see SVPolicy
+		bool mask_agnostic //!< Mask agnostic flag (vma). 1: masked-off elements may be overwritten, see SVPolicy
 	);
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief SLL vector-immediate
 	/// \details For all i: D[i] = L[i] << (uimm)
 	VILL::vpu_return_t sll_vi(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint8_t u_imm, //!< Zero extending 5-bit immediate
 		uint16_t vec_elem_start, //!< Starting element [index]
-		bool mask_f //!< Vector mask flag. 1: masking 0: no masking
+		bool mask_f, //!< Vector mask flag. 1: masking 0: no masking
+		bool tail_agnostic, //!< Tail agnostic flag (vta). 1: tail elements may be overwritten, see SVPolicy
+		bool mask_agnostic //!< Mask agnostic flag (vma). 1: masked-off elements may be overwritten, see SVPolicy
 	);
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief SLL vector-scalar
 	/// \details For all i: D[i] = L[i] << (X & possible SEW bits)
 	VILL::vpu_return_t sll_vx(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint8_t* scalar_reg_mem, //!< X: Memory space holding scalar data (min. scalar_reg_len_bytes bytes)
 		uint16_t vec_elem_start, //!< Starting element [index]
 		bool mask_f, //!< Vector mask flag. 1: masking 0: no masking
-		uint8_t scalar_reg_len_bytes //!< Length of scalar [bytes]
+		uint8_t scalar_reg_len_bytes, //!< Length of scalar [bytes]
+		bool tail_agnostic, //!< Tail agnostic flag (vta). 1: tail elements may be overwritten, see SVPolicy
+		bool mask_agnostic //!< Mask agnostic flag (vma). 1: masked-off elements may be overwritten, see SVPolicy
 	);
 
 /* SRL */
@@ -446,50 +387,41 @@ namespace VARITH_INT {
 	/// \brief SRL vector-vector
 	/// \details For all i: D[i] = R[i] >> (L[i] & possible SEW bits)
 	VILL::vpu_return_t srl_vv(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_rhs, //!< Source vector R [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint16_t vec_elem_start, //!< Starting element [index]
-		bool mask_f //!< Vector mask flag. 1: masking 0: no masking
+		bool mask_f, //!< Vector mask flag. 1: masking 0: no masking
+		bool tail_agnostic, //!< Tail agnostic flag (vta). 1: tail elements may be overwritten, see SVPolicy
+		bool mask_agnostic //!< Mask agnostic flag (vma). 1: masked-off elements may be overwritten, see SVPolicy
 	);
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief SRL vector-immediate
 	/// \details For all i: D[i] = L[i] >> (uimm)
 	VILL::vpu_return_t srl_vi(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint8_t u_imm, //!< Zero extending 5-bit immediate
 		uint16_t vec_elem_start, //!< Starting element [index]
-		bool mask_f //!< Vector mask flag. 1: masking 0: no masking
+		bool mask_f, //!< Vector mask flag. 1: masking 0: no masking
+		bool tail_agnostic, //!< Tail agnostic flag (vta). 1: tail elements may be overwritten, see SVPolicy
+		bool mask_agnostic //!< Mask agnostic flag (vma). 1: masked-off elements may be overwritten, see SVPolicy
 	);
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief SRL vector-scalar
 	/// \details For all i: D[i] = L[i] >> (X & possible SEW bits)
 	VILL::vpu_return_t srl_vx(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint8_t* scalar_reg_mem, //!< Memory space holding scalar data (min. _xlenb bytes)
 		uint16_t vec_elem_start, //!< Starting element [index]
 		bool mask_f, //!< Vector mask flag. 1: masking 0: no masking
-		uint8_t scalar_reg_len_bytes //!< Length of scalar [bytes]
+		uint8_t scalar_reg_len_bytes, //!< Length of scalar [bytes]
+		bool tail_agnostic, //!< Tail agnostic flag (vta). 1: tail elements may be overwritten, see SVPolicy
+		bool mask_agnostic //!< Mask agnostic flag (vma). 1: masked-off elements may be overwritten, see SVPolicy
 	);
 
 /* SRA */
@@ -497,50 +429,41 @@ namespace VARITH_INT {
 	/// \brief SRA vector-vector
 	/// \details For all i: D[i] = R[i] >> (L[i] & possible SEW bits)
 	VILL::vpu_return_t sra_vv(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_rhs, //!< Source vector R [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint16_t vec_elem_start, //!< Starting element [index]
-		bool mask_f //!< Vector mask flag. 1: masking 0: no masking
+		bool mask_f, //!< Vector mask flag. 1: masking 0: no masking
+		bool tail_agnostic, //!< Tail agnostic flag (vta). 1: tail elements may be overwritten, see SVPolicy
+		bool mask_agnostic //!< Mask agnostic flag (vma). 1: masked-off elements may be overwritten, see SVPolicy
 	);
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief SRA vector-immediate
 	/// \details For all i: D[i] = L[i] >> (uimm)
 	VILL::vpu_return_t sra_vi(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint8_t u_imm, //!< Zero extending 5-bit immediate
 		uint16_t vec_elem_start, //!< Starting element [index]
-		bool mask_f //!< Vector mask flag. 1: masking 0: no masking
+		bool mask_f, //!< Vector mask flag. 1: masking 0: no masking
+		bool tail_agnostic, //!< Tail agnostic flag (vta). 1: tail elements may be overwritten, see SVPolicy
+		bool mask_agnostic //!< Mask agnostic flag (vma). 1: masked-off elements may be overwritten, see SVPolicy
 	);
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief SRA vector-scalar
 	/// \details For all i: D[i] = L[i] >> (X & possible SEW bits)
 	VILL::vpu_return_t sra_vx(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint8_t* scalar_reg_mem, //!< Memory space holding scalar data (min. _xlenb bytes)
 		uint16_t vec_elem_start, //!< Starting element [index]
 		bool mask_f, //!< Vector mask flag. 1: masking 0: no masking
-		uint8_t scalar_reg_len_bytes //!< Length of scalar [bytes]
+		uint8_t scalar_reg_len_bytes, //!< Length of scalar [bytes]
+		bool tail_agnostic, //!< Tail agnostic flag (vta). 1: tail elements may be overwritten, see SVPolicy
+		bool mask_agnostic //!< Mask agnostic flag (vma). 1: masked-off elements may be overwritten, see SVPolicy
 	);
 /* 12.7. Vector Narrowing Integer Right Shift Instructions */
 //TODO: vnsrl.wv ...
@@ -551,12 +474,7 @@ namespace VARITH_INT {
 	/// \brief (Mask register) SEQ vector-vector
 	/// \details For all i: MaskReg[i] = R[i] == L[i]
 	VILL::vpu_return_t mseq_vv(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_rhs, //!< Source vector R [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
@@ -567,12 +485,7 @@ namespace VARITH_INT {
 	/// \brief (Mask register) SEQ vector-immediate
 	/// \details For all i: MaskReg[i] = R[i] == immediate
 	VILL::vpu_return_t mseq_vi(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint8_t s_imm, //!< Sign extending 5-bit immediate
@@ -583,12 +496,7 @@ namespace VARITH_INT {
 	/// \brief (Mask register) SEQ vector-scalar
 	/// \details For all i: MaskReg[i] = R[i] == zero_extend(X)
 	VILL::vpu_return_t mseq_vx(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint8_t* scalar_reg_mem, //!< Memory space holding scalar data (min. _xlenb bytes)
@@ -601,12 +509,7 @@ namespace VARITH_INT {
 	/// \brief (Mask register) SNE vector-vector
 	/// \details For all i: MaskReg[i] = R[i] != L[i]
 	VILL::vpu_return_t msne_vv(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_rhs, //!< Source vector R [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
@@ -617,12 +520,7 @@ namespace VARITH_INT {
 	/// \brief (Mask register) SNE vector-immediate
 	/// \details For all i: MaskReg[i] = R[i] != immediate
 	VILL::vpu_return_t msne_vi(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint8_t s_imm, //!< Sign extending 5-bit immediate
@@ -633,12 +531,7 @@ namespace VARITH_INT {
 	/// \brief (Mask register) SNE vector-scalar
 	/// \details For all i: MaskReg[i] = R[i] != zero_extend(X)
 	VILL::vpu_return_t msne_vx(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint8_t* scalar_reg_mem, //!< Memory space holding scalar data (min. _xlenb bytes)
@@ -651,12 +544,7 @@ namespace VARITH_INT {
 	/// \brief (Mask register) SLTU vector-vector (less than unsigned)
 	/// \details For all i: MaskReg[i] = R[i] < L[i]
 	VILL::vpu_return_t msltu_vv(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_rhs, //!< Source vector R [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
@@ -667,12 +555,7 @@ namespace VARITH_INT {
 	/// \brief (Mask register) SLTU vector-scalar (less than unsigned)
 	/// \details For all i: MaskReg[i] = R[i] < zero_extend(X)
 	VILL::vpu_return_t msltu_vx(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint8_t* scalar_reg_mem, //!< Memory space holding scalar data (min. _xlenb bytes)
@@ -685,12 +568,7 @@ namespace VARITH_INT {
 	/// \brief (Mask register) SLT vector-vector (less than signed)
 	/// \details For all i: MaskReg[i] = R[i] < L[i]
 	VILL::vpu_return_t mslt_vv(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_rhs, //!< Source vector R [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
@@ -701,12 +579,7 @@ namespace VARITH_INT {
 	/// \brief (Mask register) SLT vector-scalar (less than signed)
 	/// \details For all i: MaskReg[i] = R[i] < zero_extend(X)
 	VILL::vpu_return_t mslt_vx(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint8_t* scalar_reg_mem, //!< Memory space holding scalar data (min. _xlenb bytes)
@@ -719,12 +592,7 @@ namespace VARITH_INT {
 	/// \brief (Mask register) SLEU vector-vector (less than or equal unsigned)
 	/// \details For all i: MaskReg[i] = R[i] < L[i]
 	VILL::vpu_return_t msleu_vv(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_rhs, //!< Source vector R [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
@@ -735,12 +603,7 @@ namespace VARITH_INT {
 	/// \brief (Mask register) SLEU vector-immediate (less than or equal unsigned)
 	/// \details For all i: MaskReg[i] = R[i] < immediate
 	VILL::vpu_return_t msleu_vi(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint8_t u_imm, //!< Zero extending 5-bit immediate
@@ -751,12 +614,7 @@ namespace VARITH_INT {
 	/// \brief (Mask register) SLEU vector-scalar (less than or equal unsigned)
 	/// \details For all i: MaskReg[i] = R[i] < zero_extend(X)
 	VILL::vpu_return_t msleu_vx(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint8_t* scalar_reg_mem, //!< Memory space holding scalar data (min. _xlenb bytes)
@@ -769,12 +627,7 @@ namespace VARITH_INT {
 	/// \brief (Mask register) SLE vector-vector (less than or equal signed)
 	/// \details For all i: MaskReg[i] = R[i] <= L[i]
 	VILL::vpu_return_t msle_vv(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_rhs, //!< Source vector R [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
@@ -785,12 +638,7 @@ namespace VARITH_INT {
 	/// \brief (Mask register) SLE vector-immediate (less than or equal signed)
 	/// \details For all i: MaskReg[i] = R[i] < immediate
 	VILL::vpu_return_t msle_vi(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint8_t s_imm, //!< Sign extending 5-bit immediate
@@ -801,12 +649,7 @@ namespace VARITH_INT {
 	/// \brief (Mask register) SLE vector-scalar (less than or equal signed)
 	/// \details For all i: MaskReg[i] = R[i] < zero_extend(X)
 	VILL::vpu_return_t msle_vx(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint8_t* scalar_reg_mem, //!< Memory space holding scalar data (min. _xlenb bytes)
@@ -819,12 +662,7 @@ namespace VARITH_INT {
 	/// \brief (Mask register) SGTU vector-vector (less than unsigned)
 	/// \details For all i: MaskReg[i] = R[i] > L[i]
 	VILL::vpu_return_t msgtu_vv(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_rhs, //!< Source vector R [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
@@ -835,12 +673,7 @@ namespace VARITH_INT {
 	/// \brief (Mask register) SGTU vector-scalar (less than unsigned)
 	/// \details For all i: MaskReg[i] = R[i] > zero_extend(X)
 	VILL::vpu_return_t msgtu_vx(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint8_t* scalar_reg_mem, //!< Memory space holding scalar data (min. _xlenb bytes)
@@ -853,12 +686,7 @@ namespace VARITH_INT {
 	/// \brief (Mask register) SGT vector-vector (less than signed)
 	/// \details For all i: MaskReg[i] = R[i] > L[i]
 	VILL::vpu_return_t msgt_vv(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_rhs, //!< Source vector R [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
@@ -869,12 +697,7 @@ namespace VARITH_INT {
 	/// \brief (Mask register) SGT vector-scalar (less than signed)
 	/// \details For all i: MaskReg[i] = R[i] > zero_extend(X)
 	VILL::vpu_return_t msgt_vx(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint8_t* scalar_reg_mem, //!< Memory space holding scalar data (min. _xlenb bytes)
@@ -891,45 +714,34 @@ namespace VARITH_INT {
 	/// \brief Signed Multiplication vector-vector low bits of product
 	/// \details For all i: D[i] = L[i] * R[i]
 	VILL::vpu_return_t vmul_vv(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_rhs, //!< Source vector R [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint16_t vec_elem_start, //!< Starting element [index]
-		bool mask_f //!< Vector mask flag. 1: masking 0: no masking
+		bool mask_f, //!< Vector mask flag. 1: masking 0: no masking
+		bool tail_agnostic, //!< Tail agnostic flag (vta). 1: tail elements may be overwritten, see SVPolicy
+		bool mask_agnostic //!< Mask agnostic flag (vma). 1: masked-off elements may be overwritten, see SVPolicy
 	);
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Signed Multiplication vector-scalar low bits of product
 	/// \details For all i: D[i] = L[i] * sign_extend(*X)
 	VILL::vpu_return_t vmul_vx(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint8_t* scalar_reg_mem, //!< Memory space holding scalar data (min. _xlenb bytes)
 		uint16_t vec_elem_start, //!< Starting element [index]
 		bool mask_f, //!< Vector mask flag. 1: masking 0: no masking
-		uint8_t scalar_reg_len_bytes //!< Length of scalar [bytes]
+		uint8_t scalar_reg_len_bytes, //!< Length of scalar [bytes]
+		bool tail_agnostic, //!< Tail agnostic flag (vta). 1: tail elements may be overwritten, see SVPolicy
+		bool mask_agnostic //!< Mask agnostic flag (vma). 1: masked-off elements may be overwritten, see SVPolicy
 	);
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Signed Multiplication vector-vector high bits of product
 	/// \details For all i: D[i] = L[i] * R[i]
 	VILL::vpu_return_t vmulh_vv(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_rhs, //!< Source vector R [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
@@ -940,12 +752,7 @@ namespace VARITH_INT {
 	/// \brief Signed Multiplication vector-scalar high bits of product
 	/// \details For all i: D[i] = L[i] * sign_extend(*X)
 	VILL::vpu_return_t vmulh_vx(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint8_t* scalar_reg_mem, //!< Memory space holding scalar data (min. _xlenb bytes)
@@ -957,12 +764,7 @@ namespace VARITH_INT {
 	/// \brief Unsigned Multiplication vector-vector high bits of product
 	/// \details For all i: D[i] = L[i] * R[i]
 	VILL::vpu_return_t vmulhu_vv(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_rhs, //!< Source vector R [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
@@ -973,12 +775,7 @@ namespace VARITH_INT {
 	/// \brief Unsigned Multiplication vector-scalar high bits of product
 	/// \details For all i: D[i] = L[i] * sign_extend(*X)
 	VILL::vpu_return_t vmulhu_vx(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint8_t* scalar_reg_mem, //!< Memory space holding scalar data (min. _xlenb bytes)
@@ -990,12 +787,7 @@ namespace VARITH_INT {
 	/// \brief Signed * Unsigned Multiplication vector-vector high bits of product
 	/// \details For all i: D[i] = L[i] * R[i]
 	VILL::vpu_return_t vmulhsu_vv(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_rhs, //!< Source vector R [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
@@ -1006,12 +798,7 @@ namespace VARITH_INT {
 	/// \brief Signed * Unsigned Multiplication vector-scalar high bits of product
 	/// \details For all i: D[i] = L[i] * sign_extend(*X)
 	VILL::vpu_return_t vmulhsu_vx(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint16_t src_vec_reg_lhs, //!< Source vector L [index]
 		uint8_t* scalar_reg_mem, //!< Memory space holding scalar data (min. _xlenb bytes)
@@ -1036,12 +823,7 @@ namespace VARITH_INT {
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Move vector vd[i] = vs1[i]
 	VILL::vpu_return_t mv_vv(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector A [index]
 		uint16_t src_vec_reg, //!< Source vector A [index]
 		uint16_t vec_elem_start //!< Starting element [index]
@@ -1050,12 +832,7 @@ namespace VARITH_INT {
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Move vector vd[i] = X[rs1]
 	VILL::vpu_return_t mv_vx(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector A [index]
 		uint8_t* scalar_reg_mem, //!< Memory space holding scalar data (min. _xlenb bytes)
 		uint16_t vec_elem_start, //!< Starting element [index]
@@ -1065,12 +842,7 @@ namespace VARITH_INT {
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Move signed immediate to vector vd[i] = simm
 	VILL::vpu_return_t mv_vi(
-		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional
-		uint64_t emul_num, //!< Register multiplicity numerator
-		uint64_t emul_denom, //!< Register multiplicity denominator
-		uint16_t sew_bytes, //!< Element width [bytes]
-		uint16_t vec_len, //!< Vector length [elements]
-		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		RVVRegField& V, //!< Vector register field, initialized to the instruction's configuration (VLEN, VL, SEW, LMUL)
 		uint16_t dst_vec_reg, //!< Destination vector D [index]
 		uint8_t s_imm, //!< Sign extending 5-bit immediate
 		uint16_t vec_elem_start //!< Starting element [index]
@@ -23,6 +23,8 @@
 #define __RVVHL_BASE_H__
 
 #include "stdint.h"
+#include <array>
+#include <cstddef>
 
 //////////////////////////////////////////////////////////////////////////////////////
 /// \brief This space concludes basic helpers for Illegal-Instruction-related stuff.
@@ -149,17 +151,78 @@ typedef enum BITS_EEW{
 	/// \return Decoded EEW [bits]
 	uint16_t concatEEW(uint8_t mew, uint8_t width);
 
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief Decoded VTYPE bitfield, see TABLE
+	struct config_t {
+		uint32_t sew{}; //!< SEW [bits]
+		uint8_t z_lmul{}; //!< LMUL nominator
+		uint8_t n_lmul{}; //!< LMUL denominator
+		uint8_t ta{}; //!< tail agnostic flag
+		uint8_t ma{}; //!< mask agnostic flag
+		uint8_t vill{}; //!< 1 for a reserved LMUL code, LMUL then reads 1
+	};
+
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief Decode the lower 8 bits of a VTYPE bitfield. Prefer lookup(), which reads the precomputed TABLE.
+	/// \return Decoded fields
+	constexpr config_t decode_config(uint8_t vtype) {
+		config_t ret{};
+		ret.ta = (vtype & MASK::MSKTA) ? 1 : 0;
+		ret.ma = (vtype & MASK::MSKMA) ? 1 : 0;
+		ret.sew = 8u << ((vtype & MASK::MSKSEW) >> OFFSETS::OFFSEW);
+		ret.z_lmul = 1;
+		ret.n_lmul = 1;
+		switch (((vtype & MASK::MSKFLMUL) >> OFFSETS::OFFFLMUL) | (vtype & MASK::MSKLMUL)) {
+		case BITS_LMUL::MF8: 	ret.n_lmul = 8; break;
+		case BITS_LMUL::MF4: 	ret.n_lmul = 4; break;
+		case BITS_LMUL::MF2: 	ret.n_lmul = 2; break;
+		case BITS_LMUL::M1: 	ret.z_lmul = 1; break;
+		case BITS_LMUL::M2: 	ret.z_lmul = 2; break;
+		case BITS_LMUL::M4: 	ret.z_lmul = 4; break;
+		case BITS_LMUL::M8: 	ret.z_lmul = 8; break;
+		default: ret.vill = 1; break;
+		}
+		return (ret);
+	}
+
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief Build the decode table at compile time
+	constexpr std::array<config_t, 256> make_table(void) {
+		std::array<config_t, 256> ret{};
+		for (size_t i = 0; i < ret.size(); ++i) {
+			ret[i] = decode_config(static_cast<uint8_t>(i));
+		}
+		return (ret);
+	}
+
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief All VTYPE encodings, decoded. Indexed by the lower 8 bits of the bitfield, upper bits are ignored by decoding.
+	inline constexpr std::array<config_t, 256> TABLE = make_table();
+
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief Decoded fields of a VTYPE bitfield
+	/// \return Reference to the TABLE entry, valid for the lifetime of the program
+	inline const config_t& lookup(uint16_t vtype) {
+		return (TABLE[vtype & 0xFF]);
+	}
+
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \class VTYPE
 	/// \brief decodes (vtype bitvector) or encodes (variables to vtype bv) on construction
 	class VTYPE {
 	public:
 		uint16_t _bitfield{};
-		uint8_t _z_lmul{}, _n_lmul{}, _ta{}, _ma{};
+		uint8_t _z_lmul{}, _n_lmul{}, _ta{}, _ma{}, _vill{};
 		uint32_t _sew{};
-		VTYPE(uint16_t _vtype_bitfield): _bitfield(_vtype_bitfield){
-			decode(_bitfield, &_ta, &_ma, &_sew, &_z_lmul, &_n_lmul);
-		}
+		VTYPE(uint16_t _vtype_bitfield): VTYPE(_vtype_bitfield, lookup(_vtype_bitfield)) {}
+		VTYPE(uint16_t _vtype_bitfield, const config_t& _config)
+		: _bitfield(_vtype_bitfield)
+		, _z_lmul(_config.z_lmul)
+		, _n_lmul(_config.n_lmul)
+		, _ta(_config.ta)
+		, _ma(_config.ma)
+		, _vill(_config.vill)
+		, _sew(_config.sew) {}
 		VTYPE(uint16_t sew, uint8_t z_lmul, uint8_t n_lmul, uint8_t ta, uint8_t ma)
 		: _z_lmul(z_lmul)
 		, _n_lmul(n_lmul)
@@ -23,10 +23,11 @@
 #define __SOFTVECTOR_PLATFORM_TYPES_H__
 
 #include "stdint.h"
-#include <vector>
 #include <array>
+#include <optional>
 
 #include "vpu/softvector-types.hpp"
+#include "base/base.hpp"
 
 #define SVMaskReg SVRegister
 
@@ -48,42 +49,26 @@ public:
 
 //////////////////////////////////////////////////////////////////////////////////////
 /// \class RVVector
-/// \brief RISC-V Vector. Makes use of one single SVElement changing its reference to data storage. This prevents excessive allocation overhead.
+/// \brief RISC-V Vector. View onto a vector register (group) of the register field. Elements are accessed by pointer arithmetic, nothing is allocated per element.
 class RVVector
 	: public SVector {
 public:
-	uint8_t* mem_; //!< Main memory.
-	SVElement& activeElement; //!< Element referencer, is updated when subscript is applied to an object of this class
-
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Check if memory space of this RVVector overlaps with another
 	/// \param v RVVector to test against
 	/// \returns 1 if v starts within this. -1 if this starts within v. 0 if no overlap detected.
 	int8_t check_mem_overlap(const RVVector& v) {
-		if( (v.mem_ >= mem_) && (v.mem_ < mem_+length_*activeElement.width_in_bits_))
+		if( (v.mem_ >= mem_) && (v.mem_ < mem_+length_*single_element_width_bits_))
 			return 1;
-		if( (mem_ >= v.mem_) && (mem_ < v.mem_+v.length_*v.activeElement.width_in_bits_))
+		if( (mem_ >= v.mem_) && (mem_ < v.mem_+v.length_*v.single_element_width_bits_))
 			return -1;
 		return 0;
 	}
 
-	//////////////////////////////////////////////////////////////////////////////////////
-	/// \brief Overloaded array subscript to return the indexed SVElement as reference
-	SVElement& operator[](const size_t index) const {
-		activeElement.mem_ = mem_ + index * activeElement.width_in_bits_/8;
-		return(activeElement);
-	}
-
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Constructor for referenced elements, i.e. externally allocated elements
 	RVVector(const size_t length_elements, const size_t single_element_width_bits, const size_t start_reg_index, uint8_t* mem)
-	: SVector(length_elements, start_reg_index)
-	, mem_(mem)
-	, activeElement(*(new SVElement(single_element_width_bits, mem))) {}
-
-	virtual ~RVVector(void){
-		delete &activeElement;
-	}
+	: SVector(length_elements, single_element_width_bits, start_reg_index, mem) {}
 };
 
 //////////////////////////////////////////////////////////////////////////////////////
@@ -91,13 +76,14 @@ public:
 /// \brief RISC-V Vector Register Field. Interprets a one-dimensional byte array as a riscv-vector extension register field. Representation in SVector depends on configuration (VTYPE, VLEN, ...) passed on construction.
 class RVVRegField {
 protected:
-	std::vector<RVVector*> vs_{}; //!< Vector of RVVector's
+	std::array<std::optional<RVVector>, 32> vs_{}; //!< Register group views, indexed by the group's first register. Built on first access.
 	std::array<SVRegister, 32> regs_{}; //!< Fixed sized (32) SVRegister s. v0...v31
 	const size_t vector_register_length_bits_; //!< VLEN, Vector register length in bits
-	const size_t vector_length_; //!< VL, Vector length in elements
+	size_t vector_length_; //!< VL, Vector length in elements
 	const size_t single_element_width_bits_; //!< SEW, single element width in bits
 	uint8_t* mem_; //!< Main memory.
 	const SVMul multiplicity_; //!< LMUL, Vector register multiplicity, i.e. how many vector register make up one vector
+	size_t group_size_regs_{1}; //!< How many vector register make up one vector
 public:
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Constructor for referenced main memory, i.e. externally allocated memory
@@ -115,50 +101,49 @@ public:
 	, multiplicity_(multiplicity) {}
 
 	//////////////////////////////////////////////////////////////////////////////////////
-	/// \brief Initialization method. Call after constructor before use.
+	/// \brief Initialization method. Call after constructor before use. Register group views are not built here, but on first access by get_vec().
 	void init(void) {
-		size_t group_size_regs = (multiplicity_.is_frac() ? 1 : multiplicity_.n_ / multiplicity_.d_); //!< How many vector register make up one vector
-		size_t n_vector_register_groups = (regs_.size() / (multiplicity_.is_frac() ? 1 : multiplicity_.n_ / multiplicity_.d_)); //!< How many vector register groups
+		group_size_regs_ = (multiplicity_.is_frac() ? 1 : multiplicity_.n_ / multiplicity_.d_);
 
 		uint8_t* tmem = mem_;
 		for(auto &it: regs_){
 			it.init_ref(vector_register_length_bits_, tmem);
 			tmem += vector_register_length_bits_/8;
 		}
-		for(size_t i_group = 0; i_group < n_vector_register_groups; ++i_group){
-			vs_.push_back( new RVVector(vector_length_, single_element_width_bits_, i_group*group_size_regs, regs_[i_group*group_size_regs].mem_));
-		}
 	}
 
 	//////////////////////////////////////////////////////////////////////////////////////
-	/// \brief Destructor. Deletes generated SVector and SRegister fields
-	virtual ~RVVRegField(void) {
-		for(auto &v: vs_) {
-			delete v;
-		}
+	/// \brief Change VL of an initialized field. Views already built are kept, their length is updated on access.
+	void set_vector_length(const size_t vector_length) {
+		vector_length_ = vector_length;
 	}
 
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief Destructor
+	virtual ~RVVRegField(void) {}
+
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Check wether passed register number is aligned with the current vector register field configuration.
 	/// \param reg_n Register number
 	/// \returns True unless not aligned.
 	bool vec_reg_is_aligned(const size_t reg_n) {
-		if(multiplicity_.is_frac()) {
+		if(!multiplicity_.is_frac()) {
 			return ( (reg_n % (multiplicity_.n_/multiplicity_.d_)) ? false : true);
 		}
 		return (true);
 	}
 
 	//////////////////////////////////////////////////////////////////////////////////////
-	/// \brief Get the SVector for a given register number. Aligns to the vector containing the passed register number
+	/// \brief Get the SVector for a given register number. Aligns to the vector containing the passed register number.
+	/// The view is looked up by its first register and built on first access.
 	RVVector& get_vec(const size_t reg_n) {
-		RVVector* ret = nullptr;
-		for(size_t i_vec = 0; i_vec < vs_.size(); ++i_vec) {
-			ret = vs_[i_vec];
-			if((reg_n == vs_[i_vec]->start_reg_index_)) {
-				break;
-			}
+		const size_t reg = reg_n % regs_.size();
+		const size_t start_reg = reg - reg % group_size_regs_;
+		std::optional<RVVector>& ret = vs_[start_reg];
+		if(!ret) {
+			ret.emplace(vector_length_, single_element_width_bits_, start_reg, regs_[start_reg].mem_);
 		}
+		ret->length_ = vector_length_;
 		return(*ret);
 	}
 	//////////////////////////////////////////////////////////////////////////////////////
@@ -171,6 +156,92 @@ public:
 	SVRegister& get_mask_reg(void) {
 		return(regs_[0]);
 	}
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief Destination policy for the tail/mask agnostic flags (vta/vma) of an instruction. The tail reaches up to VLMAX.
+	/// Agnostic flags are ignored, i.e. handled as undisturbed, unless SVPolicy::enabled().
+	SVPolicy policy(const bool tail_agnostic, const bool mask_agnostic) const {
+		SVPolicy ret;
+		if(SVPolicy::enabled()) {
+			ret.tail_end_ = tail_agnostic ? vector_register_length_bits_*multiplicity_.n_/multiplicity_.d_/single_element_width_bits_ : 0;
+			ret.mask_agnostic_ = mask_agnostic;
+		}
+		return(ret);
+	}
+};
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \class RVVContext
+/// \brief RISC-V Vector unit context. Binds the vector and scalar register fields, VLEN and XLEN once and keeps the
+/// RVVRegField of the last configuration. The field is rebuilt only if SEW or LMUL of vtype change, a different VL only updates the vector lengths.
+class RVVContext {
+	uint8_t* mem_; //!< Vector register field memory
+	uint8_t* scalar_mem_; //!< Integer register field memory
+	const size_t vector_register_length_bits_; //!< VLEN, Vector register length in bits
+	const size_t xlen_bits_; //!< XLEN, Integer register length in bits
+	uint16_t config_{0}; //!< SEW and LMUL bits of the vtype field_ was built for
+	RVVRegField* field_{nullptr}; //!< Register field of the last configuration
+public:
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief Constructor for referenced register fields, i.e. externally allocated memory
+	RVVContext(
+		uint8_t* mem, //!< Vector register memory field
+		uint8_t* scalar_mem, //!< Integer register memory field
+		const size_t vector_register_length_bits, //!< VLEN
+		const size_t xlen_bits //!< XLEN
+	)
+	: mem_(mem)
+	, scalar_mem_(scalar_mem)
+	, vector_register_length_bits_(vector_register_length_bits)
+	, xlen_bits_(xlen_bits) {}
+
+	RVVContext(const RVVContext&) = delete;
+	RVVContext& operator=(const RVVContext&) = delete;
+
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief Destructor. Deletes the register field
+	virtual ~RVVContext(void) {
+		delete field_;
+	}
+
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief Get the initialized register field for a vtype bitfield and VL
+	RVVRegField& field(const uint16_t vtype, const size_t vector_length) {
+		const uint16_t config = vtype & (VTYPE::MSKSEW | VTYPE::MSKLMUL | VTYPE::MSKFLMUL);
+		if(field_ && (config == config_)) {
+			field_->set_vector_length(vector_length);
+			return(*field_);
+		}
+		const VTYPE::VTYPE vt(vtype);
+		delete field_;
+		field_ = new RVVRegField(vector_register_length_bits_, vector_length, vt._sew, SVMul(vt._z_lmul, vt._n_lmul), mem_);
+		field_->init();
+		config_ = config;
+		return(*field_);
+	}
+
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief Get the memory of vector register reg_n
+	uint8_t* vector_reg(const size_t reg_n) const {
+		return(mem_ + reg_n*(vector_register_length_bits_/8));
+	}
+
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief VLEN in bits
+	size_t vlen_bits(void) const {
+		return(vector_register_length_bits_);
+	}
+
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief Get the memory of integer register reg_n. Registers are 4 bytes apart for XLEN <= 32, else 8 bytes.
+	uint8_t* scalar_reg(const size_t reg_n) const {
+		return(scalar_mem_ + reg_n*((xlen_bits_ <= 32) ? 4 : 8));
+	}
+
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief XLEN in bytes
+	uint8_t xlen_bytes(void) const {
+		return(xlen_bits_/8);
+	}
 };
 
 #endif /* __SOFTVECOR_TYPES_H__ */
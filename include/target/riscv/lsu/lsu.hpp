@@ -25,6 +25,7 @@
 #include "stdint.h"
 #include <functional>
 #include "base/base.hpp"
+#include "base/softvector-platform-types.hpp"
 
 //////////////////////////////////////////////////////////////////////////////////////
 /// \brief This space concludes load-store helpers
@@ -65,6 +66,250 @@ namespace VLSU {
 		int16_t  stride_bytes //!< Stride length [bytes]
 	);
 
+/* Unit-stride, contiguous memory */
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// @brief Load <vl>-times <eew>-elements from contiguous memory into vector register file, i.e. load_eew() with stride 0
+	/// reading mem directly. Unmasked loads are a single copy, masked loads copy runs of consecutive active elements.
+	/// The mask is read ahead of the copies, i.e. a masked load into v0 (reserved) may differ from load_eew().
+	VILL::vpu_return_t load_unitstride(
+		const uint8_t* mem, //!< Memory space, addressed by src_mem_start
+		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional [0..32*VLEN-1] byte array
+		uint64_t emul_num, //!< Effective register multiplicity numerator
+		uint64_t emul_denom, //!< Effective register multiplicity denominator
+		uint16_t eew_bytes, //!< Effective element width [bytes]
+		uint16_t vec_len, //!< Vector length [elements]
+		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		uint16_t dst_vec_reg, //!< Destination vector [index]
+		uint64_t src_mem_start, //!< Source memory start address
+		uint16_t vec_elem_start, //!< Starting element [index]
+		uint8_t  mask_f //!< vm bit of the instruction. 0: masked by v0, 1: unmasked
+	);
+
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief Store <vl>-times <eew>-elements from vector register file to contiguous memory, i.e. store_eew() with stride 0
+	/// writing mem directly. Unmasked stores are a single copy, masked stores copy runs of consecutive active elements.
+	VILL::vpu_return_t store_unitstride(
+		uint8_t* mem, //!< Memory space, addressed by dst_mem_start
+		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional [0..32*VLEN-1] byte array
+		uint64_t emul_num, //!< Effective register multiplicity numerator
+		uint64_t emul_denom, //!< Effective register multiplicity denominator
+		uint16_t eew_bytes, //!< Effective element width [bytes]
+		uint16_t vec_len, //!< Vector length [elements]
+		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		uint16_t src_vec_reg, //!< Source vector register [index]
+		uint64_t dst_mem_start, //!< Destination memory start address
+		uint16_t vec_elem_start, //!< Starting element [index]
+		uint8_t  mask_f //!< vm bit of the instruction. 0: masked by v0, 1: unmasked
+	);
+
+/* Segments, contiguous memory */
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// @brief Load <vl>-times segments of <nf> <eew>-fields from contiguous memory (array of structures) into <nf> vector register groups.
+	/// Field f of segment i at src_mem_start + (i*nf + f)*eew_bytes is loaded to element i of the group dst_vec_reg + f*EMUL (one register per field for EMUL < 1).
+	/// Runs of consecutive active segments are de-interleaved at once by SVSIMD::deinterleave(), element by element if it is not available.
+	VILL::vpu_return_t load_segment(
+		const uint8_t* mem, //!< Memory space, addressed by src_mem_start
+		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional [0..32*VLEN-1] byte array
+		uint64_t emul_num, //!< Effective register multiplicity numerator
+		uint64_t emul_denom, //!< Effective register multiplicity denominator
+		uint16_t eew_bytes, //!< Effective element width [bytes]
+		uint8_t  nf, //!< Number of fields [1..8]
+		uint16_t vec_len, //!< Vector length [elements]
+		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		uint16_t dst_vec_reg, //!< Destination vector of the first field [index]
+		uint64_t src_mem_start, //!< Source memory start address
+		uint16_t vec_elem_start, //!< Starting element [index]
+		uint8_t  mask_f //!< vm bit of the instruction. 0: masked by v0, 1: unmasked
+	);
+
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief Store <vl>-times segments of <nf> <eew>-fields from <nf> vector register groups to contiguous memory (array of structures), inverse of load_segment().
+	/// Runs of consecutive active segments are interleaved at once by SVSIMD::interleave(), element by element if it is not available.
+	VILL::vpu_return_t store_segment(
+		uint8_t* mem, //!< Memory space, addressed by dst_mem_start
+		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional [0..32*VLEN-1] byte array
+		uint64_t emul_num, //!< Effective register multiplicity numerator
+		uint64_t emul_denom, //!< Effective register multiplicity denominator
+		uint16_t eew_bytes, //!< Effective element width [bytes]
+		uint8_t  nf, //!< Number of fields [1..8]
+		uint16_t vec_len, //!< Vector length [elements]
+		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		uint16_t src_vec_reg, //!< Source vector register of the first field [index]
+		uint64_t dst_mem_start, //!< Destination memory start address
+		uint16_t vec_elem_start, //!< Starting element [index]
+		uint8_t  mask_f //!< vm bit of the instruction. 0: masked by v0, 1: unmasked
+	);
+
+/* Coalesced memory ranges */
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief Calls f(addr, vec_mem, len) for the memory ranges of a <vl>-times <eew>-elements access, ascending, see load_eew() for the addressing.
+	/// Adjacent active elements are merged into one range of len bytes at addr, backed by the register group memory vec_mem, if they are contiguous in memory, i.e. for stride_bytes 0.
+	/// All ranges are located before the mask could be written by the access.
+	/// \return DST_VEC_ILL without calling f if vec_reg is not aligned
+	template<typename F>
+	VILL::vpu_return_t for_each_range(
+		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional [0..32*VLEN-1] byte array
+		uint64_t emul_num, //!< Effective register multiplicity numerator
+		uint64_t emul_denom, //!< Effective register multiplicity denominator
+		uint16_t eew_bytes, //!< Effective element width [bytes]
+		uint16_t vec_len, //!< Vector length [elements]
+		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		uint16_t vec_reg, //!< Destination (loads) or source (stores) vector register [index]
+		uint64_t mem_start, //!< Memory start address
+		uint16_t vec_elem_start, //!< Starting element [index]
+		uint8_t  mask_f, //!< vm bit of the instruction. 0: masked by v0, 1: unmasked
+		int16_t  stride_bytes, //!< Stride length [bytes]
+		F&& f //!< Called as f(uint64_t addr, uint8_t* vec_mem, size_t len)
+	) {
+		RVVRegField V(vec_reg_len_bytes*8, vec_len, eew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
+
+		if (! V.vec_reg_is_aligned(vec_reg) ) {
+			return(VILL::VPU_RETURN::DST_VEC_ILL);
+		}
+		V.init();
+
+		uint8_t* vec_mem = V.get_vec(vec_reg).mem_;
+		const uint64_t elem_offset = static_cast<int64_t>(eew_bytes + stride_bytes);
+		V.get_mask_reg().for_each_active_run(vec_elem_start, vec_len, !mask_f, [&](size_t iElement, size_t nElements) {
+			if(!stride_bytes) {
+				f(mem_start + iElement*elem_offset, vec_mem + iElement*eew_bytes, nElements*eew_bytes);
+				return;
+			}
+			for(size_t i = iElement; i < iElement + nElements; ++i) {
+				f(mem_start + i*elem_offset, vec_mem + i*eew_bytes, static_cast<size_t>(eew_bytes));
+			}
+		});
+		return(VILL::VPU_RETURN::NO_EXCEPT);
+	}
+
+/* Fault-only-first */
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief First faulting element of a unit-stride <eew>-elements access, i.e. the first active element in [vec_elem_start, vec_len) with a byte in an invalid page.
+	/// The pages of the active elements are queried by page_valid(page address) at most once each, in ascending order, and only up to the first invalid one.
+	/// \return vec_len if no element faults, i.e. also 0 for vec_len 0. Callers distinguish empty accesses before.
+	template<typename F>
+	size_t first_fault(
+		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional [0..32*VLEN-1] byte array
+		uint16_t eew_bytes, //!< Effective element width [bytes]
+		uint16_t vec_len, //!< Vector length [elements]
+		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		uint64_t src_mem_start, //!< Source memory start address
+		uint16_t vec_elem_start, //!< Starting element [index]
+		uint8_t  mask_f, //!< vm bit of the instruction. 0: masked by v0, 1: unmasked
+		uint64_t page_bytes, //!< Page size [bytes]
+		F&& page_valid //!< Called as page_valid(uint64_t page), true if the page can be accessed
+	) {
+		const SVRegister mask(vec_reg_len_bytes*8, vec_reg_mem);
+		uint64_t valid_end = src_mem_start; // End of the valid pages probed so far
+		size_t iElement = mask.find_active(vec_elem_start, vec_len, !mask_f);
+		while(iElement < vec_len) {
+			const uint64_t first = src_mem_start + iElement*eew_bytes;
+			const uint64_t last = first + eew_bytes - 1;
+			for(uint64_t page = (first > valid_end ? first : valid_end); page <= last; page = valid_end) {
+				page -= page % page_bytes;
+				if(!page_valid(page)) {
+					return(iElement);
+				}
+				valid_end = page + page_bytes;
+			}
+			// Elements ending before valid_end are covered
+			const size_t iNext = (valid_end - src_mem_start)/eew_bytes;
+			iElement = mask.find_active((iNext > iElement) ? iNext : iElement + 1, vec_len, !mask_f);
+		}
+		return(vec_len);
+	}
+
+/* Indexed */
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief Calls f(addr, vec_mem, len) for every active element of an indexed access, in element order.
+	/// Element i of the data register group vec_reg (SEW, LMUL) is at mem_start plus the zero-extended element i of the index register group index_vec_reg (index EEW and EMUL).
+	/// vec_mem is the register memory of element i, len is SEW in bytes.
+	/// \return DST_VEC_ILL (data) or SRC2_VEC_ILL (index) without calling f if a register group is not aligned, SRC2_VEC_ILL if the index width is not 1, 2, 4 or 8 bytes
+	template<typename F>
+	VILL::vpu_return_t for_each_indexed(
+		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional [0..32*VLEN-1] byte array
+		uint64_t mul_num, //!< Data register multiplicity (LMUL) numerator
+		uint64_t mul_denom, //!< Data register multiplicity (LMUL) denominator
+		uint16_t sew_bytes, //!< Data element width [bytes]
+		uint64_t index_emul_num, //!< Index register multiplicity numerator
+		uint64_t index_emul_denom, //!< Index register multiplicity denominator
+		uint16_t index_eew_bytes, //!< Index element width [bytes]
+		uint16_t vec_len, //!< Vector length [elements]
+		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		uint16_t vec_reg, //!< Destination (loads) or source (stores) vector register [index]
+		uint16_t index_vec_reg, //!< Index vector register [index]
+		uint64_t mem_start, //!< Memory base address
+		uint16_t vec_elem_start, //!< Starting element [index]
+		uint8_t  mask_f, //!< vm bit of the instruction. 0: masked by v0, 1: unmasked
+		F&& f //!< Called as f(uint64_t addr, uint8_t* vec_mem, size_t len)
+	) {
+		if ((index_eew_bytes != 1) && (index_eew_bytes != 2) && (index_eew_bytes != 4) && (index_eew_bytes != 8)) {
+			return(VILL::VPU_RETURN::SRC2_VEC_ILL);
+		}
+		RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(mul_num, mul_denom), vec_reg_mem);
+		RVVRegField I(vec_reg_len_bytes*8, vec_len, index_eew_bytes*8, SVMul(index_emul_num, index_emul_denom), vec_reg_mem);
+
+		if (! V.vec_reg_is_aligned(vec_reg) ) {
+			return(VILL::VPU_RETURN::DST_VEC_ILL);
+		}
+		if (! I.vec_reg_is_aligned(index_vec_reg) ) {
+			return(VILL::VPU_RETURN::SRC2_VEC_ILL);
+		}
+		V.init();
+
+		uint8_t* vec_mem = vec_reg_mem + vec_reg*vec_reg_len_bytes;
+		const uint8_t* index_mem = vec_reg_mem + index_vec_reg*vec_reg_len_bytes;
+		V.get_mask_reg().for_each_active(vec_elem_start, vec_len, !mask_f, [&](size_t iElement) {
+			const uint8_t* index = index_mem + iElement*index_eew_bytes;
+			uint64_t offset = 0;
+			for(size_t i = 0; i < index_eew_bytes; ++i) {
+				offset |= static_cast<uint64_t>(index[i]) << (8*i);
+			}
+			f(mem_start + offset, vec_mem + iElement*sew_bytes, static_cast<size_t>(sew_bytes));
+		});
+		return(VILL::VPU_RETURN::NO_EXCEPT);
+	}
+
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// @brief Load <vl>-times <sew>-elements from memory, addressed by an index vector, into vector register file (gather), see for_each_indexed()
+	VILL::vpu_return_t load_indexed(
+		const uint8_t* mem, //!< Memory space, addressed by src_mem_start
+		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional [0..32*VLEN-1] byte array
+		uint64_t mul_num, //!< Data register multiplicity (LMUL) numerator
+		uint64_t mul_denom, //!< Data register multiplicity (LMUL) denominator
+		uint16_t sew_bytes, //!< Data element width [bytes]
+		uint64_t index_emul_num, //!< Index register multiplicity numerator
+		uint64_t index_emul_denom, //!< Index register multiplicity denominator
+		uint16_t index_eew_bytes, //!< Index element width [bytes]
+		uint16_t vec_len, //!< Vector length [elements]
+		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		uint16_t dst_vec_reg, //!< Destination vector [index]
+		uint16_t index_vec_reg, //!< Index vector register [index]
+		uint64_t src_mem_start, //!< Source memory base address
+		uint16_t vec_elem_start, //!< Starting element [index]
+		uint8_t  mask_f //!< vm bit of the instruction. 0: masked by v0, 1: unmasked
+	);
+
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief Store <vl>-times <sew>-elements from vector register file to memory, addressed by an index vector (scatter), in element order, see for_each_indexed()
+	VILL::vpu_return_t store_indexed(
+		uint8_t* mem, //!< Memory space, addressed by dst_mem_start
+		uint8_t* vec_reg_mem, //!< Vector register file memory space. One dimensional [0..32*VLEN-1] byte array
+		uint64_t mul_num, //!< Data register multiplicity (LMUL) numerator
+		uint64_t mul_denom, //!< Data register multiplicity (LMUL) denominator
+		uint16_t sew_bytes, //!< Data element width [bytes]
+		uint64_t index_emul_num, //!< Index register multiplicity numerator
+		uint64_t index_emul_denom, //!< Index register multiplicity denominator
+		uint16_t index_eew_bytes, //!< Index element width [bytes]
+		uint16_t vec_len, //!< Vector length [elements]
+		uint16_t vec_reg_len_bytes, //!< Vector register length [bytes]
+		uint16_t src_vec_reg, //!< Source vector register [index]
+		uint16_t index_vec_reg, //!< Index vector register [index]
+		uint64_t dst_mem_start, //!< Destination memory base address
+		uint16_t vec_elem_start, //!< Starting element [index]
+		uint8_t  mask_f //!< vm bit of the instruction. 0: masked by v0, 1: unmasked
+	);
+
 }
 
 #endif /* __RVVHL_VLSU_H__ */
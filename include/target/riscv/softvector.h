@@ -87,6 +87,26 @@ uint16_t vcfg_concatEEW(uint8_t mew, 	//!<[in] MEW bit
 	uint8_t width //!<[in] WIDTH bits
 );
 
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Decoded VTYPE bitfield, see vtype_config()
+typedef struct sv_vtype {
+	uint16_t vtype; //!< vtype bitfield (lower 8 bits)
+	uint32_t sew; //!< SEW (decoded) [bits]
+	uint8_t z_lmul; //!< LMUL nominator
+	uint8_t n_lmul; //!< LMUL denominator
+	uint8_t ta; //!< tail agnostic flag
+	uint8_t ma; //!< mask agnostic flag
+	uint8_t vill; //!< 1 if the LMUL code is reserved
+} sv_vtype;
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Decoded configuration of a VTYPE bitfield. All encodings are decoded at compile time, i.e. this is a table lookup.
+/// The handle stays valid for the lifetime of the program and can be kept from one vsetvl{i} to the next instead of decoding on every instruction.
+/// \return Handle to static storage, never NULL
+const sv_vtype* vtype_config(
+	uint16_t pVTYPE //!<[in] vtype bitfield
+);
+
 /* Vector Loads/Stores Helpers*/
 //////////////////////////////////////////////////////////////////////////////////////
 /// \brief Load encoded (unitstride) from memory to target vector (-group)
@@ -152,6 +172,172 @@ uint8_t vstore_segment_stride(
 	uint8_t* pM, //!<[inout] Local memory
 	uint16_t pVTYPE, uint8_t  pVm, uint16_t pEEW, uint8_t pNF, uint8_t pVd, uint16_t pVSTART, uint16_t pVLEN, uint16_t pVL, uint64_t pMSTART, int16_t pStride);
 
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Contiguous memory range of a vector load/store, see sv_mem_access
+typedef struct sv_mem_range {
+	uint64_t addr; //!< Memory address of the first byte
+	uint8_t* data; //!< Register field memory of the range, to be filled (loads) or read (stores)
+	uint64_t len; //!< Length [bytes]
+} sv_mem_range;
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Host memory access of the vload/vstore_ranges_* functions. Called once per instruction with all ranges of its active elements,
+/// ascending by element, not at all if no element is active. Adjacent elements are merged into maximal contiguous ranges. The ranges are only valid during the call.
+/// Like the functions on pM, the vload/vstore_ranges_* functions return 1 for register groups not aligned to EMUL, here without a call.
+/// \return 0 on success, else the instruction returns 1 (access fault)
+typedef uint8_t (*sv_mem_access)(
+	void* user, //!<[inout] User context as passed to the vload/vstore_ranges_* function
+	const sv_mem_range* ranges, //!<[in] Memory ranges
+	uint32_t n_ranges //!<[in] Number of ranges
+);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Load encoded (unitstride) from memory to target vector (-group) through pRead. Unmasked loads are a single range.
+/// \return 0 if no exception triggered, else 1
+uint8_t vload_ranges_unitstride(
+	void* pV, //!<[inout] Vector register field as local memory
+	sv_mem_access pRead, //!<[in] Memory read access filling the ranges
+	void* pUser, //!<[inout] User context passed to pRead
+	uint16_t pVTYPE, uint8_t  pVm, uint16_t pEEW, uint8_t  pVd, uint16_t pVSTART, uint16_t pVLEN, uint16_t pVL, uint64_t pMSTART);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Load encoded (strided) from memory to target vector (-group) through pRead. pSTRIDE as for vload_encoded_stride().
+/// \return 0 if no exception triggered, else 1
+uint8_t vload_ranges_stride(
+	void* pV, //!<[inout] Vector register field as local memory
+	sv_mem_access pRead, //!<[in] Memory read access filling the ranges
+	void* pUser, //!<[inout] User context passed to pRead
+	uint16_t pVTYPE, uint8_t  pVm, uint16_t pEEW, uint8_t  pVd, uint16_t pVSTART, uint16_t pVLEN, uint16_t pVL, uint64_t pMSTART, int16_t pSTRIDE);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Store encoded (unitstride) source vector (-group) to memory through pWrite. Unmasked stores are a single range.
+/// \return 0 if no exception triggered, else 1
+uint8_t vstore_ranges_unitstride(
+	void* pV, //!<[inout] Vector register field as local memory
+	sv_mem_access pWrite, //!<[in] Memory write access storing the ranges
+	void* pUser, //!<[inout] User context passed to pWrite
+	uint16_t pVTYPE, uint8_t pVm, uint16_t pEEW, uint8_t pVd, uint16_t pVSTART, uint16_t pVLEN, uint16_t pVL, uint64_t pMSTART);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Store encoded (strided) source vector (-group) to memory through pWrite. pStride as for vstore_encoded_stride().
+/// \return 0 if no exception triggered, else 1
+uint8_t vstore_ranges_stride(
+	void* pV, //!<[inout] Vector register field as local memory
+	sv_mem_access pWrite, //!<[in] Memory write access storing the ranges
+	void* pUser, //!<[inout] User context passed to pWrite
+	uint16_t pVTYPE, uint8_t pVm, uint16_t pEEW, uint8_t pVd, uint16_t pVSTART, uint16_t pVLEN, uint16_t pVL, uint64_t pMSTART, int16_t pStride);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Host page query of the fault-only-first loads
+/// \return Nonzero if the page starting at addr can be read
+typedef uint8_t (*sv_page_valid)(
+	void* user, //!<[inout] User context as passed to the vload*_ff_* function
+	uint64_t addr //!<[in] Page address, a multiple of the page size
+);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Load encoded fault-only-first (unitstride, vle<eew>ff) from memory to target vector (-group).
+/// Before any element is loaded, the pages of the active elements are queried through pValid, each at most once and in ascending order.
+/// If an active element other than element 0 touches an invalid page, *pVL is trimmed to that element and only the elements below it are loaded.
+/// \return 0 if no exception triggered, else 1 (e.g. element 0 touches an invalid page, then nothing is loaded and *pVL is kept)
+uint8_t vload_ff_unitstride(
+	void* pV, //!<[inout] Vector register field as local memory
+	uint8_t* pM, //!<[inout] Local memory
+	sv_page_valid pValid, //!<[in] Page query
+	void* pUser, //!<[inout] User context passed to pValid
+	uint64_t pPAGESIZE, //!<[in] Page size [bytes]
+	uint16_t pVTYPE, uint8_t  pVm, uint16_t pEEW, uint8_t  pVd, uint16_t pVSTART, uint16_t pVLEN,
+	uint16_t* pVL, //!<[inout] Vector length, trimmed to the first faulting element
+	uint64_t pMSTART);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Load encoded fault-only-first (unitstride, vle<eew>ff) through pRead, see vload_ff_unitstride() and vload_ranges_unitstride().
+/// pRead is called with the ranges of the elements below the trimmed vl.
+/// \return 0 if no exception triggered, else 1
+uint8_t vload_ranges_ff_unitstride(
+	void* pV, //!<[inout] Vector register field as local memory
+	sv_mem_access pRead, //!<[in] Memory read access filling the ranges
+	sv_page_valid pValid, //!<[in] Page query
+	void* pUser, //!<[inout] User context passed to pRead and pValid
+	uint64_t pPAGESIZE, //!<[in] Page size [bytes]
+	uint16_t pVTYPE, uint8_t  pVm, uint16_t pEEW, uint8_t  pVd, uint16_t pVSTART, uint16_t pVLEN,
+	uint16_t* pVL, //!<[inout] Vector length, trimmed to the first faulting element
+	uint64_t pMSTART);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Load indexed-unordered (vluxei) from memory to target vector (-group). pEEW is the index width (8, 16, 32 or 64), data elements are SEW wide.
+/// Element i is loaded from pMSTART plus the zero-extended element i of index vector (-group) pVs2. Elements are loaded in element order.
+/// \return 0 if no exception triggered, else 1 (also for other index widths)
+uint8_t vload_indexed_unordered(
+	void* pV, //!<[inout] Vector register field as local memory
+	uint8_t* pM, //!<[inout] Local memory
+	uint16_t pVTYPE, uint8_t  pVm, uint16_t pEEW, uint8_t  pVd, uint8_t pVs2, uint16_t pVSTART, uint16_t pVLEN, uint16_t pVL, uint64_t pMSTART);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Load indexed-ordered (vloxei) from memory to target vector (-group), see vload_indexed_unordered()
+/// \return 0 if no exception triggered, else 1
+uint8_t vload_indexed_ordered(
+	void* pV, //!<[inout] Vector register field as local memory
+	uint8_t* pM, //!<[inout] Local memory
+	uint16_t pVTYPE, uint8_t  pVm, uint16_t pEEW, uint8_t  pVd, uint8_t pVs2, uint16_t pVSTART, uint16_t pVLEN, uint16_t pVL, uint64_t pMSTART);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Store indexed-unordered (vsuxei) source vector (-group) to memory. pEEW is the index width (8, 16, 32 or 64), data elements are SEW wide.
+/// Element i is stored to pMSTART plus the zero-extended element i of index vector (-group) pVs2. Elements are stored in element order.
+/// \return 0 if no exception triggered, else 1 (also for other index widths)
+uint8_t vstore_indexed_unordered(
+	void* pV, //!<[inout] Vector register field as local memory
+	uint8_t* pM, //!<[inout] Local memory
+	uint16_t pVTYPE, uint8_t pVm, uint16_t pEEW, uint8_t pVd, uint8_t pVs2, uint16_t pVSTART, uint16_t pVLEN, uint16_t pVL, uint64_t pMSTART);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Store indexed-ordered (vsoxei) source vector (-group) to memory, see vstore_indexed_unordered()
+/// \return 0 if no exception triggered, else 1
+uint8_t vstore_indexed_ordered(
+	void* pV, //!<[inout] Vector register field as local memory
+	uint8_t* pM, //!<[inout] Local memory
+	uint16_t pVTYPE, uint8_t pVm, uint16_t pEEW, uint8_t pVd, uint8_t pVs2, uint16_t pVSTART, uint16_t pVLEN, uint16_t pVL, uint64_t pMSTART);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Load indexed-unordered (vluxei) through pRead, see vload_indexed_unordered(). The ranges are sorted by address (elements of equal address keep
+/// their order) and elements adjacent in memory and register field are merged.
+/// \return 0 if no exception triggered, else 1
+uint8_t vload_ranges_indexed_unordered(
+	void* pV, //!<[inout] Vector register field as local memory
+	sv_mem_access pRead, //!<[in] Memory read access filling the ranges
+	void* pUser, //!<[inout] User context passed to pRead
+	uint16_t pVTYPE, uint8_t  pVm, uint16_t pEEW, uint8_t  pVd, uint8_t pVs2, uint16_t pVSTART, uint16_t pVLEN, uint16_t pVL, uint64_t pMSTART);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Load indexed-ordered (vloxei) through pRead, see vload_indexed_unordered(). The ranges are in element order, consecutive elements
+/// adjacent in memory are merged.
+/// \return 0 if no exception triggered, else 1
+uint8_t vload_ranges_indexed_ordered(
+	void* pV, //!<[inout] Vector register field as local memory
+	sv_mem_access pRead, //!<[in] Memory read access filling the ranges
+	void* pUser, //!<[inout] User context passed to pRead
+	uint16_t pVTYPE, uint8_t  pVm, uint16_t pEEW, uint8_t  pVd, uint8_t pVs2, uint16_t pVSTART, uint16_t pVLEN, uint16_t pVL, uint64_t pMSTART);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Store indexed-unordered (vsuxei) through pWrite, see vstore_indexed_unordered(). The ranges are sorted by address (elements of equal address keep
+/// their order, i.e. the last one is stored last) and elements adjacent in memory and register field are merged.
+/// \return 0 if no exception triggered, else 1
+uint8_t vstore_ranges_indexed_unordered(
+	void* pV, //!<[inout] Vector register field as local memory
+	sv_mem_access pWrite, //!<[in] Memory write access storing the ranges
+	void* pUser, //!<[inout] User context passed to pWrite
+	uint16_t pVTYPE, uint8_t pVm, uint16_t pEEW, uint8_t pVd, uint8_t pVs2, uint16_t pVSTART, uint16_t pVLEN, uint16_t pVL, uint64_t pMSTART);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Store indexed-ordered (vsoxei) through pWrite, see vstore_indexed_unordered(). The ranges are in element order, consecutive elements
+/// adjacent in memory are merged.
+/// \return 0 if no exception triggered, else 1
+uint8_t vstore_ranges_indexed_ordered(
+	void* pV, //!<[inout] Vector register field as local memory
+	sv_mem_access pWrite, //!<[in] Memory write access storing the ranges
+	void* pUser, //!<[inout] User context passed to pWrite
+	uint16_t pVTYPE, uint8_t pVm, uint16_t pEEW, uint8_t pVd, uint8_t pVs2, uint16_t pVSTART, uint16_t pVLEN, uint16_t pVL, uint64_t pMSTART);
+
 /* Vector Arithmetic Helpers*/
 //////////////////////////////////////////////////////////////////////////////////////
 /// \brief ADD vector-vector
@@ -768,6 +954,489 @@ uint8_t vmulhsu_vx(
 	void* pR, //!<[in] Integer/General Purpose register field
 	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVLEN, uint16_t pVL, uint8_t pXLEN);
 
+/* Vector Unit Context */
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Vector unit context, see sv_context_create()
+typedef struct sv_context sv_context;
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Create a vector unit context. Binds the register fields, VLEN and XLEN once. The sv_* functions take the
+/// context instead and reuse the register views built for the last vtype, i.e. views are rebuilt only when SEW or LMUL change.
+/// \return Context handle, NULL if out of memory. Release with sv_context_destroy()
+sv_context* sv_context_create(
+	void* pV, //!<[inout] Vector register field as local memory
+	void* pR, //!<[in] Integer/General Purpose register field. Only accessed by vector-scalar functions
+	uint16_t pVLEN, //!<[in] VLEN [bits]
+	uint8_t pXLEN //!<[in] XLEN [bits]
+);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Destroy a vector unit context. The register fields are not touched.
+void sv_context_destroy(
+	sv_context* ctx //!<[in] Vector unit context, may be NULL
+);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief ADD vector-vector. Context variant of vadd_vv()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vadd_vv(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief ADD vector-immediate. Context variant of vadd_vi()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vadd_vi(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pVimm, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief ADD vector-scalar. Context variant of vadd_vx()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vadd_vx(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief SUB vector-vector. Context variant of vsub_vv()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vsub_vv(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief SUB vector-scalar. Context variant of vsub_vx()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vsub_vx(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief AND vector-vector. Context variant of vand_vv()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vand_vv(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief AND vector-immediate. Context variant of vand_vi()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vand_vi(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pVimm, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief AND vector-scalar. Context variant of vand_vx()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vand_vx(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief OR vector-vector. Context variant of vor_vv()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vor_vv(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief OR vector-immediate. Context variant of vor_vi()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vor_vi(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pVimm, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief OR vector-scalar. Context variant of vor_vx()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vor_vx(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief XOR vector-vector. Context variant of vxor_vv()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vxor_vv(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief XOR vector-immediate. Context variant of vxor_vi()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vxor_vi(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pVimm, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief XOR vector-scalar. Context variant of vxor_vx()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vxor_vx(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief SLL vector-vector. Context variant of vsll_vv()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vsll_vv(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief SLL vector-immediate. Context variant of vsll_vi()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vsll_vi(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pVimm, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief SLL vector-scalar. Context variant of vsll_vx()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vsll_vx(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief SRL vector-vector. Context variant of vsrl_vv()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vsrl_vv(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief SRL vector-immediate. Context variant of vsrl_vi()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vsrl_vi(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pVimm, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief SRL vector-scalar. Context variant of vsrl_vx()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vsrl_vx(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief SRA vector-vector. Context variant of vsra_vv()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vsra_vv(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief SRA vector-immediate. Context variant of vsra_vi()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vsra_vi(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pVimm, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief SRA vector-scalar. Context variant of vsra_vx()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vsra_vx(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief MSEQ vector-vector. Context variant of vmseq_vv()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vmseq_vv(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief MSEQ vector-immediate. Context variant of vmseq_vi()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vmseq_vi(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pVimm, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief MSEQ vector-scalar. Context variant of vmseq_vx()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vmseq_vx(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief MSNE vector-vector (not equal). Context variant of vmsne_vv()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vmsne_vv(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief MSNE vector-immediate (not equal). Context variant of vmsne_vi()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vmsne_vi(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pVimm, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief MSNE vector-vector (not equal). Context variant of vmsne_vx()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vmsne_vx(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief MSLTU vector-vector (less than unsigned). Context variant of vmsltu_vv()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vmsltu_vv(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief MSLTU vector-scalar (less than unsigned). Context variant of vmsltu_vx()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vmsltu_vx(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief MSLT vector-vector (less than signed). Context variant of vmslt_vv()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vmslt_vv(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief MSLT vector-scalar (less than signed). Context variant of vmslt_vx()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vmslt_vx(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief MSLEU vector-vector (less than or equal unsigned). Context variant of vmsleu_vv()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vmsleu_vv(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief MSLEU vector-immediate (less than or equal unsigned). Context variant of vmsleu_vi()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vmsleu_vi(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pVimm, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief MSLEU vector-scalar (less than or equal unsigned). Context variant of vmsleu_vx()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vmsleu_vx(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief MSLE vector-vector (less than or equal signed). Context variant of vmsle_vv()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vmsle_vv(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief MSLE vector-immediate (less than or equal signed). Context variant of vmsle_vi()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vmsle_vi(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pVimm, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief MSLE vector-scalar (less than or equal signed). Context variant of vmsle_vx()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vmsle_vx(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief MSGTU vector-vector (greater than unsigned). Context variant of vmsgtu_vv()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vmsgtu_vv(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief MSGTU vector-scalar (greater than unsigned). Context variant of vmsgtu_vx()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vmsgtu_vx(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief MSGT vector-vector (greater than signed). Context variant of vmsgt_vv()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vmsgt_vv(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief MSGTU vector-scalar (greater than signed). Context variant of vmsgt_vx()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vmsgt_vx(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Move/Copy vector to vector. Context variant of vmv_vv()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vmv_vv(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVd, uint8_t pVs1, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Move scalar (signed immediate) to vector. Context variant of vmv_vi()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vmv_vi(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVd, uint8_t pVimm, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Move (signed) scalar register to vector. Context variant of vmv_vx()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vmv_vx(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVd, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief MUL vector-vector low bit of product. Context variant of vmul_vv()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vmul_vv(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief MUL vector-scalar low bit of product. Context variant of vmul_vx()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vmul_vx(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief MUL vector-vector high bit of product. Context variant of vmulh_vv()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vmulh_vv(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief MUL vector-scalar high bit of product. Context variant of vmulh_vx()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vmulh_vx(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief MUL unsigned-unsigned vector-vector high bit of product. Context variant of vmulhu_vv()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vmulhu_vv(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief MUL unsigned-unsigned vector-scalar high bit of product. Context variant of vmulhu_vx()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vmulhu_vx(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief MUL signed-unsigned vector-vector high bit of product. Context variant of vmulhsu_vv()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vmulhsu_vv(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief MUL signed-unsigned vector-scalar high bit of product. Context variant of vmulhsu_vx()
+/// \return 0 if no exception triggered, else 1
+uint8_t sv_vmulhsu_vx(
+	sv_context* ctx, //!<[inout] Vector unit context
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL);
+
+/* Instruction Descriptors */
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Opcodes of sv_insn, one per sv_* instruction function
+typedef enum sv_opcode {
+	SV_VADD_VV,
+	SV_VADD_VI,
+	SV_VADD_VX,
+	SV_VSUB_VV,
+	SV_VSUB_VX,
+	SV_VAND_VV,
+	SV_VAND_VI,
+	SV_VAND_VX,
+	SV_VOR_VV,
+	SV_VOR_VI,
+	SV_VOR_VX,
+	SV_VXOR_VV,
+	SV_VXOR_VI,
+	SV_VXOR_VX,
+	SV_VSLL_VV,
+	SV_VSLL_VI,
+	SV_VSLL_VX,
+	SV_VSRL_VV,
+	SV_VSRL_VI,
+	SV_VSRL_VX,
+	SV_VSRA_VV,
+	SV_VSRA_VI,
+	SV_VSRA_VX,
+	SV_VMSEQ_VV,
+	SV_VMSEQ_VI,
+	SV_VMSEQ_VX,
+	SV_VMSNE_VV,
+	SV_VMSNE_VI,
+	SV_VMSNE_VX,
+	SV_VMSLTU_VV,
+	SV_VMSLTU_VX,
+	SV_VMSLT_VV,
+	SV_VMSLT_VX,
+	SV_VMSLEU_VV,
+	SV_VMSLEU_VI,
+	SV_VMSLEU_VX,
+	SV_VMSLE_VV,
+	SV_VMSLE_VI,
+	SV_VMSLE_VX,
+	SV_VMSGTU_VV,
+	SV_VMSGTU_VX,
+	SV_VMSGT_VV,
+	SV_VMSGT_VX,
+	SV_VMV_VV,
+	SV_VMV_VI,
+	SV_VMV_VX,
+	SV_VMUL_VV,
+	SV_VMUL_VX,
+	SV_VMULH_VV,
+	SV_VMULH_VX,
+	SV_VMULHU_VV,
+	SV_VMULHU_VX,
+	SV_VMULHSU_VV,
+	SV_VMULHSU_VX,
+	SV_OPCODE_COUNT
+} sv_opcode;
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Instruction descriptor, see sv_execute(). Operands not used by an instruction are ignored.
+typedef struct sv_insn {
+	const sv_vtype* vtype; //!< Decoded vtype including the tail and mask policy, see vtype_config()
+	uint16_t opcode; //!< sv_opcode
+	uint16_t vstart; //!< Starting element [index]
+	uint16_t vl; //!< Vector length [elements]
+	uint8_t vm; //!< vm bit of the instruction. 0: masked by v0, 1: unmasked
+	uint8_t vd; //!< Destination vector register
+	uint8_t vs2; //!< Source vector register vs2
+	uint8_t src1; //!< vs1 (.vv), rs1 (.vx) or 5-bit immediate (.vi)
+} sv_insn;
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Execute an instruction descriptor through a table indexed by opcode. Same as calling the opcode's sv_* function.
+/// Descriptors can be built once, e.g. at translation time, and executed repeatedly.
+/// \return 0 if no exception triggered, else 1 (unknown opcode, vill set or misaligned register group)
+uint8_t sv_execute(
+	sv_context* ctx, //!<[inout] Vector unit context
+	const sv_insn* insn //!<[in] Instruction descriptor
+);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
@@ -0,0 +1,185 @@
+/*
+ * Copyright [2020] [Technical University of Munich]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+//////////////////////////////////////////////////////////////////////////////////////
+/// \file softvector-expr.hpp
+/// \brief Lazy element-wise expressions on SVector
+/// \date 10/16/2026
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SOFTVECTOR_EXPR_H__
+#define __SOFTVECTOR_EXPR_H__
+
+#include "stdint.h"
+#include <type_traits>
+
+#include "vpu/softvector-types.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Expression templates for SVector arithmetic. An operator on SVector operands
+/// does not compute anything, it returns an expression node holding its operands. The
+/// whole expression is evaluated element by element once it is assigned to a SVector,
+/// i.e. `vd = (va + vb) & vc` is a single loop writing straight into vd. Intermediate
+/// results live in stack SVElement temporaries.
+///
+/// Nodes reference their SVector operands. Assign or convert an expression to SVector
+/// within the full-expression it was built in, do not keep it in an `auto` variable
+/// beyond the lifetime of its operands.
+namespace SVEXPR {
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Leaf node, references a SVector
+class Leaf : public Expr<Leaf> {
+	const SVector& v_;
+public:
+	Leaf(const SVector& v) : v_(v) {}
+	size_t length(void) const { return(v_.length_); }
+	size_t width(void) const { return(v_.single_element_width_bits_); }
+	size_t start_reg_index(void) const { return(v_.start_reg_index_); }
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief Element i, referencing the vector's memory
+	SVElement at(const size_t i) const { return(v_[i]); }
+};
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Scalar node, right-hand-side value applied to every element
+template<typename T>
+class Scalar {
+	const T val_;
+public:
+	Scalar(const T val) : val_(val) {}
+	T at(const size_t) const { return(val_); }
+};
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Binary node. OP::apply(out, lhs, rhs) computes one element.
+template<typename OP, typename L, typename R>
+class Binary : public Expr<Binary<OP, L, R>> {
+	const L lhs_;
+	const R rhs_;
+public:
+	Binary(const L& lhs, const R& rhs) : lhs_(lhs), rhs_(rhs) {}
+	size_t length(void) const { return(lhs_.length()); }
+	size_t width(void) const { return(lhs_.width()); }
+	size_t start_reg_index(void) const { return(lhs_.start_reg_index()); }
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief Compute element i into out. out may reference memory of any operand element i.
+	void eval(SVElement& out, const size_t i) const {
+		OP::apply(out, lhs_.at(i), rhs_.at(i));
+	}
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief Element i as temporary, used if this node is an operand of another node
+	SVElement at(const size_t i) const {
+		SVElement ret(width());
+		eval(ret, i);
+		return(ret);
+	}
+};
+
+struct Add { template<typename R> static void apply(SVElement& out, const SVElement& l, const R& r) { out.s_add(l, r); } };
+struct Sub { template<typename R> static void apply(SVElement& out, const SVElement& l, const R& r) { out.s_sub(l, r); } };
+struct And { template<typename R> static void apply(SVElement& out, const SVElement& l, const R& r) { out.s_and(l, r); } };
+struct Or { template<typename R> static void apply(SVElement& out, const SVElement& l, const R& r) { out.s_or(l, r); } };
+struct Xor { template<typename R> static void apply(SVElement& out, const SVElement& l, const R& r) { out.s_xor(l, r); } };
+struct Sll { template<typename R> static void apply(SVElement& out, const SVElement& l, const R& r) { out.s_sll(l, r); } };
+struct Sra { template<typename R> static void apply(SVElement& out, const SVElement& l, const R& r) { out.s_sra(l, r); } };
+struct Srl { template<typename R> static void apply(SVElement& out, const SVElement& l, const R& r) { out.s_srl(l, r); } };
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief True for types that can be a vector operand, i.e. SVector (and derived) or expression nodes
+template<typename T>
+constexpr bool is_vector_v = std::is_base_of<SVector, T>::value || std::is_base_of<Expr<T>, T>::value;
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Node type for a vector operand
+template<typename T>
+using node_t = std::conditional_t<std::is_base_of<SVector, T>::value, Leaf, T>;
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Node type for a right-hand-side operand. Integral values become Scalar<S>.
+template<typename T, typename S>
+using rhs_node_t = std::conditional_t<std::is_integral<T>::value, Scalar<S>, node_t<T>>;
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Build a binary node
+template<typename OP, typename S, typename L, typename R>
+Binary<OP, node_t<L>, rhs_node_t<R, S>> make(const L& lhs, const R& rhs) {
+	return(Binary<OP, node_t<L>, rhs_node_t<R, S>>(node_t<L>(lhs), rhs_node_t<R, S>(rhs)));
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Enables the free operators for a vector lhs and a vector or integral rhs
+template<typename L, typename R>
+using enable_t = std::enable_if_t<is_vector_v<L> && (is_vector_v<R> || std::is_integral<R>::value), bool>;
+
+template<typename E>
+template<typename R>
+auto Expr<E>::srl(const R& rhs) const {
+	return(make<Srl, uint64_t>(self(), rhs));
+}
+
+} // namespace SVEXPR
+
+template<typename E>
+SVector::SVector(const SVEXPR::Expr<E>& expr)
+: SVector(expr.self().length(), expr.self().width(), expr.self().start_reg_index()) {
+	*this = expr;
+}
+
+template<typename E>
+SVector& SVector::operator=(const SVEXPR::Expr<E>& expr) {
+	const E& e = expr.self();
+	for(size_t i_element = 0; i_element < length_; ++i_element) {
+		SVElement out = (*this)[i_element];
+		e.eval(out, i_element);
+	}
+	return(*this);
+}
+
+template<typename R>
+auto SVector::srl(const R& rhs) const {
+	return(SVEXPR::make<SVEXPR::Srl, uint64_t>(*this, rhs));
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Element-wise ADD. An integral rhs is sign extended to element size
+template<typename L, typename R, SVEXPR::enable_t<L, R> = true>
+auto operator+(const L& lhs, const R& rhs) { return(SVEXPR::make<SVEXPR::Add, int64_t>(lhs, rhs)); }
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Element-wise SUB. An integral rhs is sign extended to element size
+template<typename L, typename R, SVEXPR::enable_t<L, R> = true>
+auto operator-(const L& lhs, const R& rhs) { return(SVEXPR::make<SVEXPR::Sub, int64_t>(lhs, rhs)); }
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Element-wise bit-wise AND. An integral rhs is sign extended to element size
+template<typename L, typename R, SVEXPR::enable_t<L, R> = true>
+auto operator&(const L& lhs, const R& rhs) { return(SVEXPR::make<SVEXPR::And, int64_t>(lhs, rhs)); }
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Element-wise bit-wise OR. An integral rhs is sign extended to element size
+template<typename L, typename R, SVEXPR::enable_t<L, R> = true>
+auto operator|(const L& lhs, const R& rhs) { return(SVEXPR::make<SVEXPR::Or, int64_t>(lhs, rhs)); }
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Element-wise bit-wise XOR. An integral rhs is sign extended to element size
+template<typename L, typename R, SVEXPR::enable_t<L, R> = true>
+auto operator^(const L& lhs, const R& rhs) { return(SVEXPR::make<SVEXPR::Xor, int64_t>(lhs, rhs)); }
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Element-wise SLL. An integral rhs is zero extended to element size
+template<typename L, typename R, SVEXPR::enable_t<L, R> = true>
+auto operator<<(const L& lhs, const R& rhs) { return(SVEXPR::make<SVEXPR::Sll, uint64_t>(lhs, rhs)); }
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Element-wise SRA. An integral rhs is zero extended to element size
+template<typename L, typename R, SVEXPR::enable_t<L, R> = true>
+auto operator>>(const L& lhs, const R& rhs) { return(SVEXPR::make<SVEXPR::Sra, uint64_t>(lhs, rhs)); }
+
+#endif /* __SOFTVECTOR_EXPR_H__ */
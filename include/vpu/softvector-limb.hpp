@@ -0,0 +1,337 @@
+/*
+ * Copyright [2020] [Technical University of Munich]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+//////////////////////////////////////////////////////////////////////////////////////
+/// \file softvector-limb.hpp
+/// \brief 64 bit limb arithmetic for wide elements (128 to 1024 bit)
+/// \date 10/16/2026
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SOFTVECTOR_LIMB_H__
+#define __SOFTVECTOR_LIMB_H__
+
+#include "stdint.h"
+#include <cstring>
+
+#include "vpu/softvector-native.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <x86intrin.h>
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Limb engine. Interprets element memory as little endian array of 64 bit limbs.
+/// Operand accessors (lhs, rhs) are callables returning limb i, see mem() and imm().
+/// Destination may alias any source.
+namespace SVLIMB {
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief True if width_in_bits is handled by the limb engine
+inline bool applicable(const size_t width_in_bits) {
+	return(SVNATIVE::enabled && (width_in_bits > 64) && !(width_in_bits % 64));
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Load limb i of element memory
+inline uint64_t load(const uint8_t* mem, const size_t i) {
+	return(SVNATIVE::load<uint64_t>(mem + 8*i));
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Store limb i of element memory
+inline void store(uint8_t* mem, const size_t i, const uint64_t val) {
+	SVNATIVE::store<uint64_t>(mem + 8*i, val);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Operand accessor for element memory
+inline auto mem(const uint8_t* mem) {
+	return([mem](size_t i) { return(load(mem, i)); });
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Operand accessor for a 64 bit value, sign or zero extended to element size
+inline auto imm(const int64_t val, const bool sign_extend = true) {
+	const uint64_t ext = (sign_extend && (val < 0)) ? ~0ULL : 0ULL;
+	return([val, ext](size_t i) { return(i ? ext : static_cast<uint64_t>(val)); });
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Add with carry. Returns carry out
+inline uint8_t addcarry(const uint8_t c, const uint64_t a, const uint64_t b, uint64_t* out) {
+#if defined(__x86_64__) || defined(_M_X64)
+	unsigned long long r;
+	const uint8_t ret = _addcarry_u64(c, a, b, &r);
+	*out = r;
+	return(ret);
+#else
+	const uint64_t s = a + b;
+	const uint64_t r = s + c;
+	*out = r;
+	return((s < a) | (r < s));
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Subtract with borrow. Returns borrow out
+inline uint8_t subborrow(const uint8_t c, const uint64_t a, const uint64_t b, uint64_t* out) {
+#if defined(__x86_64__) || defined(_M_X64)
+	unsigned long long r;
+	const uint8_t ret = _subborrow_u64(c, a, b, &r);
+	*out = r;
+	return(ret);
+#else
+	const uint64_t d = a - b;
+	const uint64_t r = d - c;
+	*out = r;
+	return((a < b) | (d < c));
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief dst = src over n limbs
+template<typename S>
+inline void assign(uint8_t* dst, S src, const size_t n) {
+	for(size_t i = 0; i < n; ++i) {
+		store(dst, i, src(i));
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief dst = lhs + rhs over n limbs
+template<typename L, typename R>
+inline void add(uint8_t* dst, L lhs, R rhs, const size_t n) {
+	uint8_t c = 0;
+	for(size_t i = 0; i < n; ++i) {
+		uint64_t r;
+		c = addcarry(c, lhs(i), rhs(i), &r);
+		store(dst, i, r);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief dst = lhs - rhs over n limbs
+template<typename L, typename R>
+inline void sub(uint8_t* dst, L lhs, R rhs, const size_t n) {
+	uint8_t c = 0;
+	for(size_t i = 0; i < n; ++i) {
+		uint64_t r;
+		c = subborrow(c, lhs(i), rhs(i), &r);
+		store(dst, i, r);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief dst = op(lhs, rhs) limb-wise, for bit-wise operations
+template<typename L, typename R, typename OP>
+inline void bitwise(uint8_t* dst, L lhs, R rhs, const size_t n, OP op) {
+	for(size_t i = 0; i < n; ++i) {
+		store(dst, i, op(lhs(i), rhs(i)));
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Unsigned compare, most significant limb first
+/// \return -1 if lhs < rhs, 0 if equal, 1 if lhs > rhs
+template<typename L, typename R>
+inline int cmp_u(L lhs, R rhs, const size_t n) {
+	for(size_t i = n; i-- > 0;) {
+		const uint64_t a = lhs(i);
+		const uint64_t b = rhs(i);
+		if(a != b) {
+			return((a < b) ? -1 : 1);
+		}
+	}
+	return(0);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Signed (two's complement) compare, most significant limb first
+/// \return -1 if lhs < rhs, 0 if equal, 1 if lhs > rhs
+template<typename L, typename R>
+inline int cmp_s(L lhs, R rhs, const size_t n) {
+	const int64_t a = static_cast<int64_t>(lhs(n-1));
+	const int64_t b = static_cast<int64_t>(rhs(n-1));
+	if(a != b) {
+		return((a < b) ? -1 : 1);
+	}
+	return(cmp_u(lhs, rhs, n-1));
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief dst = src << amount over n limbs. Amounts exceeding the element width yield zero.
+inline void shl(uint8_t* dst, const uint8_t* src, const size_t n, const size_t amount) {
+	const size_t limb_shift = amount / 64;
+	const unsigned bit_shift = amount % 64;
+	for(size_t i = n; i-- > 0;) {
+		uint64_t v = 0;
+		if(i >= limb_shift) {
+			const size_t j = i - limb_shift;
+			v = load(src, j) << bit_shift;
+			if(bit_shift && j) {
+				v |= load(src, j-1) >> (64 - bit_shift);
+			}
+		}
+		store(dst, i, v);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief dst = src >> amount over n limbs, logical or arithmetic. Amounts exceeding the element width yield zero (sign fill for arithmetic).
+inline void shr(uint8_t* dst, const uint8_t* src, const size_t n, const size_t amount, const bool arith) {
+	const uint64_t fill = (arith && (load(src, n-1) >> 63)) ? ~0ULL : 0ULL;
+	const size_t limb_shift = amount / 64;
+	const unsigned bit_shift = amount % 64;
+	for(size_t i = 0; i < n; ++i) {
+		const size_t j = i + limb_shift;
+		uint64_t v = fill;
+		if(j < n) {
+			const uint64_t hi = (j+1 < n) ? load(src, j+1) : fill;
+			v = load(src, j) >> bit_shift;
+			if(bit_shift) {
+				v |= hi << (64 - bit_shift);
+			}
+		}
+		store(dst, i, v);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Maximum number of limbs per element (SEW=1024)
+constexpr size_t max_limbs = 16;
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Smallest power of two limb count multiplied by Karatsuba (SEW=256). Smaller products use the schoolbook method.
+constexpr size_t karatsuba_limbs = 4;
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief 64x64 to 128 bit multiplication. Returns lower half, upper half is written to hi
+inline uint64_t mul64(const uint64_t a, const uint64_t b, uint64_t* hi) {
+#if defined(__SIZEOF_INT128__)
+	const unsigned __int128 p = static_cast<unsigned __int128>(a) * b;
+	*hi = static_cast<uint64_t>(p >> 64);
+	return(static_cast<uint64_t>(p));
+#else
+	const uint64_t a_lo = a & 0xFFFFFFFF, a_hi = a >> 32;
+	const uint64_t b_lo = b & 0xFFFFFFFF, b_hi = b >> 32;
+	const uint64_t ll = a_lo * b_lo, lh = a_lo * b_hi, hl = a_hi * b_lo, hh = a_hi * b_hi;
+	const uint64_t mid = (ll >> 32) + (lh & 0xFFFFFFFF) + (hl & 0xFFFFFFFF);
+	*hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+	return((mid << 32) | (ll & 0xFFFFFFFF));
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief dst = lhs + rhs on limb arrays. Returns carry out
+inline uint8_t add_n(uint64_t* dst, const uint64_t* lhs, const uint64_t* rhs, const size_t n) {
+	uint8_t c = 0;
+	for(size_t i = 0; i < n; ++i) {
+		c = addcarry(c, lhs[i], rhs[i], &dst[i]);
+	}
+	return(c);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief dst = lhs - rhs on limb arrays. Returns borrow out
+inline uint8_t sub_n(uint64_t* dst, const uint64_t* lhs, const uint64_t* rhs, const size_t n) {
+	uint8_t c = 0;
+	for(size_t i = 0; i < n; ++i) {
+		c = subborrow(c, lhs[i], rhs[i], &dst[i]);
+	}
+	return(c);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief out[0..2n) = a[0..n) * b[0..n), schoolbook method
+inline void mul_schoolbook(uint64_t* out, const uint64_t* a, const uint64_t* b, const size_t n) {
+	for(size_t i = 0; i < 2*n; ++i) {
+		out[i] = 0;
+	}
+	for(size_t i = 0; i < n; ++i) {
+		uint64_t carry = 0;
+		for(size_t j = 0; j < n; ++j) {
+			uint64_t hi;
+			uint64_t lo = mul64(a[i], b[j], &hi);
+			hi += addcarry(0, lo, out[i+j], &lo);
+			hi += addcarry(0, lo, carry, &lo);
+			out[i+j] = lo;
+			carry = hi;
+		}
+		out[i+n] = carry;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief out[0..2n) = a[0..n) * b[0..n), (subtractive) Karatsuba method. n has to be a power of two and not exceed max_limbs.
+inline void mul_karatsuba(uint64_t* out, const uint64_t* a, const uint64_t* b, const size_t n) {
+	if(n < karatsuba_limbs) {
+		mul_schoolbook(out, a, b, n);
+		return;
+	}
+	const size_t h = n/2;
+	uint64_t da[max_limbs/2], db[max_limbs/2], m[max_limbs], t[max_limbs];
+
+	// z0 = a0*b0 and z2 = a1*b1 directly into the result
+	mul_karatsuba(out, a, b, h);
+	mul_karatsuba(out + 2*h, a + h, b + h, h);
+
+	// m = |a0-a1| * |b1-b0|, a0*b1 + a1*b0 = z0 + z2 +/- m
+	bool neg = false;
+	if(sub_n(da, a, a + h, h)) {
+		sub_n(da, a + h, a, h);
+		neg = !neg;
+	}
+	if(sub_n(db, b + h, b, h)) {
+		sub_n(db, b, b + h, h);
+		neg = !neg;
+	}
+	mul_karatsuba(m, da, db, h);
+
+	uint64_t top = add_n(t, out, out + 2*h, 2*h);
+	if(neg) {
+		top -= sub_n(t, t, m, 2*h);
+	} else {
+		top += add_n(t, t, m, 2*h);
+	}
+
+	// out += (t + top*B^2h) * B^h
+	uint64_t carry = top + add_n(out + h, out + h, t, 2*h);
+	for(size_t i = 3*h; (i < 2*n) && carry; ++i) {
+		carry = addcarry(0, out[i], carry, &out[i]);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief lo, hi = lhs * rhs over n limbs, unsigned. Lower and upper n limbs of the full product are written to lo and hi respectively.
+inline void mul(uint8_t* lo, uint8_t* hi, const uint8_t* lhs, const uint8_t* rhs, const size_t n) {
+	uint64_t a[max_limbs], b[max_limbs], p[2*max_limbs];
+	for(size_t i = 0; i < n; ++i) {
+		a[i] = load(lhs, i);
+		b[i] = load(rhs, i);
+	}
+	if(!(n & (n-1))) {
+		mul_karatsuba(p, a, b, n);
+	} else {
+		mul_schoolbook(p, a, b, n);
+	}
+	for(size_t i = 0; i < n; ++i) {
+		store(lo, i, p[i]);
+		store(hi, i, p[n+i]);
+	}
+}
+
+} // namespace SVLIMB
+
+#endif /* __SOFTVECTOR_LIMB_H__ */
@@ -0,0 +1,141 @@
+/*
+ * Copyright [2020] [Technical University of Munich]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+//////////////////////////////////////////////////////////////////////////////////////
+/// \file softvector-native.hpp
+/// \brief Host native integer access for standard element widths (8, 16, 32, 64 bit)
+/// \date 10/16/2026
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SOFTVECTOR_NATIVE_H__
+#define __SOFTVECTOR_NATIVE_H__
+
+#include "stdint.h"
+#include <cstring>
+#include <type_traits>
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Native element access. Element memory is little endian, thus, native access is only enabled on little endian hosts.
+namespace SVNATIVE {
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+constexpr bool enabled = true;
+#else
+constexpr bool enabled = false;
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Load an unsigned native integer from (possibly unaligned) element memory
+template<typename T>
+inline T load(const uint8_t* mem) {
+	T ret;
+	std::memcpy(&ret, mem, sizeof(T));
+	return(ret);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Store an unsigned native integer to (possibly unaligned) element memory
+template<typename T>
+inline void store(uint8_t* mem, const T val) {
+	std::memcpy(mem, &val, sizeof(T));
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Count trailing zeros, i.e. index of the least significant set bit. val must not be zero.
+inline unsigned ctz(const uint64_t val) {
+#if defined(__GNUC__)
+	return(__builtin_ctzll(val));
+#else
+	unsigned ret = 0;
+	while(!((val >> ret) & 1)) {
+		++ret;
+	}
+	return(ret);
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Number of set bits. Bit-parallel, the builtin is a library call for generic x86-64 targets.
+inline unsigned popcount(uint64_t val) {
+	val = val - ((val >> 1) & 0x5555555555555555ULL);
+	val = (val & 0x3333333333333333ULL) + ((val >> 2) & 0x3333333333333333ULL);
+	val = (val + (val >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+	return(static_cast<unsigned>((val * 0x0101010101010101ULL) >> 56));
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Signed counterpart of native type T
+template<typename T>
+using signed_t = typename std::make_signed<T>::type;
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Calls op with a value of the unsigned native type matching width_in_bits.
+/// \return True if op was called, false if there is no native type for width_in_bits. Caller has to fall back to byte-wise processing then.
+template<typename OP>
+inline bool dispatch(const size_t width_in_bits, OP&& op) {
+	if(!enabled) {
+		return(false);
+	}
+	switch(width_in_bits) {
+	case 8: op(uint8_t(0)); return(true);
+	case 16: op(uint16_t(0)); return(true);
+	case 32: op(uint32_t(0)); return(true);
+	case 64: op(uint64_t(0)); return(true);
+	default: return(false);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Upper half of the 128 bit product, unsigned*unsigned
+inline uint64_t mulh_uu(const uint64_t a, const uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+	return(static_cast<uint64_t>((static_cast<unsigned __int128>(a) * b) >> 64));
+#else
+	const uint64_t a_lo = a & 0xFFFFFFFF, a_hi = a >> 32;
+	const uint64_t b_lo = b & 0xFFFFFFFF, b_hi = b >> 32;
+	const uint64_t lh = a_lo * b_hi, hl = a_hi * b_lo;
+	const uint64_t mid = ((a_lo * b_lo) >> 32) + (lh & 0xFFFFFFFF) + (hl & 0xFFFFFFFF);
+	return(a_hi * b_hi + (lh >> 32) + (hl >> 32) + (mid >> 32));
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Upper half of the 128 bit product, signed*signed
+inline int64_t mulh_ss(const int64_t a, const int64_t b) {
+#if defined(__SIZEOF_INT128__)
+	return(static_cast<int64_t>((static_cast<__int128>(a) * b) >> 64));
+#else
+	uint64_t hi = mulh_uu(static_cast<uint64_t>(a), static_cast<uint64_t>(b));
+	if(a < 0) hi -= static_cast<uint64_t>(b);
+	if(b < 0) hi -= static_cast<uint64_t>(a);
+	return(static_cast<int64_t>(hi));
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Upper half of the 128 bit product, signed*unsigned
+inline int64_t mulh_su(const int64_t a, const uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+	return(static_cast<int64_t>((static_cast<__int128>(a) * static_cast<__int128>(b)) >> 64));
+#else
+	uint64_t hi = mulh_uu(static_cast<uint64_t>(a), b);
+	if(a < 0) hi -= b;
+	return(static_cast<int64_t>(hi));
+#endif
+}
+
+} // namespace SVNATIVE
+
+#endif /* __SOFTVECTOR_NATIVE_H__ */
@@ -0,0 +1,146 @@
+/*
+ * Copyright [2020] [Technical University of Munich]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+//////////////////////////////////////////////////////////////////////////////////////
+/// \file softvector-simd.hpp
+/// \brief SIMD kernels for lane-wise integer operations over contiguous elements
+/// \date 10/16/2026
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __SOFTVECTOR_SIMD_H__
+#define __SOFTVECTOR_SIMD_H__
+
+#include "stdint.h"
+#include <cstddef>
+
+#include "vpu/softvector-native.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief SIMD kernels. Process a whole span of n elements of SEW 8, 16, 32 or 64 bits in
+/// vector sized chunks, i.e. plain lane-wise operations. Destination may alias a source.
+/// Callers fall back to the element-wise loop if a kernel returns false.
+///
+/// The library is built for a generic target. The kernels are compiled once per instruction
+/// set tier (see TIER) and the best tier supported by the host CPU is selected at first use.
+/// The environment variable SOFTVECTOR_SIMD=scalar|v128|sse4.2|avx2|avx512 caps the tier,
+/// e.g. for A/B benchmarking. Tiers not supported by the host are never selected.
+///
+/// Compares (see compare()) assemble 64 result bits per mask word from vector compares.
+/// Segment loads and stores are transposed by vector shuffles, see deinterleave().
+///
+/// Masked operations are either executed as masked blend (dense masks) or left to the
+/// element-wise loop, which iterates active elements only (sparse masks), see blend_density().
+namespace SVSIMD {
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Lane-wise operations. Shift amounts are taken modulo SEW, MUL is the lower half of the product.
+enum class OP { ADD, SUB, AND, OR, XOR, SLL, SRL, SRA, MUL, COUNT };
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Integer comparisons, signed unless suffixed with U
+enum class CMP { EQ, NE, LTU, LEU, GTU, GEU, LT, LE, GT, GE, COUNT };
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Unmasked kernel: dst = lhs op rhs over bytes, rhs is memory (rhs_mem) or the broadcast scalar rhs_val (rhs_mem == nullptr)
+typedef void (*kernel_t)(uint8_t* dst, const uint8_t* lhs, const uint8_t* rhs_mem, const uint64_t rhs_val, const size_t bytes);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Compare kernel, see compare() for the parameters
+typedef void (*compare_kernel_t)(uint8_t* vd, const uint8_t* lhs, const uint8_t* rhs_mem, const uint64_t rhs_val, const uint8_t* mask, const size_t start_index, const size_t n_elements);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Instruction set tiers, ascending
+enum class TIER {
+	SCALAR, //!< No kernels, element-wise processing
+	V128, //!< 128 bit vectors. SSE4.2 on x86, the baseline vector extension (e.g. NEON) elsewhere
+	AVX2, //!< 256 bit vectors, x86 only
+	AVX512 //!< 512 bit vectors (AVX-512F/BW), x86 only
+};
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief The tier in use. Selected once, at first call.
+TIER tier(void);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Printable name of a tier, matching the values accepted by SOFTVECTOR_SIMD
+const char* tier_name(const TIER t);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Minimum share of active elements, in percent, for which masked operations are executed as masked blend.
+/// Sparser masks are left to the element-wise loop, which only visits active elements. Set by SOFTVECTOR_BLEND_DENSITY, defaults to 3.
+unsigned blend_density(void);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief dst = lhs op rhs for elements [start_index, n_elements) of width_in_bits, processed as lanes of lane_bits.
+/// rhs is either memory (rhs_mem) or the scalar rhs_val broadcast to all lanes (rhs_mem == nullptr).
+/// If mask is given, only elements whose mask bit is set are written: every lane of a chunk is computed and blended into dst with the mask expanded to lane masks.
+/// With fill_ones, masked-off elements of [start_index, n_elements) are written all ones instead (mask-agnostic policy), regardless of the mask density.
+/// \return False if not handled, i.e. for the scalar tier, if lane_bits has no native type, if a masked element spans several lanes or if the mask is sparser than blend_density()
+bool run(const OP op, const size_t width_in_bits, const size_t lane_bits, uint8_t* dst, const uint8_t* lhs, const uint8_t* rhs_mem, const uint64_t rhs_val, const size_t n_elements, const uint8_t* mask, const size_t start_index, const bool fill_ones);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief dst = lhs op rhs for elements [start_index, n_elements) of width_in_bits, all operands vectors. mask is nullptr for unmasked operations, see run() for fill_ones.
+/// \return False if not handled. Unmasked bit-wise operations are handled for any width.
+template<OP op>
+inline bool vv(const size_t width_in_bits, uint8_t* dst, const uint8_t* lhs, const uint8_t* rhs, const size_t n_elements, const uint8_t* mask, const size_t start_index, const bool fill_ones) {
+	size_t lane_bits = width_in_bits;
+	if((op == OP::AND) || (op == OP::OR) || (op == OP::XOR)) {
+		lane_bits = (width_in_bits % 64) ? 8 : 64;
+		lane_bits = (mask && (width_in_bits <= 64)) ? width_in_bits : lane_bits;
+	}
+	return(run(op, width_in_bits, lane_bits, dst, lhs, rhs, 0, n_elements, mask, start_index, fill_ones));
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief dst = lhs op rhs for elements [start_index, n_elements) of width_in_bits, rhs is a scalar truncated to width_in_bits. mask is nullptr for unmasked operations, see run() for fill_ones.
+/// \return False if not handled, e.g. width_in_bits above 64
+template<OP op>
+inline bool vx(const size_t width_in_bits, uint8_t* dst, const uint8_t* lhs, const uint64_t rhs, const size_t n_elements, const uint8_t* mask, const size_t start_index, const bool fill_ones) {
+	return(run(op, width_in_bits, width_in_bits, dst, lhs, nullptr, rhs, n_elements, mask, start_index, fill_ones));
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Bit i of vd = lhs[i] op rhs[i] for elements [start_index, n_elements) of width_in_bits.
+/// rhs is either memory (rhs_mem) or the scalar rhs_val truncated to width_in_bits (rhs_mem == nullptr).
+/// Results are packed to 64 bit words and merged into vd a word at a time: only bits of active elements (mask bit set, all if mask is nullptr) are written.
+/// The mask word is read before the vd word is written, i.e. vd may be mask. vd may overlap the lowest part of a source.
+/// \return False if not handled, i.e. for the scalar tier or widths other than 8, 16, 32 and 64 bits
+bool compare(const CMP op, const size_t width_in_bits, uint8_t* vd, const uint8_t* lhs, const uint8_t* rhs_mem, const uint64_t rhs_val, const size_t n_elements, const uint8_t* mask, const size_t start_index);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Segment transpose (array of structures to structure of arrays): field f of segment i, at mem + (i*nf + f)*width_in_bits/8, is copied to element i of fields[f].
+/// Segments are de-interleaved by vector shuffles, a vector of segments at a time. fields must not overlap mem.
+/// \return False if not handled, i.e. for the scalar tier, nf outside of 2..8 or widths other than 8, 16, 32 and 64 bits
+bool deinterleave(const size_t nf, const size_t width_in_bits, uint8_t* const* fields, const uint8_t* mem, const size_t n_segments);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Inverse of deinterleave(): element i of fields[f] is copied to field f of segment i at mem
+/// \return False if not handled, see deinterleave()
+bool interleave(const size_t nf, const size_t width_in_bits, uint8_t* mem, const uint8_t* const* fields, const size_t n_segments);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Unmasked kernel of the selected tier for op on lanes of lane_bits, e.g. to be resolved once and called repeatedly.
+/// Calling it with the element range of run() is equivalent to run() without mask.
+/// \return nullptr if there is none, see run()
+kernel_t kernel(const OP op, const size_t lane_bits);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Compare kernel of the selected tier for op on elements of width_in_bits. Must not be called for start_index >= n_elements.
+/// \return nullptr if there is none, see compare()
+compare_kernel_t compare_kernel(const CMP op, const size_t width_in_bits);
+
+} // namespace SVSIMD
+
+#endif /* __SOFTVECTOR_SIMD_H__ */
@@ -27,6 +27,8 @@
 #include <array>
 #include <cstring>
 
+#include "vpu/softvector-native.hpp"
+
 class SVector;
 
 //////////////////////////////////////////////////////////////////////////////////////
@@ -49,9 +51,12 @@ public:
 	/// \brief Set the value of a single bit
 	void set_bit(
 		size_t bit_index, //!< Index (bit number) of the target bit
-		bool val = true
+		bool val = true //!< Value to write
 	) {
-		mem_[bit_index/8] |= (1 << (bit_index % 8));
+		if(val)
+			mem_[bit_index/8] |= (1 << (bit_index % 8));
+		else
+			mem_[bit_index/8] &= ~(1 << (bit_index % 8));
 	}
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Reset the value of a single bit
@@ -68,6 +73,119 @@ public:
 		mem_[bit_index/8] ^= (1 << (bit_index % 8));
 	}
 
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief Bits [64*i_word, 64*i_word + 64) as one word, bit i of the word is bit 64*i_word + i.
+	/// Only bytes below (end_index + 7)/8 are read, bits of bytes beyond read as zero.
+	uint64_t get_word(const size_t i_word, const size_t end_index) const {
+		const size_t n_bytes = (end_index + 7)/8;
+		uint64_t ret = 0;
+		for(size_t i_byte = 8*i_word; (i_byte < 8*i_word + 8) && (i_byte < n_bytes); ++i_byte) {
+			ret |= static_cast<uint64_t>(mem_[i_byte]) << 8*(i_byte % 8);
+		}
+		return(ret);
+	}
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief Active elements of [start_index, end_index) within word i_word (see get_word()), as bit mask.
+	/// Without mask all elements are active, else elements whose bit is set in this register.
+	uint64_t active_word(const size_t i_word, const size_t start_index, const size_t end_index, const bool mask) const {
+		const size_t first = 64*i_word;
+		uint64_t ret = (end_index <= first) ? 0 : ((end_index - first < 64) ? ((1ULL << (end_index - first)) - 1) : ~0ULL);
+		ret &= (start_index <= first) ? ~0ULL : ((start_index - first < 64) ? (~0ULL << (start_index - first)) : 0);
+		return(mask ? (ret & get_word(i_word, end_index)) : ret);
+	}
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief Writes the bits of val selected by write to word i_word (see get_word()), other bits are left undisturbed.
+	/// write must not select bits at or beyond end_index.
+	void merge_word(const size_t i_word, const uint64_t val, const uint64_t write, const size_t end_index) {
+		const size_t n_bytes = (end_index + 7)/8;
+		for(size_t i_byte = 8*i_word; (i_byte < 8*i_word + 8) && (i_byte < n_bytes); ++i_byte) {
+			const uint8_t w = write >> 8*(i_byte % 8);
+			mem_[i_byte] = (mem_[i_byte] & ~w) | (static_cast<uint8_t>(val >> 8*(i_byte % 8)) & w);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief Calls f(i) for every active element index i in [start_index, end_index), ascending.
+	/// Without mask all elements are active, else elements whose bit is set in this register.
+	/// The mask is read 64 bits at a time, zero words are skipped and set bits are located with count-trailing-zeros.
+	/// A word is read before its elements are visited, i.e. f may write bit i of this register (e.g. compares into v0) without affecting the iteration.
+	template<typename F>
+	void for_each_active(const size_t start_index, const size_t end_index, const bool mask, F&& f) const {
+		if(!mask) {
+			for(size_t i_element = start_index; i_element < end_index; ++i_element) {
+				f(i_element);
+			}
+			return;
+		}
+		for(size_t i_word = start_index/64; i_word*64 < end_index; ++i_word) {
+			for(uint64_t word = active_word(i_word, start_index, end_index, true); word; word &= word - 1) {
+				f(64*i_word + SVNATIVE::ctz(word));
+			}
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief Index of the first active element in [start_index, end_index), end_index if there is none. Without mask all elements are active.
+	size_t find_active(const size_t start_index, const size_t end_index, const bool mask) const {
+		if(!mask) {
+			return((start_index < end_index) ? start_index : end_index);
+		}
+		for(size_t i_word = start_index/64; i_word*64 < end_index; ++i_word) {
+			const uint64_t word = active_word(i_word, start_index, end_index, true);
+			if(word) {
+				return(64*i_word + SVNATIVE::ctz(word));
+			}
+		}
+		return(end_index);
+	}
+
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief Calls f(i, n) for every maximal run of n consecutive active elements [i, i+n) in [start_index, end_index), ascending.
+	/// Without mask the whole range is a single run. With mask, runs are located as in for_each_run().
+	/// A run is visited once the word following it has been read, i.e. f must not write this register.
+	template<typename F>
+	void for_each_active_run(const size_t start_index, const size_t end_index, const bool mask, F&& f) const {
+		if(!mask) {
+			if(start_index < end_index) {
+				f(start_index, end_index - start_index);
+			}
+			return;
+		}
+		for_each_run(start_index, end_index, true, f);
+	}
+
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief Calls f(i, n) for every maximal run of n consecutive bits [i, i+n) in [start_index, end_index) equal to val, ascending.
+	/// Runs are located a word at a time with count-trailing-zeros and continue across mask words.
+	/// A run is visited once the word following it has been read, i.e. f must not write this register.
+	template<typename F>
+	void for_each_run(const size_t start_index, const size_t end_index, const bool val, F&& f) const {
+		size_t run_start = 0;
+		size_t run_length = 0;
+		for(size_t i_word = start_index/64; i_word*64 < end_index; ++i_word) {
+			const uint64_t bits = get_word(i_word, end_index);
+			uint64_t word = active_word(i_word, start_index, end_index, false) & (val ? bits : ~bits);
+			while(word) {
+				const size_t i_bit = SVNATIVE::ctz(word);
+				const uint64_t gaps = ~(word >> i_bit);
+				const size_t length = gaps ? SVNATIVE::ctz(gaps) : 64 - i_bit;
+				if(run_length && (run_start + run_length == 64*i_word + i_bit)) {
+					run_length += length;
+				} else {
+					if(run_length) {
+						f(run_start, run_length);
+					}
+					run_start = 64*i_word + i_bit;
+					run_length = length;
+				}
+				word = (i_bit + length < 64) ? (word & (~static_cast<uint64_t>(0) << (i_bit + length))) : 0;
+			}
+		}
+		if(run_length) {
+			f(run_start, run_length);
+		}
+	}
+
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Masked assignment. Updates bits in main memory with input register only where mask register is true
 	void m_assign(
@@ -243,8 +361,18 @@ public:
 class SVElement {
 	bool reference_mem_{true}; //!< If true the memory is allocated somewhere at a different context. Else SVElement allocates itself.
 public:
+	static constexpr size_t inline_bytes = 64; //!< Internal memory up to this size (SEW=512) is held inline, i.e. without heap allocation. Wider elements are heap allocated.
 	const size_t width_in_bits_; //!< Element size (width) in bits
 	uint8_t* mem_; //!< Main memory
+private:
+	uint8_t inline_mem_[inline_bytes]; //!< Inline storage for internal memory. Unused for referenced memory.
+
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief Provide internal memory of width_in_bits. Inline if it fits, heap allocated otherwise.
+	uint8_t* alloc_mem(const size_t width_in_bits) {
+		return((width_in_bits/8 <= inline_bytes) ? inline_mem_ : new uint8_t[width_in_bits/8]);
+	}
+public:
 
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Overloaded array subscript to return the indexed byte of memory as reference
@@ -385,6 +513,10 @@ public:
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Operation unsigned GREATER THAN OR EQUAL for right-hand-side 64 bit value. rhs is zero extended to element size
 	bool op_u_gte(const uint64_t rhs) const;
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief Three-way compare of two element memories of width_in_bits, signed (two's complement) or unsigned.
+	/// \return -1 if lhs < rhs, 0 if equal, 1 if lhs > rhs
+	static int compare(const size_t width_in_bits, const uint8_t* lhs, const uint8_t* rhs, const bool is_signed);
 
 	// (self assign) operations
 	//////////////////////////////////////////////////////////////////////////////////////
@@ -499,7 +631,7 @@ public:
 	SVElement(const size_t width_in_bits)
 	: reference_mem_(false)
 	, width_in_bits_(width_in_bits)
-	, mem_(new uint8_t[width_in_bits/8]) {
+	, mem_(alloc_mem(width_in_bits)) {
 		std::memset(mem_, 0, width_in_bits/8);
 	}
 	//////////////////////////////////////////////////////////////////////////////////////
@@ -507,90 +639,80 @@ public:
 	SVElement(const SVElement& other)
 	: reference_mem_(false)
 	, width_in_bits_(other.width_in_bits_)
-	, mem_(new uint8_t[other.width_in_bits_/8]) {
-		for (size_t i_byte = 0; i_byte < width_in_bits_/8; ++i_byte) {
-			(*this)[i_byte] = other[i_byte];
-		}
+	, mem_(alloc_mem(other.width_in_bits_)) {
+		std::memcpy(mem_, other.mem_, width_in_bits_/8);
 	}
 
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Destructor. Deallocates internal memory if generated.
 	virtual ~SVElement(void) {
-		if (!reference_mem_ && mem_) {
+		if (!reference_mem_ && mem_ && (mem_ != inline_mem_)) {
 			delete[] mem_;
 		}
 	}
 };
 
+//////////////////////////////////////////////////////////////////////////////////////
+/// \class SVPolicy
+/// \brief Treatment of agnostic destination elements, i.e. tail elements and masked-off elements of an operation.
+/// Agnostic elements are written all ones, all other elements are left undisturbed. Default constructed: everything undisturbed.
+class SVPolicy {
+public:
+	size_t tail_end_{0}; //!< Tail elements [length_, tail_end_) of the destination are agnostic. 0: undisturbed tail
+	bool mask_agnostic_{false}; //!< Masked-off elements are agnostic
+
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief True if agnostic policies are exploited, i.e. SOFTVECTOR_AGNOSTIC=ones. Else (default) agnostic policies of instructions are ignored and handled as undisturbed.
+	static bool enabled(void);
+};
+
+namespace SVEXPR {
+//////////////////////////////////////////////////////////////////////////////////////
+/// \class Expr
+/// \brief Base of all SVector expression nodes (CRTP). See softvector-expr.hpp
+template<typename E>
+class Expr {
+public:
+	const E& self(void) const { return(static_cast<const E&>(*this)); }
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief SRL for right-hand-side SVector, expression or 64 bit value (zero extended to element size)
+	template<typename R>
+	auto srl(const R& rhs) const;
+};
+} // namespace SVEXPR
+
 //////////////////////////////////////////////////////////////////////////////////////
 /// \class SVector
-/// \brief Softvector (SV) Vector. Vector length in multiples SVElement. Implements arithmetic on top
+/// \brief Softvector (SV) Vector. Vector length in multiples SVElement. Implements arithmetic on top.
+/// Elements are stored contiguously, i.e. element i starts at mem_ + i*SEW/8. Elements are not stored as objects, but as views onto the memory on access.
 class SVector {
 	bool reference_mem_{true}; //!< If true the memory is allocated somewhere at a different context. Else SVector allocates itself.
 public:
-	std::vector<SVElement*> elements_; //!< Elements (main memory)
-	const size_t length_; //!< Vector length in elements
+	uint8_t* mem_; //!< Main memory, start address of the first element
+	const size_t single_element_width_bits_; //!< SEW, single element width in bits
+	size_t length_; //!< Vector length in elements. Mutable for views, see RVVRegField::set_vector_length()
 	const size_t start_reg_index_; //!< If build upon a SVRegister, this holds the register number
 
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Assignment. All elements before start_index are not updated
 	void assign(const SVector& vin, size_t start_index = 0);
 	//////////////////////////////////////////////////////////////////////////////////////
-	/// \brief Overloaded array subscript to return the indexed SVElement as reference
-	virtual SVElement& operator[](const size_t index) const {
-		return(*(elements_[index]));
+	/// \brief Overloaded array subscript to return a SVElement referencing the indexed element's memory
+	SVElement operator[](const size_t index) const {
+		return(SVElement(single_element_width_bits_, mem_ + index*(single_element_width_bits_/8)));
 	}
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Overloaded array subscript to return the indexed element as reference
 	SVector& operator=(const SVector& rhs);
 	//////////////////////////////////////////////////////////////////////////////////////
-	/// \brief Overloaded ADD for right-hand-side SVector
-	SVector operator+(const SVector& rhs) const;
-	//////////////////////////////////////////////////////////////////////////////////////
-	/// \brief Overloaded ADD for right-hand-side signed 64 bit value. rhs is sign extended to element size
-	SVector operator+(const int64_t rhs) const;
-	//////////////////////////////////////////////////////////////////////////////////////
-	/// \brief Overloaded SUB for right-hand-side SVector
-	SVector operator-(const SVector& rhs) const;
-	//////////////////////////////////////////////////////////////////////////////////////
-	/// \brief Overloaded SUB for right-hand-side signed 64 bit value. rhs is sign extended to element size
-	SVector operator-(const int64_t rhs) const;
-	//////////////////////////////////////////////////////////////////////////////////////
-	/// \brief Overloaded bit-wise AND for right-hand-side SVector
-	SVector operator&(const SVector& rhs) const;
-	//////////////////////////////////////////////////////////////////////////////////////
-	/// \brief Overloaded bit-wise AND for right-hand-side signed 64 bit value. rhs is sign extended to element size
-	SVector operator&(const int64_t rhs) const;
-	//////////////////////////////////////////////////////////////////////////////////////
-	/// \brief Overloaded bit-wise OR for right-hand-side SVector
-	SVector operator|(const SVector& rhs) const;
-	//////////////////////////////////////////////////////////////////////////////////////
-	/// \brief Overloaded bit-wise OR for right-hand-side signed 64 bit value. rhs is sign extended to element size
-	SVector operator|(const int64_t rhs) const;
-	//////////////////////////////////////////////////////////////////////////////////////
-	/// \brief Overloaded bit-wise XOR for right-hand-side SVector
-	SVector operator^(const SVector& rhs) const;
-	//////////////////////////////////////////////////////////////////////////////////////
-	/// \brief Overloaded bit-wise XOR for right-hand-side signed 64 bit value. rhs is sign extended to element size
-	SVector operator^(const int64_t rhs) const;
-	//////////////////////////////////////////////////////////////////////////////////////
-	/// \brief Overloaded SLL/SLA for right-hand-side SVector
-	SVector operator<<(const SVector& rhs) const;
+	/// \brief Fused assignment of an element-wise expression, e.g. `vd = (va + vb) & vc`. Evaluated in a single pass over the elements.
+	/// The arithmetic operators (+, -, &, |, ^, <<, >>) are free operators returning expressions, see softvector-expr.hpp
+	template<typename E>
+	SVector& operator=(const SVEXPR::Expr<E>& expr);
 	//////////////////////////////////////////////////////////////////////////////////////
-	/// \brief Overloaded SLL/SLA for right-hand-side signed 64 bit value. rhs is zero extended to element size
-	SVector operator<<(const uint64_t rhs) const;
-	//////////////////////////////////////////////////////////////////////////////////////
-	/// \brief Overloaded SRA for right-hand-side SVector
-	SVector operator>>(const SVector& rhs) const;
-	//////////////////////////////////////////////////////////////////////////////////////
-	/// \brief Overloaded SRA for right-hand-side signed 64 bit value. rhs is zero extended to element size
-	SVector operator>>(const uint64_t rhs) const;
-	//////////////////////////////////////////////////////////////////////////////////////
-	/// \brief Overloaded SRL for right-hand-side SVector
-	SVector srl(const SVector& rhs) const;
-	//////////////////////////////////////////////////////////////////////////////////////
-	/// \brief Overloaded SRL for right-hand-side signed 64 bit value. rhs is zero extended to element size
-	SVector srl(const uint64_t rhs) const;
+	/// \brief SRL for right-hand-side SVector, expression or 64 bit value (zero extended to element size). Returns an expression.
+	template<typename R>
+	auto srl(const R& rhs) const;
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Overloaded EQUAL for right-hand-side SVector.
 	/// \return A SVRegister, which each bit holds the on-element logic comparison's result. I.e. LSB for element index 0
@@ -688,16 +810,16 @@ public:
 
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Masked ADD for right-hand-side SVector
-	SVector& m_add(const SVector& opL, const SVector& rhs, const SVRegister& vm, bool mask, size_t start_index = 0);
+	SVector& m_add(const SVector& opL, const SVector& rhs, const SVRegister& vm, bool mask, size_t start_index = 0, const SVPolicy& policy = SVPolicy());
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Masked ADD for right-hand-side signed 64 bit value. rhs is sign extended to element size
-	SVector& m_add(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index = 0);
+	SVector& m_add(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index = 0, const SVPolicy& policy = SVPolicy());
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Masked SUB for right-hand-side SVector
-	SVector& m_sub(const SVector& opL, const SVector& rhs, const SVRegister& vm, bool mask, size_t start_index = 0);
+	SVector& m_sub(const SVector& opL, const SVector& rhs, const SVRegister& vm, bool mask, size_t start_index = 0, const SVPolicy& policy = SVPolicy());
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Masked SUB for right-hand-side signed 64 bit value. rhs is sign extended to element size
-	SVector& m_sub(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index = 0);
+	SVector& m_sub(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index = 0, const SVPolicy& policy = SVPolicy());
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Masked Reverse-SUB for right-hand-side signed 64 bit value. rhs is sign extended to element size
 	SVector& m_rsub( const int64_t lhs, const SVector& opR, const SVRegister& vm, bool mask, size_t start_index = 0);
@@ -727,40 +849,40 @@ public:
 	SVector& m_wsub(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index = 0);
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Masked bit-wise AND for right-hand-side SVector
-	SVector& m_and(const SVector& opL, const SVector& rhs, const SVRegister& vm, bool mask, size_t start_index = 0);
+	SVector& m_and(const SVector& opL, const SVector& rhs, const SVRegister& vm, bool mask, size_t start_index = 0, const SVPolicy& policy = SVPolicy());
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Masked bit-wise AND for right-hand-side signed 64 bit value. rhs is sign extended to element size
-	SVector& m_and(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index = 0);
+	SVector& m_and(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index = 0, const SVPolicy& policy = SVPolicy());
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Masked bit-wise OR for right-hand-side SVector
-	SVector& m_or(const SVector& opL, const SVector& rhs, const SVRegister& vm, bool mask, size_t start_index = 0);
+	SVector& m_or(const SVector& opL, const SVector& rhs, const SVRegister& vm, bool mask, size_t start_index = 0, const SVPolicy& policy = SVPolicy());
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Masked bit-wise OR for right-hand-side signed 64 bit value. rhs is sign extended to element size
-	SVector& m_or(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index = 0);
+	SVector& m_or(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index = 0, const SVPolicy& policy = SVPolicy());
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Masked bit-wise XOR for right-hand-side SVector
-	SVector& m_xor(const SVector& opL, const SVector& rhs, const SVRegister& vm, bool mask, size_t start_index = 0);
+	SVector& m_xor(const SVector& opL, const SVector& rhs, const SVRegister& vm, bool mask, size_t start_index = 0, const SVPolicy& policy = SVPolicy());
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Masked bit-wise XOR for right-hand-side signed 64 bit value. rhs is sign extended to element size
-	SVector& m_xor(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index = 0);
+	SVector& m_xor(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index = 0, const SVPolicy& policy = SVPolicy());
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Masked SLL/SLA for right-hand-side SVector
-	SVector& m_sll(const SVector& opL, const SVector& rhs, const SVRegister& vm, bool mask, size_t start_index = 0);
+	SVector& m_sll(const SVector& opL, const SVector& rhs, const SVRegister& vm, bool mask, size_t start_index = 0, const SVPolicy& policy = SVPolicy());
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Masked SLL/SLA for right-hand-side signed 64 bit value. rhs is zero extended to element size
-	SVector& m_sll(const SVector& opL, const uint64_t rhs, const SVRegister& vm, bool mask, size_t start_index = 0);
+	SVector& m_sll(const SVector& opL, const uint64_t rhs, const SVRegister& vm, bool mask, size_t start_index = 0, const SVPolicy& policy = SVPolicy());
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Masked SRA for right-hand-side SVector
-	SVector& m_sra(const SVector& opL, const SVector& rhs, const SVRegister& vm, bool mask, size_t start_index = 0);
+	SVector& m_sra(const SVector& opL, const SVector& rhs, const SVRegister& vm, bool mask, size_t start_index = 0, const SVPolicy& policy = SVPolicy());
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Masked SRA for right-hand-side signed 64 bit value. rhs is zero extended to element size
-	SVector& m_sra(const SVector& opL, const uint64_t rhs, const SVRegister& vm, bool mask, size_t start_index = 0);
+	SVector& m_sra(const SVector& opL, const uint64_t rhs, const SVRegister& vm, bool mask, size_t start_index = 0, const SVPolicy& policy = SVPolicy());
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Masked SRL for right-hand-side SVector
-	SVector& m_srl(const SVector& opL, const SVector& rhs, const SVRegister& vm, bool mask, size_t start_index = 0);
+	SVector& m_srl(const SVector& opL, const SVector& rhs, const SVRegister& vm, bool mask, size_t start_index = 0, const SVPolicy& policy = SVPolicy());
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Masked SRL for right-hand-side signed 64 bit value. rhs is zero extended to element size
-	SVector& m_srl(const SVector& opL, const uint64_t rhs, const SVRegister& vm, bool mask, size_t start_index = 0);
+	SVector& m_srl(const SVector& opL, const uint64_t rhs, const SVRegister& vm, bool mask, size_t start_index = 0, const SVPolicy& policy = SVPolicy());
 
 	//////////////////////////////////////////////////////////////////////////////////////
 	/// \brief Slide the Vector elements up by right-hand-side unsigned 64 bit value. rhs is zero extended to element size
@@ -769,12 +891,17 @@ public:
 	/// \brief Slide the Vector elements down by right-hand-side unsigned 64 bit value. rhs is zero extended to element size
 	SVector& m_slidedown(const SVector& opL, const uint64_t rhs, const SVRegister& vm, bool mask, size_t vlmax ,size_t start_index = 0);
 
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief Write agnostic elements all ones: masked-off elements of [start_index, length_) if mask, tail elements [length_, policy.tail_end_).
+	/// Nothing is written if start_index >= length_.
+	SVector& fill_agnostic(const SVRegister& vm, bool mask, size_t start_index, const SVPolicy& policy);
+
 	/////////////////////////////////////////////////////////////////////////////////
 	/// \brief  masked signed*signed MUL for right-hand-side SVector
-	SVector& m_ssmul(const SVector& opL, const SVector& rhs, const SVRegister& vm, bool mask, size_t start_index = 0);
+	SVector& m_ssmul(const SVector& opL, const SVector& rhs, const SVRegister& vm, bool mask, size_t start_index = 0, const SVPolicy& policy = SVPolicy());
 	/////////////////////////////////////////////////////////////////////////////////////////////////////////////
 	/// \brief masked signed*signed MUL for right-hand-side signed 64 bit value. rhs is sign extended to element size
-	SVector& m_ssmul(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index = 0);
+	SVector& m_ssmul(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index = 0, const SVPolicy& policy = SVPolicy());
 	//////////////////////////////////////////////////////////////////////////////////////////////////////////
 	/// \brief  masked signed*signed MUL for right-hand-side SVector
 	SVector& m_ssmulh(const SVector& opL, const SVector& rhs, const SVRegister& vm, bool mask, size_t start_index = 0);
@@ -795,63 +922,53 @@ public:
 	SVector& m_sumulh(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index = 0);
 
 	//////////////////////////////////////////////////////////////////////////////////////
-	/// \brief Constructor for referenced elements, i.e. externally allocated elements
-	SVector(const size_t length_elements, const size_t start_reg_index) : reference_mem_(true), elements_(), length_(length_elements), start_reg_index_(start_reg_index){}
-	//////////////////////////////////////////////////////////////////////////////////////
-	/// \brief Constructor for referenced elements, i.e. externally allocated elements
-	SVector(std::vector<SVElement*>& elements, const size_t start_reg_index): reference_mem_(true), elements_(elements), length_(elements.size()), start_reg_index_(start_reg_index){}
-	//////////////////////////////////////////////////////////////////////////////////////
-	/// \brief Constructor for referenced memory but missing element interpretation, i.e. externally allocated memory space
+	/// \brief Constructor for referenced memory, i.e. externally allocated memory space
 	SVector(
 		const size_t length_elements, //!< VL
 		const size_t single_element_width_bits, //!< SEW
 		const size_t start_reg_index, //!< Index of first register associated with this vector
 		uint8_t* mem //!< Start adress of vector
 	)
-	: reference_mem_(false)
-	, elements_()
+	: reference_mem_(true)
+	, mem_(mem)
+	, single_element_width_bits_(single_element_width_bits)
 	, length_(length_elements)
-	, start_reg_index_(start_reg_index) {
-		for(size_t i = 0; i < length_; ++i) {
-			elements_.push_back(new SVElement(single_element_width_bits, mem));
-			mem += single_element_width_bits/8;
-		}
-	}
+	, start_reg_index_(start_reg_index) {}
 	//////////////////////////////////////////////////////////////////////////////////////
-	/// \brief Constructor for internal elements, thus, memory, i.e. internally allocated memory
+	/// \brief Constructor for internal memory, i.e. internally allocated memory. Elements are zero initialized.
 	SVector(
 		const size_t length_elements, //!< VL
 		const size_t single_element_width_bits, //!< SEW
 		const size_t start_reg_index //!< Index of first register associated with this vector
 	)
 	: reference_mem_(false)
-	, elements_()
+	, mem_(new uint8_t[length_elements*single_element_width_bits/8]())
+	, single_element_width_bits_(single_element_width_bits)
 	, length_(length_elements)
-	, start_reg_index_(start_reg_index) {
-		for(size_t i = 0; i < length_; ++i) {
-			elements_.push_back(new SVElement(single_element_width_bits));
-		}
-	}
+	, start_reg_index_(start_reg_index) {}
 	//////////////////////////////////////////////////////////////////////////////////////
-	/// \brief Copy Constructor. Always internal elements, thus, memory. Copies values from other element-wise.
+	/// \brief Constructor for internal memory holding the evaluated expression
+	template<typename E>
+	SVector(const SVEXPR::Expr<E>& expr);
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief Copy Constructor. Always internal memory. Copies values from other.
 	SVector(const SVector& other)
-	: reference_mem_(other.reference_mem_)
+	: reference_mem_(false)
+	, mem_(new uint8_t[other.length_*other.single_element_width_bits_/8])
+	, single_element_width_bits_(other.single_element_width_bits_)
 	, length_(other.length_)
 	, start_reg_index_(other.start_reg_index_) {
-		for(size_t i = 0; i < length_; ++i) {
-			elements_.push_back(new SVElement(other.elements_[0]->width_in_bits_));
-			(*this)[i] = other[i];
-		}
+		std::memcpy(mem_, other.mem_, length_*single_element_width_bits_/8);
 	}
 	//////////////////////////////////////////////////////////////////////////////////////
-	/// \brief Destructor. Deallocates internal elements if generated.
+	/// \brief Destructor. Deallocates internal memory if generated.
 	virtual ~SVector(void) {
 		if (!reference_mem_) {
-			for(auto &it: elements_) {
-				delete it;
-			}
+			delete[] mem_;
 		}
 	}
 };
 
+#include "vpu/softvector-expr.hpp"
+
 #endif /* __SOFTVECTOR_TYPES_H__ */
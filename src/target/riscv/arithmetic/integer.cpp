@@ -25,20 +25,15 @@
 #include "base/softvector-platform-types.hpp"
 
 VILL::vpu_return_t VARITH_INT::add_vv(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_rhs,
 	uint16_t src_vec_reg_lhs,
 	uint16_t vec_elem_start,
-	bool mask_f
+	bool mask_f,
+	bool tail_agnostic,
+	bool mask_agnostic
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if(! V.vec_reg_is_aligned(src_vec_reg_rhs) ) {
 		return(VILL::VPU_RETURN::SRC1_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
@@ -46,96 +41,75 @@ VILL::vpu_return_t VARITH_INT::add_vv(
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
 		RVVector& vs1 = V.get_vec(src_vec_reg_rhs);
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
-		vd.m_add(vs2, vs1, V.get_mask_reg(), !mask_f, vec_elem_start);
+		vd.m_add(vs2, vs1, V.get_mask_reg(), !mask_f, vec_elem_start, V.policy(tail_agnostic, mask_agnostic));
 	}
 	return(VILL::VPU_RETURN::NO_EXCEPT);
 }
 
 VILL::vpu_return_t VARITH_INT::add_vi(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_lhs,
 	uint8_t s_imm,
 	uint16_t vec_elem_start,
-	bool mask_f
+	bool mask_f,
+	bool tail_agnostic,
+	bool mask_agnostic
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
 		int64_t imm = static_cast<int64_t>(s_imm & 0x10 ? s_imm | ~0x1F : s_imm);
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
-		vd.m_add(vs2, imm, V.get_mask_reg(), !mask_f, vec_elem_start);
+		vd.m_add(vs2, imm, V.get_mask_reg(), !mask_f, vec_elem_start, V.policy(tail_agnostic, mask_agnostic));
 	}
 	return(VILL::VPU_RETURN::NO_EXCEPT);
 }
 
 VILL::vpu_return_t VARITH_INT::add_vx(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_lhs,
 	uint8_t* scalar_reg_mem,
 	uint16_t vec_elem_start,
 	bool mask_f,
-	uint8_t scalar_reg_len_bytes
+	uint8_t scalar_reg_len_bytes,
+	bool tail_agnostic,
+	bool mask_agnostic
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
-		int64_t imm = (scalar_reg_len_bytes > 32) ? *(reinterpret_cast<int64_t*>(scalar_reg_mem)) : *(reinterpret_cast<int32_t*>(scalar_reg_mem));
+		int64_t imm = (scalar_reg_len_bytes > 4) ? *(reinterpret_cast<int64_t*>(scalar_reg_mem)) : *(reinterpret_cast<int32_t*>(scalar_reg_mem));
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
-		vd.m_add(vs2, imm, V.get_mask_reg(), !mask_f, vec_elem_start);
+		vd.m_add(vs2, imm, V.get_mask_reg(), !mask_f, vec_elem_start, V.policy(tail_agnostic, mask_agnostic));
 	}
 	return(VILL::VPU_RETURN::NO_EXCEPT);
 }
 
 
 VILL::vpu_return_t VARITH_INT::sub_vv(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_rhs,
 	uint16_t src_vec_reg_lhs,
 	uint16_t vec_elem_start,
-	bool mask_f
+	bool mask_f,
+	bool tail_agnostic,
+	bool mask_agnostic
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if(! V.vec_reg_is_aligned(src_vec_reg_rhs) ) {
 		return(VILL::VPU_RETURN::SRC1_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
@@ -143,57 +117,43 @@ VILL::vpu_return_t VARITH_INT::sub_vv(
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
 		RVVector& vs1 = V.get_vec(src_vec_reg_rhs);
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
-		vd.m_sub(vs2, vs1, V.get_mask_reg(), !mask_f, vec_elem_start);
+		vd.m_sub(vs2, vs1, V.get_mask_reg(), !mask_f, vec_elem_start, V.policy(tail_agnostic, mask_agnostic));
 	}
 	return(VILL::VPU_RETURN::NO_EXCEPT);
 }
 
 
 VILL::vpu_return_t VARITH_INT::sub_vx(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_lhs,
 	uint8_t* scalar_reg_mem,
 	uint16_t vec_elem_start,
 	bool mask_f,
-	uint8_t scalar_reg_len_bytes
+	uint8_t scalar_reg_len_bytes,
+	bool tail_agnostic,
+	bool mask_agnostic
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
-		int64_t imm = (scalar_reg_len_bytes > 32) ? *(reinterpret_cast<int64_t*>(scalar_reg_mem)) : *(reinterpret_cast<int32_t*>(scalar_reg_mem));
+		int64_t imm = (scalar_reg_len_bytes > 4) ? *(reinterpret_cast<int64_t*>(scalar_reg_mem)) : *(reinterpret_cast<int32_t*>(scalar_reg_mem));
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
-		vd.m_sub(vs2, imm, V.get_mask_reg(), !mask_f, vec_elem_start);
+		vd.m_sub(vs2, imm, V.get_mask_reg(), !mask_f, vec_elem_start, V.policy(tail_agnostic, mask_agnostic));
 	}
 	return(VILL::VPU_RETURN::NO_EXCEPT);
 }
 
 VILL::vpu_return_t VARITH_INT::rsub_vx(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_rhs,
 	uint8_t* scalar_reg_mem,
@@ -201,16 +161,12 @@ VILL::vpu_return_t VARITH_INT::rsub_vx(
 	bool mask_f,
 	uint8_t scalar_reg_len_bytes
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if (! V.vec_reg_is_aligned(src_vec_reg_rhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
-		int64_t imm = (scalar_reg_len_bytes > 32) ? *(reinterpret_cast<int64_t*>(scalar_reg_mem)) : *(reinterpret_cast<int32_t*>(scalar_reg_mem));
+		int64_t imm = (scalar_reg_len_bytes > 4) ? *(reinterpret_cast<int64_t*>(scalar_reg_mem)) : *(reinterpret_cast<int32_t*>(scalar_reg_mem));
 		RVVector& vs2 = V.get_vec(src_vec_reg_rhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
@@ -220,27 +176,18 @@ VILL::vpu_return_t VARITH_INT::rsub_vx(
 }
 
 VILL::vpu_return_t VARITH_INT::rsub_vi(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_rhs,
 	uint8_t s_imm,
 	uint16_t vec_elem_start,
 	bool mask_f
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if (! V.vec_reg_is_aligned(src_vec_reg_rhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
 		int64_t imm = static_cast<int64_t>(s_imm & 0x10 ? s_imm | ~0x1F : s_imm);
 		RVVector& vs2 = V.get_vec(src_vec_reg_rhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
@@ -338,7 +285,7 @@ VILL::vpu_return_t VARITH_INT::wop_vx(
 		V.init();
 		VD.init();
 
-		int64_t imm = (scalar_reg_len_bytes > 32) ? *(reinterpret_cast<int64_t*>(scalar_reg_mem)) : *(reinterpret_cast<int32_t*>(scalar_reg_mem));
+		int64_t imm = (scalar_reg_len_bytes > 4) ? *(reinterpret_cast<int64_t*>(scalar_reg_mem)) : *(reinterpret_cast<int32_t*>(scalar_reg_mem));
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = VD.get_vec(dst_vec_reg);
 
@@ -445,7 +392,7 @@ VILL::vpu_return_t VARITH_INT::wop_wx(
 
 		V.init();
 
-		int64_t imm = (scalar_reg_len_bytes > 32) ? *(reinterpret_cast<int64_t*>(scalar_reg_mem)) : *(reinterpret_cast<int32_t*>(scalar_reg_mem));
+		int64_t imm = (scalar_reg_len_bytes > 4) ? *(reinterpret_cast<int64_t*>(scalar_reg_mem)) : *(reinterpret_cast<int32_t*>(scalar_reg_mem));
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
@@ -469,20 +416,15 @@ VILL::vpu_return_t VARITH_INT::wop_wx(
 }
 
 VILL::vpu_return_t VARITH_INT::and_vv(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_rhs,
 	uint16_t src_vec_reg_lhs,
 	uint16_t vec_elem_start,
-	bool mask_f
+	bool mask_f,
+	bool tail_agnostic,
+	bool mask_agnostic
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if(! V.vec_reg_is_aligned(src_vec_reg_rhs) ) {
 		return(VILL::VPU_RETURN::SRC1_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
@@ -490,94 +432,73 @@ VILL::vpu_return_t VARITH_INT::and_vv(
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
 		RVVector& vs1 = V.get_vec(src_vec_reg_rhs);
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
-		vd.m_and(vs2, vs1, V.get_mask_reg(), !mask_f, vec_elem_start);
+		vd.m_and(vs2, vs1, V.get_mask_reg(), !mask_f, vec_elem_start, V.policy(tail_agnostic, mask_agnostic));
 	}
 	return(VILL::VPU_RETURN::NO_EXCEPT);
 }
 
 VILL::vpu_return_t VARITH_INT::and_vi(
-	uint8_t* vec_reg_mem,	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_lhs,
 	uint8_t s_imm,
 	uint16_t vec_elem_start,
-	bool mask_f) {
-		
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
+	bool mask_f,
+	bool tail_agnostic,
+	bool mask_agnostic) {
 	if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
 		int64_t imm = static_cast<int64_t>(s_imm & 0x10 ? s_imm | ~0x1F : s_imm);
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
-		vd.m_and(vs2, imm, V.get_mask_reg(), !mask_f, vec_elem_start);
+		vd.m_and(vs2, imm, V.get_mask_reg(), !mask_f, vec_elem_start, V.policy(tail_agnostic, mask_agnostic));
 	}
 	return(VILL::VPU_RETURN::NO_EXCEPT);
 }
 
 VILL::vpu_return_t VARITH_INT::and_vx(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_lhs,
 	uint8_t* scalar_reg_mem,
 	uint16_t vec_elem_start,
 	bool mask_f,
-	uint8_t scalar_reg_len_bytes
+	uint8_t scalar_reg_len_bytes,
+	bool tail_agnostic,
+	bool mask_agnostic
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
-		int64_t imm = (scalar_reg_len_bytes > 32) ? *(reinterpret_cast<int64_t*>(scalar_reg_mem)) : *(reinterpret_cast<int32_t*>(scalar_reg_mem));
+		int64_t imm = (scalar_reg_len_bytes > 4) ? *(reinterpret_cast<int64_t*>(scalar_reg_mem)) : *(reinterpret_cast<int32_t*>(scalar_reg_mem));
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
-		vd.m_and(vs2, imm, V.get_mask_reg(), !mask_f, vec_elem_start);
+		vd.m_and(vs2, imm, V.get_mask_reg(), !mask_f, vec_elem_start, V.policy(tail_agnostic, mask_agnostic));
 	}
 	return(VILL::VPU_RETURN::NO_EXCEPT);
 }
 
 VILL::vpu_return_t VARITH_INT::or_vv(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_rhs,
 	uint16_t src_vec_reg_lhs,
 	uint16_t vec_elem_start,
-	bool mask_f
+	bool mask_f,
+	bool tail_agnostic,
+	bool mask_agnostic
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if(! V.vec_reg_is_aligned(src_vec_reg_rhs) ) {
 		return(VILL::VPU_RETURN::SRC1_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
@@ -585,95 +506,75 @@ VILL::vpu_return_t VARITH_INT::or_vv(
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
 		RVVector& vs1 = V.get_vec(src_vec_reg_rhs);
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
-		vd.m_or(vs2, vs1, V.get_mask_reg(), !mask_f, vec_elem_start);
+		vd.m_or(vs2, vs1, V.get_mask_reg(), !mask_f, vec_elem_start, V.policy(tail_agnostic, mask_agnostic));
 	}
 	return(VILL::VPU_RETURN::NO_EXCEPT);
 }
 
 VILL::vpu_return_t VARITH_INT::or_vi(
-	uint8_t* vec_reg_mem,	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_lhs,
 	uint8_t s_imm,
 	uint16_t vec_elem_start,
-	bool mask_f
+	bool mask_f,
+	bool tail_agnostic,
+	bool mask_agnostic
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
 		int64_t imm = static_cast<int64_t>(s_imm & 0x10 ? s_imm | ~0x1F : s_imm);
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
-		vd.m_or(vs2, imm, V.get_mask_reg(), !mask_f, vec_elem_start);
+		vd.m_or(vs2, imm, V.get_mask_reg(), !mask_f, vec_elem_start, V.policy(tail_agnostic, mask_agnostic));
 	}
 	return(VILL::VPU_RETURN::NO_EXCEPT);
 }
 
 
 VILL::vpu_return_t VARITH_INT::or_vx(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_lhs,
 	uint8_t* scalar_reg_mem,
 	uint16_t vec_elem_start,
 	bool mask_f,
-	uint8_t scalar_reg_len_bytes
+	uint8_t scalar_reg_len_bytes,
+	bool tail_agnostic,
+	bool mask_agnostic
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
-		int64_t imm = (scalar_reg_len_bytes > 32) ? *(reinterpret_cast<int64_t*>(scalar_reg_mem)) : *(reinterpret_cast<int32_t*>(scalar_reg_mem));
+		int64_t imm = (scalar_reg_len_bytes > 4) ? *(reinterpret_cast<int64_t*>(scalar_reg_mem)) : *(reinterpret_cast<int32_t*>(scalar_reg_mem));
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
-		vd.m_or(vs2, imm, V.get_mask_reg(), !mask_f, vec_elem_start);
+		vd.m_or(vs2, imm, V.get_mask_reg(), !mask_f, vec_elem_start, V.policy(tail_agnostic, mask_agnostic));
 	}
 	return(VILL::VPU_RETURN::NO_EXCEPT);
 }
 
 VILL::vpu_return_t VARITH_INT::xor_vv(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_rhs,
 	uint16_t src_vec_reg_lhs,
 	uint16_t vec_elem_start,
-	bool mask_f
+	bool mask_f,
+	bool tail_agnostic,
+	bool mask_agnostic
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if(! V.vec_reg_is_aligned(src_vec_reg_rhs) ) {
 		return(VILL::VPU_RETURN::SRC1_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
@@ -681,94 +582,74 @@ VILL::vpu_return_t VARITH_INT::xor_vv(
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
 		RVVector& vs1 = V.get_vec(src_vec_reg_rhs);
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
-		vd.m_xor(vs2, vs1, V.get_mask_reg(), !mask_f, vec_elem_start);
+		vd.m_xor(vs2, vs1, V.get_mask_reg(), !mask_f, vec_elem_start, V.policy(tail_agnostic, mask_agnostic));
 	}
 	return(VILL::VPU_RETURN::NO_EXCEPT);
 }
 
 VILL::vpu_return_t VARITH_INT::xor_vi(
-	uint8_t* vec_reg_mem,	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_lhs,
 	uint8_t s_imm,
 	uint16_t vec_elem_start,
-	bool mask_f
+	bool mask_f,
+	bool tail_agnostic,
+	bool mask_agnostic
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
 		int64_t imm = static_cast<int64_t>(s_imm & 0x10 ? s_imm | ~0x1F : s_imm);
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
-		vd.m_xor(vs2, imm, V.get_mask_reg(), !mask_f, vec_elem_start);
+		vd.m_xor(vs2, imm, V.get_mask_reg(), !mask_f, vec_elem_start, V.policy(tail_agnostic, mask_agnostic));
 	}
 	return(VILL::VPU_RETURN::NO_EXCEPT);
 }
 
 VILL::vpu_return_t VARITH_INT::xor_vx(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_lhs,
 	uint8_t* scalar_reg_mem,
 	uint16_t vec_elem_start,
 	bool mask_f,
-	uint8_t scalar_reg_len_bytes
+	uint8_t scalar_reg_len_bytes,
+	bool tail_agnostic,
+	bool mask_agnostic
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
-		int64_t imm = (scalar_reg_len_bytes > 32) ? *(reinterpret_cast<int64_t*>(scalar_reg_mem)) : *(reinterpret_cast<int32_t*>(scalar_reg_mem));
+		int64_t imm = (scalar_reg_len_bytes > 4) ? *(reinterpret_cast<int64_t*>(scalar_reg_mem)) : *(reinterpret_cast<int32_t*>(scalar_reg_mem));
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
-		vd.m_xor(vs2, imm, V.get_mask_reg(), !mask_f, vec_elem_start);
+		vd.m_xor(vs2, imm, V.get_mask_reg(), !mask_f, vec_elem_start, V.policy(tail_agnostic, mask_agnostic));
 	}
 	return(VILL::VPU_RETURN::NO_EXCEPT);
 }
 
 VILL::vpu_return_t VARITH_INT::sll_vv(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_rhs,
 	uint16_t src_vec_reg_lhs,
 	uint16_t vec_elem_start,
-	bool mask_f
+	bool mask_f,
+	bool tail_agnostic,
+	bool mask_agnostic
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if(! V.vec_reg_is_aligned(src_vec_reg_rhs) ) {
 		return(VILL::VPU_RETURN::SRC1_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
@@ -776,96 +657,75 @@ VILL::vpu_return_t VARITH_INT::sll_vv(
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
 		RVVector& vs1 = V.get_vec(src_vec_reg_rhs);
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
-		vd.m_sll(vs2, vs1, V.get_mask_reg(), !mask_f, vec_elem_start);
+		vd.m_sll(vs2, vs1, V.get_mask_reg(), !mask_f, vec_elem_start, V.policy(tail_agnostic, mask_agnostic));
 	}
 	return(VILL::VPU_RETURN::NO_EXCEPT);
 }
 
 VILL::vpu_return_t VARITH_INT::sll_vi(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_lhs,
 	uint8_t u_imm,
 	uint16_t vec_elem_start,
-	bool mask_f
+	bool mask_f,
+	bool tail_agnostic,
+	bool mask_agnostic
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
 		uint64_t imm = u_imm & 0x1F;
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
-		vd.m_sll(vs2, imm, V.get_mask_reg(), !mask_f, vec_elem_start);
+		vd.m_sll(vs2, imm, V.get_mask_reg(), !mask_f, vec_elem_start, V.policy(tail_agnostic, mask_agnostic));
 	}
 	return(VILL::VPU_RETURN::NO_EXCEPT);
 }
 
 
 VILL::vpu_return_t VARITH_INT::sll_vx(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_lhs,
 	uint8_t* scalar_reg_mem,
 	uint16_t vec_elem_start,
 	bool mask_f,
-	uint8_t scalar_reg_len_bytes
+	uint8_t scalar_reg_len_bytes,
+	bool tail_agnostic,
+	bool mask_agnostic
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
-		uint64_t imm = (scalar_reg_len_bytes > 32) ? *(reinterpret_cast<uint64_t*>(scalar_reg_mem)) : *(reinterpret_cast<uint32_t*>(scalar_reg_mem));
+		uint64_t imm = (scalar_reg_len_bytes > 4) ? *(reinterpret_cast<uint64_t*>(scalar_reg_mem)) : *(reinterpret_cast<uint32_t*>(scalar_reg_mem));
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
-		vd.m_sll(vs2, imm, V.get_mask_reg(), !mask_f, vec_elem_start);
+		vd.m_sll(vs2, imm, V.get_mask_reg(), !mask_f, vec_elem_start, V.policy(tail_agnostic, mask_agnostic));
 	}
 	return(VILL::VPU_RETURN::NO_EXCEPT);
 }
 
 VILL::vpu_return_t VARITH_INT::srl_vv(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_rhs,
 	uint16_t src_vec_reg_lhs,
 	uint16_t vec_elem_start,
-	bool mask_f
+	bool mask_f,
+	bool tail_agnostic,
+	bool mask_agnostic
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if(! V.vec_reg_is_aligned(src_vec_reg_rhs) ) {
 		return(VILL::VPU_RETURN::SRC1_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
@@ -873,13 +733,11 @@ VILL::vpu_return_t VARITH_INT::srl_vv(
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
 		RVVector& vs1 = V.get_vec(src_vec_reg_rhs);
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
-		vd.m_srl(vs2, vs1, V.get_mask_reg(), !mask_f, vec_elem_start);
+		vd.m_srl(vs2, vs1, V.get_mask_reg(), !mask_f, vec_elem_start, V.policy(tail_agnostic, mask_agnostic));
 	}
 	return(VILL::VPU_RETURN::NO_EXCEPT);
 }
@@ -887,85 +745,66 @@ VILL::vpu_return_t VARITH_INT::srl_vv(
 
 
 VILL::vpu_return_t VARITH_INT::srl_vi(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_lhs,
 	uint8_t u_imm,
 	uint16_t vec_elem_start,
-	bool mask_f
+	bool mask_f,
+	bool tail_agnostic,
+	bool mask_agnostic
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
 		uint64_t imm = u_imm & 0x1F;
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
-		vd.m_srl(vs2, imm, V.get_mask_reg(), !mask_f, vec_elem_start);
+		vd.m_srl(vs2, imm, V.get_mask_reg(), !mask_f, vec_elem_start, V.policy(tail_agnostic, mask_agnostic));
 	}
 	return(VILL::VPU_RETURN::NO_EXCEPT);
 }
 
 
 VILL::vpu_return_t VARITH_INT::srl_vx(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_lhs,
 	uint8_t* scalar_reg_mem,
 	uint16_t vec_elem_start,
 	bool mask_f,
-	uint8_t scalar_reg_len_bytes
+	uint8_t scalar_reg_len_bytes,
+	bool tail_agnostic,
+	bool mask_agnostic
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
-		uint64_t imm = (scalar_reg_len_bytes > 32) ? *(reinterpret_cast<uint64_t*>(scalar_reg_mem)) : *(reinterpret_cast<uint32_t*>(scalar_reg_mem));
+		uint64_t imm = (scalar_reg_len_bytes > 4) ? *(reinterpret_cast<uint64_t*>(scalar_reg_mem)) : *(reinterpret_cast<uint32_t*>(scalar_reg_mem));
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
-		vd.m_srl(vs2, imm, V.get_mask_reg(), !mask_f, vec_elem_start);
+		vd.m_srl(vs2, imm, V.get_mask_reg(), !mask_f, vec_elem_start, V.policy(tail_agnostic, mask_agnostic));
 	}
 	return(VILL::VPU_RETURN::NO_EXCEPT);
 }
 
 
 VILL::vpu_return_t VARITH_INT::sra_vv(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_rhs,
 	uint16_t src_vec_reg_lhs,
 	uint16_t vec_elem_start,
-	bool mask_f
+	bool mask_f,
+	bool tail_agnostic,
+	bool mask_agnostic
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if(! V.vec_reg_is_aligned(src_vec_reg_rhs) ) {
 		return(VILL::VPU_RETURN::SRC1_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
@@ -973,105 +812,80 @@ VILL::vpu_return_t VARITH_INT::sra_vv(
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
 		RVVector& vs1 = V.get_vec(src_vec_reg_rhs);
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
-		vd.m_sra(vs2, vs1, V.get_mask_reg(), !mask_f, vec_elem_start);
+		vd.m_sra(vs2, vs1, V.get_mask_reg(), !mask_f, vec_elem_start, V.policy(tail_agnostic, mask_agnostic));
 	}
 	return(VILL::VPU_RETURN::NO_EXCEPT);
 }
 
 
 VILL::vpu_return_t VARITH_INT::sra_vi(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_lhs,
 	uint8_t u_imm,
 	uint16_t vec_elem_start,
-	bool mask_f
+	bool mask_f,
+	bool tail_agnostic,
+	bool mask_agnostic
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
 		uint64_t imm = u_imm & 0x1F;
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
-		vd.m_sra(vs2, imm, V.get_mask_reg(), !mask_f, vec_elem_start);
+		vd.m_sra(vs2, imm, V.get_mask_reg(), !mask_f, vec_elem_start, V.policy(tail_agnostic, mask_agnostic));
 	}
 	return(VILL::VPU_RETURN::NO_EXCEPT);
 }
 
 
 VILL::vpu_return_t VARITH_INT::sra_vx(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_lhs,
 	uint8_t* scalar_reg_mem,
 	uint16_t vec_elem_start,
 	bool mask_f,
-	uint8_t scalar_reg_len_bytes
+	uint8_t scalar_reg_len_bytes,
+	bool tail_agnostic,
+	bool mask_agnostic
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
-		uint64_t imm = (scalar_reg_len_bytes > 32) ? *(reinterpret_cast<uint64_t*>(scalar_reg_mem)) : *(reinterpret_cast<uint32_t*>(scalar_reg_mem));
+		uint64_t imm = (scalar_reg_len_bytes > 4) ? *(reinterpret_cast<uint64_t*>(scalar_reg_mem)) : *(reinterpret_cast<uint32_t*>(scalar_reg_mem));
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
-		vd.m_sra(vs2, imm, V.get_mask_reg(), !mask_f, vec_elem_start);
+		vd.m_sra(vs2, imm, V.get_mask_reg(), !mask_f, vec_elem_start, V.policy(tail_agnostic, mask_agnostic));
 	}
 	return(VILL::VPU_RETURN::NO_EXCEPT);
 }
 
 
 VILL::vpu_return_t VARITH_INT::mseq_vv(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_rhs,
 	uint16_t src_vec_reg_lhs,
 	uint16_t vec_elem_start,
 	bool mask_f
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if(! V.vec_reg_is_aligned(src_vec_reg_rhs) ) {
 		return(VILL::VPU_RETURN::SRC1_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else {
-		V.init();
-
 		RVVector& vs1 = V.get_vec(src_vec_reg_rhs);
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		SVRegister& vd = V.get_vecreg(dst_vec_reg);
@@ -1083,27 +897,18 @@ VILL::vpu_return_t VARITH_INT::mseq_vv(
 
 
 VILL::vpu_return_t VARITH_INT::mseq_vi(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_lhs,
 	uint8_t s_imm,
 	uint16_t vec_elem_start,
 	bool mask_f
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
 		int64_t imm = static_cast<int64_t>(s_imm & 0x10 ? s_imm | ~0x1F : s_imm);
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		SVRegister& vd = V.get_vecreg(dst_vec_reg);
@@ -1115,12 +920,7 @@ VILL::vpu_return_t VARITH_INT::mseq_vi(
 
 
 VILL::vpu_return_t VARITH_INT::mseq_vx(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_lhs,
 	uint8_t* scalar_reg_mem,
@@ -1128,16 +928,12 @@ VILL::vpu_return_t VARITH_INT::mseq_vx(
 	bool mask_f,
 	uint8_t scalar_reg_len_bytes
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
-		uint64_t imm = (scalar_reg_len_bytes > 32) ? *(reinterpret_cast<uint64_t*>(scalar_reg_mem)) : *(reinterpret_cast<uint32_t*>(scalar_reg_mem));
+		uint64_t imm = (scalar_reg_len_bytes > 4) ? *(reinterpret_cast<uint64_t*>(scalar_reg_mem)) : *(reinterpret_cast<uint32_t*>(scalar_reg_mem));
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		SVRegister& vd = V.get_vecreg(dst_vec_reg);
 
@@ -1148,26 +944,18 @@ VILL::vpu_return_t VARITH_INT::mseq_vx(
 
 
 VILL::vpu_return_t VARITH_INT::msne_vv(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_rhs,
 	uint16_t src_vec_reg_lhs,
 	uint16_t vec_elem_start,
 	bool mask_f
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if(! V.vec_reg_is_aligned(src_vec_reg_rhs) ) {
 		return(VILL::VPU_RETURN::SRC1_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else {
-		V.init();
 		RVVector& vs1 = V.get_vec(src_vec_reg_rhs);
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		SVRegister& vd = V.get_vecreg(dst_vec_reg);
@@ -1179,27 +967,18 @@ VILL::vpu_return_t VARITH_INT::msne_vv(
 
 
 VILL::vpu_return_t VARITH_INT::msne_vi(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_lhs,
 	uint8_t s_imm,
 	uint16_t vec_elem_start,
 	bool mask_f
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
 		int64_t imm = static_cast<int64_t>(s_imm & 0x10 ? s_imm | ~0x1F : s_imm);;
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		SVRegister& vd = V.get_vecreg(dst_vec_reg);
@@ -1211,12 +990,7 @@ VILL::vpu_return_t VARITH_INT::msne_vi(
 
 
 VILL::vpu_return_t VARITH_INT::msne_vx(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_lhs,
 	uint8_t* scalar_reg_mem,
@@ -1224,16 +998,12 @@ VILL::vpu_return_t VARITH_INT::msne_vx(
 	bool mask_f,
 	uint8_t scalar_reg_len_bytes
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
-		uint64_t imm = (scalar_reg_len_bytes > 32) ? *(reinterpret_cast<uint64_t*>(scalar_reg_mem)) : *(reinterpret_cast<uint32_t*>(scalar_reg_mem));
+		uint64_t imm = (scalar_reg_len_bytes > 4) ? *(reinterpret_cast<uint64_t*>(scalar_reg_mem)) : *(reinterpret_cast<uint32_t*>(scalar_reg_mem));
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		SVRegister& vd = V.get_vecreg(dst_vec_reg);
 
@@ -1244,27 +1014,18 @@ VILL::vpu_return_t VARITH_INT::msne_vx(
 
 
 VILL::vpu_return_t VARITH_INT::msltu_vv(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_rhs,
 	uint16_t src_vec_reg_lhs,
 	uint16_t vec_elem_start,
 	bool mask_f
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if(! V.vec_reg_is_aligned(src_vec_reg_rhs) ) {
 		return(VILL::VPU_RETURN::SRC1_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else {
-		V.init();
-
 		RVVector& vs1 = V.get_vec(src_vec_reg_rhs);
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		SVRegister& vd = V.get_vecreg(dst_vec_reg);
@@ -1276,12 +1037,7 @@ VILL::vpu_return_t VARITH_INT::msltu_vv(
 
 
 VILL::vpu_return_t VARITH_INT::msltu_vx(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_lhs,
 	uint8_t* scalar_reg_mem,
@@ -1289,16 +1045,12 @@ VILL::vpu_return_t VARITH_INT::msltu_vx(
 	bool mask_f,
 	uint8_t scalar_reg_len_bytes
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
-		uint64_t imm = (scalar_reg_len_bytes > 32) ? *(reinterpret_cast<uint64_t*>(scalar_reg_mem)) : *(reinterpret_cast<uint32_t*>(scalar_reg_mem));
+		uint64_t imm = (scalar_reg_len_bytes > 4) ? *(reinterpret_cast<uint64_t*>(scalar_reg_mem)) : *(reinterpret_cast<uint32_t*>(scalar_reg_mem));
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		SVRegister& vd = V.get_vecreg(dst_vec_reg);
 
@@ -1309,27 +1061,18 @@ VILL::vpu_return_t VARITH_INT::msltu_vx(
 
 
 VILL::vpu_return_t VARITH_INT::mslt_vv(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_rhs,
 	uint16_t src_vec_reg_lhs,
 	uint16_t vec_elem_start,
 	bool mask_f
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if(! V.vec_reg_is_aligned(src_vec_reg_rhs) ) {
 		return(VILL::VPU_RETURN::SRC1_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else {
-		V.init();
-
 		RVVector& vs1 = V.get_vec(src_vec_reg_rhs);
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		SVRegister& vd = V.get_vecreg(dst_vec_reg);
@@ -1341,12 +1084,7 @@ VILL::vpu_return_t VARITH_INT::mslt_vv(
 
 
 VILL::vpu_return_t VARITH_INT::mslt_vx(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_lhs,
 	uint8_t* scalar_reg_mem,
@@ -1354,16 +1092,12 @@ VILL::vpu_return_t VARITH_INT::mslt_vx(
 	bool mask_f,
 	uint8_t scalar_reg_len_bytes
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
-		int64_t imm = (scalar_reg_len_bytes > 32) ? *(reinterpret_cast<int64_t*>(scalar_reg_mem)) : *(reinterpret_cast<int32_t*>(scalar_reg_mem));
+		int64_t imm = (scalar_reg_len_bytes > 4) ? *(reinterpret_cast<int64_t*>(scalar_reg_mem)) : *(reinterpret_cast<int32_t*>(scalar_reg_mem));
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		SVRegister& vd = V.get_vecreg(dst_vec_reg);
 
@@ -1374,27 +1108,18 @@ VILL::vpu_return_t VARITH_INT::mslt_vx(
 
 
 VILL::vpu_return_t VARITH_INT::msleu_vv(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_rhs,
 	uint16_t src_vec_reg_lhs,
 	uint16_t vec_elem_start,
 	bool mask_f
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if(! V.vec_reg_is_aligned(src_vec_reg_rhs) ) {
 		return(VILL::VPU_RETURN::SRC1_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else {
-		V.init();
-
 		RVVector& vs1 = V.get_vec(src_vec_reg_rhs);
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		SVRegister& vd = V.get_vecreg(dst_vec_reg);
@@ -1406,27 +1131,18 @@ VILL::vpu_return_t VARITH_INT::msleu_vv(
 
 
 VILL::vpu_return_t VARITH_INT::msleu_vi(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_lhs,
 	uint8_t u_imm,
 	uint16_t vec_elem_start,
 	bool mask_f
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
 		uint64_t imm = u_imm & 0x1F;
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		SVRegister& vd = V.get_vecreg(dst_vec_reg);
@@ -1438,12 +1154,7 @@ VILL::vpu_return_t VARITH_INT::msleu_vi(
 
 
 VILL::vpu_return_t VARITH_INT::msleu_vx(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_lhs,
 	uint8_t* scalar_reg_mem,
@@ -1451,16 +1162,12 @@ VILL::vpu_return_t VARITH_INT::msleu_vx(
 	bool mask_f,
 	uint8_t scalar_reg_len_bytes
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
-		uint64_t imm = (scalar_reg_len_bytes > 32) ? *(reinterpret_cast<uint64_t*>(scalar_reg_mem)) : *(reinterpret_cast<uint32_t*>(scalar_reg_mem));
+		uint64_t imm = (scalar_reg_len_bytes > 4) ? *(reinterpret_cast<uint64_t*>(scalar_reg_mem)) : *(reinterpret_cast<uint32_t*>(scalar_reg_mem));
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		SVRegister& vd = V.get_vecreg(dst_vec_reg);
 
@@ -1471,27 +1178,18 @@ VILL::vpu_return_t VARITH_INT::msleu_vx(
 
 
 VILL::vpu_return_t VARITH_INT::msle_vv(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_rhs,
 	uint16_t src_vec_reg_lhs,
 	uint16_t vec_elem_start,
 	bool mask_f
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if(! V.vec_reg_is_aligned(src_vec_reg_rhs) ) {
 		return(VILL::VPU_RETURN::SRC1_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else {
-		V.init();
-
 		RVVector& vs1 = V.get_vec(src_vec_reg_rhs);
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		SVRegister& vd = V.get_vecreg(dst_vec_reg);
@@ -1503,27 +1201,18 @@ VILL::vpu_return_t VARITH_INT::msle_vv(
 
 
 VILL::vpu_return_t VARITH_INT::msle_vi(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_lhs,
 	uint8_t s_imm,
 	uint16_t vec_elem_start,
 	bool mask_f
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
 		int64_t imm = static_cast<int64_t>(s_imm & 0x10 ? s_imm | ~0x1F : s_imm);
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		SVRegister& vd = V.get_vecreg(dst_vec_reg);
@@ -1535,12 +1224,7 @@ VILL::vpu_return_t VARITH_INT::msle_vi(
 
 
 VILL::vpu_return_t VARITH_INT::msle_vx(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_lhs,
 	uint8_t* scalar_reg_mem,
@@ -1548,16 +1232,12 @@ VILL::vpu_return_t VARITH_INT::msle_vx(
 	bool mask_f,
 	uint8_t scalar_reg_len_bytes
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
-		int64_t imm = (scalar_reg_len_bytes > 32) ? *(reinterpret_cast<int64_t*>(scalar_reg_mem)) : *(reinterpret_cast<int32_t*>(scalar_reg_mem));
+		int64_t imm = (scalar_reg_len_bytes > 4) ? *(reinterpret_cast<int64_t*>(scalar_reg_mem)) : *(reinterpret_cast<int32_t*>(scalar_reg_mem));
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		SVRegister& vd = V.get_vecreg(dst_vec_reg);
 		SVRegister v( vs2 <= imm);
@@ -1569,27 +1249,18 @@ VILL::vpu_return_t VARITH_INT::msle_vx(
 
 
 VILL::vpu_return_t VARITH_INT::msgtu_vv(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_rhs,
 	uint16_t src_vec_reg_lhs,
 	uint16_t vec_elem_start,
 	bool mask_f
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if(! V.vec_reg_is_aligned(src_vec_reg_rhs) ) {
 		return(VILL::VPU_RETURN::SRC1_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else {
-		V.init();
-
 		RVVector& vs1 = V.get_vec(src_vec_reg_rhs);
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		SVRegister& vd = V.get_vecreg(dst_vec_reg);
@@ -1601,12 +1272,7 @@ VILL::vpu_return_t VARITH_INT::msgtu_vv(
 
 
 VILL::vpu_return_t VARITH_INT::msgtu_vx(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_lhs,
 	uint8_t* scalar_reg_mem,
@@ -1614,16 +1280,12 @@ VILL::vpu_return_t VARITH_INT::msgtu_vx(
 	bool mask_f,
 	uint8_t scalar_reg_len_bytes
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
-		int64_t imm = (scalar_reg_len_bytes > 32) ? *(reinterpret_cast<uint64_t*>(scalar_reg_mem)) : *(reinterpret_cast<uint32_t*>(scalar_reg_mem));
+		int64_t imm = (scalar_reg_len_bytes > 4) ? *(reinterpret_cast<uint64_t*>(scalar_reg_mem)) : *(reinterpret_cast<uint32_t*>(scalar_reg_mem));
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		SVRegister& vd = V.get_vecreg(dst_vec_reg);
 
@@ -1634,27 +1296,18 @@ VILL::vpu_return_t VARITH_INT::msgtu_vx(
 
 
 VILL::vpu_return_t VARITH_INT::msgt_vv(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_rhs,
 	uint16_t src_vec_reg_lhs,
 	uint16_t vec_elem_start,
 	bool mask_f
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if(! V.vec_reg_is_aligned(src_vec_reg_rhs) ) {
 		return(VILL::VPU_RETURN::SRC1_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else {
-		V.init();
-
 		RVVector& vs1 = V.get_vec(src_vec_reg_rhs);
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		SVRegister& vd = V.get_vecreg(dst_vec_reg);
@@ -1666,12 +1319,7 @@ VILL::vpu_return_t VARITH_INT::msgt_vv(
 
 
 VILL::vpu_return_t VARITH_INT::msgt_vx(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_lhs,
 	uint8_t* scalar_reg_mem,
@@ -1679,16 +1327,12 @@ VILL::vpu_return_t VARITH_INT::msgt_vx(
 	bool mask_f,
 	uint8_t scalar_reg_len_bytes
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
-		uint64_t imm = (scalar_reg_len_bytes > 32) ? *(reinterpret_cast<uint64_t*>(scalar_reg_mem)) : *(reinterpret_cast<uint32_t*>(scalar_reg_mem));
+		uint64_t imm = (scalar_reg_len_bytes > 4) ? *(reinterpret_cast<uint64_t*>(scalar_reg_mem)) : *(reinterpret_cast<uint32_t*>(scalar_reg_mem));
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		SVRegister& vd = V.get_vecreg(dst_vec_reg);
 
@@ -1699,20 +1343,15 @@ VILL::vpu_return_t VARITH_INT::msgt_vx(
 /*12.10. Vector Single-Width Integer Multiply Instructions */
 //TODO
 VILL::vpu_return_t VARITH_INT::vmul_vv(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_rhs,
 	uint16_t src_vec_reg_lhs,
 	uint16_t vec_elem_start,
-	bool mask_f
+	bool mask_f,
+	bool tail_agnostic,
+	bool mask_agnostic
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if(! V.vec_reg_is_aligned(src_vec_reg_rhs) ) {
 		return(VILL::VPU_RETURN::SRC1_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
@@ -1720,64 +1359,48 @@ VILL::vpu_return_t VARITH_INT::vmul_vv(
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
 		RVVector& vs1 = V.get_vec(src_vec_reg_rhs);
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
-		vd.m_ssmul(vs2, vs1, V.get_mask_reg(), !mask_f, vec_elem_start);
+		vd.m_ssmul(vs2, vs1, V.get_mask_reg(), !mask_f, vec_elem_start, V.policy(tail_agnostic, mask_agnostic));
 	}
 	return(VILL::VPU_RETURN::NO_EXCEPT);
 }
 
 VILL::vpu_return_t VARITH_INT::vmul_vx(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_lhs,
 	uint8_t* scalar_reg_mem,
 	uint16_t vec_elem_start,
 	bool mask_f,
-	uint8_t scalar_reg_len_bytes
+	uint8_t scalar_reg_len_bytes,
+	bool tail_agnostic,
+	bool mask_agnostic
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
-		int64_t imm = (scalar_reg_len_bytes > 32) ? *(reinterpret_cast<int64_t*>(scalar_reg_mem)) : *(reinterpret_cast<int32_t*>(scalar_reg_mem));
+		int64_t imm = (scalar_reg_len_bytes > 4) ? *(reinterpret_cast<int64_t*>(scalar_reg_mem)) : *(reinterpret_cast<int32_t*>(scalar_reg_mem));
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
-		vd.m_ssmul(vs2, imm, V.get_mask_reg(), !mask_f, vec_elem_start);
+		vd.m_ssmul(vs2, imm, V.get_mask_reg(), !mask_f, vec_elem_start, V.policy(tail_agnostic, mask_agnostic));
 	}
 	return(VILL::VPU_RETURN::NO_EXCEPT);
 }
 
 VILL::vpu_return_t VARITH_INT::vmulh_vv(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_rhs,
 	uint16_t src_vec_reg_lhs,
 	uint16_t vec_elem_start,
 	bool mask_f
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if(! V.vec_reg_is_aligned(src_vec_reg_rhs) ) {
 		return(VILL::VPU_RETURN::SRC1_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
@@ -1785,8 +1408,6 @@ VILL::vpu_return_t VARITH_INT::vmulh_vv(
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
 		RVVector& vs1 = V.get_vec(src_vec_reg_rhs);
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
@@ -1796,12 +1417,7 @@ VILL::vpu_return_t VARITH_INT::vmulh_vv(
 	return(VILL::VPU_RETURN::NO_EXCEPT);
 }
 VILL::vpu_return_t VARITH_INT::vmulh_vx(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_lhs,
 	uint8_t* scalar_reg_mem,
@@ -1809,16 +1425,12 @@ VILL::vpu_return_t VARITH_INT::vmulh_vx(
 	bool mask_f,
 	uint8_t scalar_reg_len_bytes
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
-		int64_t imm = (scalar_reg_len_bytes > 32) ? *(reinterpret_cast<int64_t*>(scalar_reg_mem)) : *(reinterpret_cast<int32_t*>(scalar_reg_mem));
+		int64_t imm = (scalar_reg_len_bytes > 4) ? *(reinterpret_cast<int64_t*>(scalar_reg_mem)) : *(reinterpret_cast<int32_t*>(scalar_reg_mem));
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
@@ -1828,20 +1440,13 @@ VILL::vpu_return_t VARITH_INT::vmulh_vx(
 }
 
 VILL::vpu_return_t VARITH_INT::vmulhu_vv(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_rhs,
 	uint16_t src_vec_reg_lhs,
 	uint16_t vec_elem_start,
 	bool mask_f
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if(! V.vec_reg_is_aligned(src_vec_reg_rhs) ) {
 		return(VILL::VPU_RETURN::SRC1_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
@@ -1849,8 +1454,6 @@ VILL::vpu_return_t VARITH_INT::vmulhu_vv(
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
 		RVVector& vs1 = V.get_vec(src_vec_reg_rhs);
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
@@ -1860,12 +1463,7 @@ VILL::vpu_return_t VARITH_INT::vmulhu_vv(
 	return(VILL::VPU_RETURN::NO_EXCEPT);
 }
 VILL::vpu_return_t VARITH_INT::vmulhu_vx(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_lhs,
 	uint8_t* scalar_reg_mem,
@@ -1873,16 +1471,12 @@ VILL::vpu_return_t VARITH_INT::vmulhu_vx(
 	bool mask_f,
 	uint8_t scalar_reg_len_bytes
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
-		int64_t imm = (scalar_reg_len_bytes > 32) ? *(reinterpret_cast<int64_t*>(scalar_reg_mem)) : *(reinterpret_cast<int32_t*>(scalar_reg_mem));
+		int64_t imm = (scalar_reg_len_bytes > 4) ? *(reinterpret_cast<int64_t*>(scalar_reg_mem)) : *(reinterpret_cast<int32_t*>(scalar_reg_mem));
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
@@ -1892,20 +1486,13 @@ VILL::vpu_return_t VARITH_INT::vmulhu_vx(
 }
 
 VILL::vpu_return_t VARITH_INT::vmulhsu_vv(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_rhs,
 	uint16_t src_vec_reg_lhs,
 	uint16_t vec_elem_start,
 	bool mask_f
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if(! V.vec_reg_is_aligned(src_vec_reg_rhs) ) {
 		return(VILL::VPU_RETURN::SRC1_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
@@ -1913,8 +1500,6 @@ VILL::vpu_return_t VARITH_INT::vmulhsu_vv(
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
 		RVVector& vs1 = V.get_vec(src_vec_reg_rhs);
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
@@ -1924,12 +1509,7 @@ VILL::vpu_return_t VARITH_INT::vmulhsu_vv(
 	return(VILL::VPU_RETURN::NO_EXCEPT);
 }
 VILL::vpu_return_t VARITH_INT::vmulhsu_vx(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg_lhs,
 	uint8_t* scalar_reg_mem,
@@ -1937,16 +1517,12 @@ VILL::vpu_return_t VARITH_INT::vmulhsu_vx(
 	bool mask_f,
 	uint8_t scalar_reg_len_bytes
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if (! V.vec_reg_is_aligned(src_vec_reg_lhs) ) {
 		return(VILL::VPU_RETURN::SRC2_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
-		int64_t imm = (scalar_reg_len_bytes > 32) ? *(reinterpret_cast<int64_t*>(scalar_reg_mem)) : *(reinterpret_cast<int32_t*>(scalar_reg_mem));
+		int64_t imm = (scalar_reg_len_bytes > 4) ? *(reinterpret_cast<int64_t*>(scalar_reg_mem)) : *(reinterpret_cast<int32_t*>(scalar_reg_mem));
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
@@ -1957,25 +1533,16 @@ VILL::vpu_return_t VARITH_INT::vmulhsu_vx(
 
 /*12.17. Vector Integer Move Instructions */
 VILL::vpu_return_t VARITH_INT::mv_vv(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint16_t src_vec_reg,
 	uint16_t vec_elem_start
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if (! V.vec_reg_is_aligned(src_vec_reg) ) {
 		return(VILL::VPU_RETURN::SRC1_VEC_ILL);
 	} else if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
 		RVVector& vs1 = V.get_vec(src_vec_reg);
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
@@ -1986,25 +1553,16 @@ VILL::vpu_return_t VARITH_INT::mv_vv(
 
 
 VILL::vpu_return_t VARITH_INT::mv_vx(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint8_t* scalar_reg_mem,
 	uint16_t vec_elem_start,
 	uint8_t scalar_reg_len_bytes
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
-		int64_t imm = (scalar_reg_len_bytes > 32) ? *(reinterpret_cast<int64_t*>(scalar_reg_mem)) : *(reinterpret_cast<int32_t*>(scalar_reg_mem));
+		int64_t imm = (scalar_reg_len_bytes > 4) ? *(reinterpret_cast<int64_t*>(scalar_reg_mem)) : *(reinterpret_cast<int32_t*>(scalar_reg_mem));
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
 		vd.m_assign(imm, V.get_mask_reg(), false, vec_elem_start);
@@ -2014,23 +1572,14 @@ VILL::vpu_return_t VARITH_INT::mv_vx(
 
 
 VILL::vpu_return_t VARITH_INT::mv_vi(
-	uint8_t* vec_reg_mem,
-	uint64_t emul_num,
-	uint64_t emul_denom,
-	uint16_t sew_bytes,
-	uint16_t vec_len,
-	uint16_t vec_reg_len_bytes,
+	RVVRegField& V,
 	uint16_t dst_vec_reg,
 	uint8_t s_imm,
 	uint16_t vec_elem_start
 ) {
-	RVVRegField V(vec_reg_len_bytes*8, vec_len, sew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
-
 	if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
 		return(VILL::VPU_RETURN::DST_VEC_ILL);
 	} else {
-		V.init();
-
 		int64_t imm = static_cast<int64_t>(s_imm & 0x10 ? s_imm | ~0x1F : s_imm);
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
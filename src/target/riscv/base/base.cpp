@@ -22,26 +22,13 @@
 #include "base/base.hpp"
 
 int8_t VTYPE::decode(uint16_t vtype, uint8_t* ta, uint8_t* ma, uint32_t* sew, uint8_t* z_lmul, uint8_t* n_lmul) {
-	*ta = extractTA(vtype);
-	*ma = extractMA(vtype);
-	*sew = 8 << extractSEW(vtype);
-
-	uint8_t _flmul = extractLMUL(vtype);
-
-	*z_lmul = 1;
-	*n_lmul = 1;
-
-	switch (bits_LMUL_t(_flmul)) {
-	case BITS_LMUL::MF8: 	*z_lmul = 8; break;
-	case BITS_LMUL::MF4: 	*n_lmul = 4; break;
-	case BITS_LMUL::MF2: 	*n_lmul = 2; break;
-	case BITS_LMUL::M1: 	*z_lmul = 1; break;
-	case BITS_LMUL::M2: 	*z_lmul = 2; break;
-	case BITS_LMUL::M4: 	*z_lmul = 4; break;
-	case BITS_LMUL::M8: 	*z_lmul = 8; break;
-	default: return (-1);
-	}
-	return (1);
+	const config_t& _config = lookup(vtype);
+	*ta = _config.ta;
+	*ma = _config.ma;
+	*sew = _config.sew;
+	*z_lmul = _config.z_lmul;
+	*n_lmul = _config.n_lmul;
+	return (_config.vill ? -1 : 1);
 }
 
 uint16_t VTYPE::encode(uint16_t sew, uint8_t z_lmul, uint8_t n_lmul, uint8_t ta, uint8_t ma) {
@@ -23,6 +23,9 @@
 #include "base/base.hpp"
 #include "vpu/softvector-types.hpp"
 #include "base/softvector-platform-types.hpp"
+#include "vpu/softvector-simd.hpp"
+
+#include <cstring>
 
 VILL::vpu_return_t VLSU::load_eew(
 	std::function<void(size_t, uint8_t*, size_t)> func_read_mem,
@@ -46,7 +49,7 @@ VILL::vpu_return_t VLSU::load_eew(
 		V.init();
 
 		RVVector& vd = V.get_vec(dst_vec_reg);
-		int memOffset = src_mem_start;
+		uint64_t memOffset = src_mem_start;
 		for(size_t iElement = 0; iElement < vec_len; ++iElement) {
 			if(iElement >= vec_elem_start && (mask_f || V.get_mask_reg().get_bit(iElement))) {
 				func_read_mem(memOffset , vd[iElement].mem_, eew_bytes);
@@ -80,7 +83,7 @@ VILL::vpu_return_t VLSU::store_eew(
 		V.init();
 
 		RVVector& vs3 = V.get_vec(src_vec_reg);
-		int memOffset = dst_mem_start;
+		uint64_t memOffset = dst_mem_start;
 		for(size_t iElement = 0; iElement < vec_len; ++iElement) {
 			if(iElement >= vec_elem_start && (mask_f || V.get_mask_reg().get_bit(iElement))) {
 				func_write_mem(memOffset , vs3[iElement].mem_, eew_bytes);
@@ -90,3 +93,200 @@ VILL::vpu_return_t VLSU::store_eew(
 	}
 	return(VILL::VPU_RETURN::NO_EXCEPT);
 }
+
+VILL::vpu_return_t VLSU::load_unitstride(
+	const uint8_t* mem,
+	uint8_t* vec_reg_mem,
+	uint64_t emul_num,
+	uint64_t emul_denom,
+	uint16_t eew_bytes,
+	uint16_t vec_len,
+	uint16_t vec_reg_len_bytes,
+	uint16_t dst_vec_reg,
+	uint64_t src_mem_start,
+	uint16_t vec_elem_start,
+	uint8_t  mask_f
+) {
+	RVVRegField V(vec_reg_len_bytes*8, vec_len, eew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
+
+	if (! V.vec_reg_is_aligned(dst_vec_reg) ) {
+		return(VILL::VPU_RETURN::DST_VEC_ILL);
+	} else {
+		V.init();
+
+		uint8_t* vd = V.get_vec(dst_vec_reg).mem_;
+		const uint8_t* src = mem + src_mem_start;
+		V.get_mask_reg().for_each_active_run(vec_elem_start, vec_len, !mask_f, [&](size_t iElement, size_t nElements) {
+			std::memcpy(vd + iElement*eew_bytes, src + iElement*eew_bytes, nElements*eew_bytes);
+		});
+	}
+	return(VILL::VPU_RETURN::NO_EXCEPT);
+}
+
+VILL::vpu_return_t VLSU::store_unitstride(
+	uint8_t* mem,
+	uint8_t* vec_reg_mem,
+	uint64_t emul_num,
+	uint64_t emul_denom,
+	uint16_t eew_bytes,
+	uint16_t vec_len,
+	uint16_t vec_reg_len_bytes,
+	uint16_t src_vec_reg,
+	uint64_t dst_mem_start,
+	uint16_t vec_elem_start,
+	uint8_t  mask_f
+) {
+	RVVRegField V(vec_reg_len_bytes*8, vec_len, eew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
+
+	if (! V.vec_reg_is_aligned(src_vec_reg) ) {
+		return(VILL::VPU_RETURN::SRC3_VEC_ILL);
+	} else {
+		V.init();
+
+		const uint8_t* vs3 = V.get_vec(src_vec_reg).mem_;
+		uint8_t* dst = mem + dst_mem_start;
+		V.get_mask_reg().for_each_active_run(vec_elem_start, vec_len, !mask_f, [&](size_t iElement, size_t nElements) {
+			std::memcpy(dst + iElement*eew_bytes, vs3 + iElement*eew_bytes, nElements*eew_bytes);
+		});
+	}
+	return(VILL::VPU_RETURN::NO_EXCEPT);
+}
+
+VILL::vpu_return_t VLSU::load_segment(
+	const uint8_t* mem,
+	uint8_t* vec_reg_mem,
+	uint64_t emul_num,
+	uint64_t emul_denom,
+	uint16_t eew_bytes,
+	uint8_t  nf,
+	uint16_t vec_len,
+	uint16_t vec_reg_len_bytes,
+	uint16_t dst_vec_reg,
+	uint64_t src_mem_start,
+	uint16_t vec_elem_start,
+	uint8_t  mask_f
+) {
+	RVVRegField V(vec_reg_len_bytes*8, vec_len, eew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
+
+	if (! V.vec_reg_is_aligned(dst_vec_reg) || (nf < 1) || (nf > 8)) {
+		return(VILL::VPU_RETURN::DST_VEC_ILL);
+	} else {
+		V.init();
+
+		const uint64_t group_regs = (emul_num > emul_denom) ? emul_num/emul_denom : 1;
+		uint8_t* fields[8];
+		for(size_t iField = 0; iField < nf; ++iField) {
+			fields[iField] = vec_reg_mem + (dst_vec_reg + iField*group_regs)*vec_reg_len_bytes;
+		}
+		const uint8_t* src = mem + src_mem_start;
+		V.get_mask_reg().for_each_active_run(vec_elem_start, vec_len, !mask_f, [&](size_t iElement, size_t nElements) {
+			uint8_t* run_fields[8];
+			for(size_t iField = 0; iField < nf; ++iField) {
+				run_fields[iField] = fields[iField] + iElement*eew_bytes;
+			}
+			const uint8_t* run_src = src + iElement*nf*eew_bytes;
+			if(SVSIMD::deinterleave(nf, eew_bytes*8, run_fields, run_src, nElements)) {
+				return;
+			}
+			for(size_t i = 0; i < nElements; ++i) {
+				for(size_t iField = 0; iField < nf; ++iField) {
+					std::memcpy(run_fields[iField] + i*eew_bytes, run_src + (i*nf + iField)*eew_bytes, eew_bytes);
+				}
+			}
+		});
+	}
+	return(VILL::VPU_RETURN::NO_EXCEPT);
+}
+
+VILL::vpu_return_t VLSU::store_segment(
+	uint8_t* mem,
+	uint8_t* vec_reg_mem,
+	uint64_t emul_num,
+	uint64_t emul_denom,
+	uint16_t eew_bytes,
+	uint8_t  nf,
+	uint16_t vec_len,
+	uint16_t vec_reg_len_bytes,
+	uint16_t src_vec_reg,
+	uint64_t dst_mem_start,
+	uint16_t vec_elem_start,
+	uint8_t  mask_f
+) {
+	RVVRegField V(vec_reg_len_bytes*8, vec_len, eew_bytes*8, SVMul(emul_num, emul_denom), vec_reg_mem);
+
+	if (! V.vec_reg_is_aligned(src_vec_reg) || (nf < 1) || (nf > 8)) {
+		return(VILL::VPU_RETURN::SRC3_VEC_ILL);
+	} else {
+		V.init();
+
+		const uint64_t group_regs = (emul_num > emul_denom) ? emul_num/emul_denom : 1;
+		const uint8_t* fields[8];
+		for(size_t iField = 0; iField < nf; ++iField) {
+			fields[iField] = vec_reg_mem + (src_vec_reg + iField*group_regs)*vec_reg_len_bytes;
+		}
+		uint8_t* dst = mem + dst_mem_start;
+		V.get_mask_reg().for_each_active_run(vec_elem_start, vec_len, !mask_f, [&](size_t iElement, size_t nElements) {
+			const uint8_t* run_fields[8];
+			for(size_t iField = 0; iField < nf; ++iField) {
+				run_fields[iField] = fields[iField] + iElement*eew_bytes;
+			}
+			uint8_t* run_dst = dst + iElement*nf*eew_bytes;
+			if(SVSIMD::interleave(nf, eew_bytes*8, run_dst, run_fields, nElements)) {
+				return;
+			}
+			for(size_t i = 0; i < nElements; ++i) {
+				for(size_t iField = 0; iField < nf; ++iField) {
+					std::memcpy(run_dst + (i*nf + iField)*eew_bytes, run_fields[iField] + i*eew_bytes, eew_bytes);
+				}
+			}
+		});
+	}
+	return(VILL::VPU_RETURN::NO_EXCEPT);
+}
+
+VILL::vpu_return_t VLSU::load_indexed(
+	const uint8_t* mem,
+	uint8_t* vec_reg_mem,
+	uint64_t mul_num,
+	uint64_t mul_denom,
+	uint16_t sew_bytes,
+	uint64_t index_emul_num,
+	uint64_t index_emul_denom,
+	uint16_t index_eew_bytes,
+	uint16_t vec_len,
+	uint16_t vec_reg_len_bytes,
+	uint16_t dst_vec_reg,
+	uint16_t index_vec_reg,
+	uint64_t src_mem_start,
+	uint16_t vec_elem_start,
+	uint8_t  mask_f
+) {
+	return(for_each_indexed(vec_reg_mem, mul_num, mul_denom, sew_bytes, index_emul_num, index_emul_denom, index_eew_bytes, vec_len, vec_reg_len_bytes, dst_vec_reg, index_vec_reg, src_mem_start, vec_elem_start, mask_f,
+		[mem](uint64_t addr, uint8_t* vec_mem, size_t len) {
+			std::memcpy(vec_mem, mem + addr, len);
+		}));
+}
+
+VILL::vpu_return_t VLSU::store_indexed(
+	uint8_t* mem,
+	uint8_t* vec_reg_mem,
+	uint64_t mul_num,
+	uint64_t mul_denom,
+	uint16_t sew_bytes,
+	uint64_t index_emul_num,
+	uint64_t index_emul_denom,
+	uint16_t index_eew_bytes,
+	uint16_t vec_len,
+	uint16_t vec_reg_len_bytes,
+	uint16_t src_vec_reg,
+	uint16_t index_vec_reg,
+	uint64_t dst_mem_start,
+	uint16_t vec_elem_start,
+	uint8_t  mask_f
+) {
+	VILL::vpu_return_t ret = for_each_indexed(vec_reg_mem, mul_num, mul_denom, sew_bytes, index_emul_num, index_emul_denom, index_eew_bytes, vec_len, vec_reg_len_bytes, src_vec_reg, index_vec_reg, dst_mem_start, vec_elem_start, mask_f,
+		[mem](uint64_t addr, uint8_t* vec_mem, size_t len) {
+			std::memcpy(mem + addr, vec_mem, len);
+		});
+	return((ret == VILL::VPU_RETURN::DST_VEC_ILL) ? VILL::VPU_RETURN::SRC3_VEC_ILL : ret);
+}
@@ -136,7 +136,7 @@ VILL::vpu_return_t VPERM::slideup_vx(
 	} else {
 		V.init();
 
-		uint64_t imm = (scalar_reg_len_bytes > 32) ? *(reinterpret_cast<uint64_t*>(scalar_reg_mem)) : *(reinterpret_cast<uint32_t*>(scalar_reg_mem));
+		uint64_t imm = (scalar_reg_len_bytes > 4) ? *(reinterpret_cast<uint64_t*>(scalar_reg_mem)) : *(reinterpret_cast<uint32_t*>(scalar_reg_mem));
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
@@ -203,7 +203,7 @@ VILL::vpu_return_t VPERM::slidedown_vx(
 	} else {
 		V.init();
 
-		uint64_t imm = (scalar_reg_len_bytes > 32) ? *(reinterpret_cast<uint64_t*>(scalar_reg_mem)) : *(reinterpret_cast<uint32_t*>(scalar_reg_mem));
+		uint64_t imm = (scalar_reg_len_bytes > 4) ? *(reinterpret_cast<uint64_t*>(scalar_reg_mem)) : *(reinterpret_cast<uint32_t*>(scalar_reg_mem));
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
@@ -276,7 +276,7 @@ VILL::vpu_return_t VPERM::slide1up(
 	} else {
 		V.init();
 
-		int64_t imm = (scalar_reg_len_bytes > 32) ? *(reinterpret_cast<int64_t*>(scalar_reg_mem)) : *(reinterpret_cast<int32_t*>(scalar_reg_mem));
+		int64_t imm = (scalar_reg_len_bytes > 4) ? *(reinterpret_cast<int64_t*>(scalar_reg_mem)) : *(reinterpret_cast<int32_t*>(scalar_reg_mem));
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
@@ -337,12 +337,13 @@ VILL::vpu_return_t VPERM::slide1down(
 	} else {
 		V.init();
 
-		int64_t imm = (scalar_reg_len_bytes > 32) ? *(reinterpret_cast<int64_t*>(scalar_reg_mem)) : *(reinterpret_cast<int32_t*>(scalar_reg_mem));
+		int64_t imm = (scalar_reg_len_bytes > 4) ? *(reinterpret_cast<int64_t*>(scalar_reg_mem)) : *(reinterpret_cast<int32_t*>(scalar_reg_mem));
 		RVVector& vs2 = V.get_vec(src_vec_reg_lhs);
 		RVVector& vd = V.get_vec(dst_vec_reg);
 
 		vd.m_slidedown(vs2, 1, V.get_mask_reg(), !mask_f, vec_elem_start);
-		vd[vd.length_ -1] = imm;
+		if(vd.length_ > 0)
+			vd[vd.length_ -1] = imm;
 	}
 	return(VILL::VPU_RETURN::NO_EXCEPT);
 }
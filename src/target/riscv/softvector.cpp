@@ -20,7 +20,15 @@
 //////////////////////////////////////////////////////////////////////////////////////
 
 #include "softvector.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <new>
+#include <vector>
+
 #include "base/base.hpp"
+#include "base/softvector-platform-types.hpp"
 #include "lsu/lsu.hpp"
 #include "arithmetic/integer.hpp"
 #include "arithmetic/floatingpoint.hpp"
@@ -28,6 +36,246 @@
 #include "misc/mask.hpp"
 #include "misc/permutation.hpp"
 #include "misc/reduction.hpp"
+#include "vpu/softvector-native.hpp"
+#include "vpu/softvector-simd.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief VTYPE::TABLE in C layout, see vtype_config()
+static constexpr std::array<sv_vtype, 256> make_vtype_table(void) {
+	std::array<sv_vtype, 256> ret{};
+	for (size_t i = 0; i < ret.size(); ++i) {
+		const VTYPE::config_t& _config = VTYPE::TABLE[i];
+		ret[i] = sv_vtype{static_cast<uint16_t>(i), _config.sew, _config.z_lmul, _config.n_lmul, _config.ta, _config.ma, _config.vill};
+	}
+	return (ret);
+}
+
+static constexpr std::array<sv_vtype, 256> VTYPE_TABLE = make_vtype_table();
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Executes a decoded instruction, see sv_execute()
+typedef uint8_t (*sv_exec_t)(sv_context* ctx, const sv_insn& i);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Operand form of an opcode
+enum class sv_form : uint8_t { VV, VX, VI };
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Kernel class of an opcode, see sv_plan
+enum class sv_kind : uint8_t {
+	GENERIC, //!< Always executed by the sv_* function
+	OP, //!< Lane-wise operation with SIMD kernels (SVSIMD::OP)
+	COMPARE //!< Integer compare with SIMD kernels (SVSIMD::CMP)
+};
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Static description of an opcode
+struct sv_spec {
+	sv_exec_t exec; //!< Generic executor, forwards to the opcode's sv_* function
+	sv_kind kind;
+	sv_form form;
+	bool sign_extend; //!< The scalar (.vx) or immediate (.vi) is sign extended by the VARITH_INT function, else zero extended
+	SVSIMD::OP op; //!< Operation of kind OP
+	SVSIMD::CMP cmp; //!< Comparison of kind COMPARE
+};
+
+struct sv_plan;
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Executes an instruction along a plan
+typedef uint8_t (*sv_plan_exec_t)(const sv_plan& p, sv_context* ctx, const sv_insn& i);
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Execution plan of sv_execute(), compiled once per (opcode, vtype, vm) and context. Holds what is resolved from
+/// these: the executor for the operand form, the SIMD kernel for operation and SEW, register group alignment, VLMAX and
+/// the agnostic policies. Executing it only reads register numbers, vstart and vl of the instruction.
+struct sv_plan {
+	uint32_t key{UINT32_MAX}; //!< See sv_context::plan(), UINT32_MAX: empty
+	sv_plan_exec_t exec{nullptr};
+	const sv_spec* spec{nullptr};
+	SVSIMD::kernel_t k{nullptr}; //!< Unmasked kernel of kind OP
+	SVSIMD::compare_kernel_t k_compare{nullptr}; //!< Kernel of kind COMPARE
+	uint32_t reg_mask{0}; //!< Bits to be clear in operand register numbers, i.e. register beyond v31 or not aligned to the group
+	uint32_t element_bytes{0}; //!< SEW [bytes]
+	size_t vlmax{0}; //!< VLMAX [elements]
+	size_t tail_end{0}; //!< Tail elements [vl, tail_end) are written all ones (tail agnostic), 0: undisturbed
+	bool fill_ones{false}; //!< Masked-off elements are written all ones (mask agnostic)
+};
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Vector unit context of the C interface
+struct sv_context
+	: public RVVContext {
+	using RVVContext::RVVContext;
+
+	std::array<sv_plan, 64> plans_{}; //!< Direct mapped plan cache of sv_execute()
+
+	//////////////////////////////////////////////////////////////////////////////////////
+	/// \brief Plan of an instruction, compiled on a cache miss
+	const sv_plan& plan(const sv_insn& i);
+};
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Opcode descriptions indexed by sv_opcode, in declaration order
+static const sv_spec SPEC_TABLE[] = {
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vadd_vv(ctx, i.vtype->vtype, i.vm, i.vd, i.src1, i.vs2, i.vstart, i.vl)); }, sv_kind::OP, sv_form::VV, false, SVSIMD::OP::ADD, SVSIMD::CMP::COUNT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vadd_vi(ctx, i.vtype->vtype, i.vm, i.vd, i.vs2, i.src1, i.vstart, i.vl)); }, sv_kind::OP, sv_form::VI, true, SVSIMD::OP::ADD, SVSIMD::CMP::COUNT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vadd_vx(ctx, i.vtype->vtype, i.vm, i.vd, i.vs2, i.src1, i.vstart, i.vl)); }, sv_kind::OP, sv_form::VX, true, SVSIMD::OP::ADD, SVSIMD::CMP::COUNT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vsub_vv(ctx, i.vtype->vtype, i.vm, i.vd, i.src1, i.vs2, i.vstart, i.vl)); }, sv_kind::OP, sv_form::VV, false, SVSIMD::OP::SUB, SVSIMD::CMP::COUNT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vsub_vx(ctx, i.vtype->vtype, i.vm, i.vd, i.vs2, i.src1, i.vstart, i.vl)); }, sv_kind::OP, sv_form::VX, true, SVSIMD::OP::SUB, SVSIMD::CMP::COUNT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vand_vv(ctx, i.vtype->vtype, i.vm, i.vd, i.src1, i.vs2, i.vstart, i.vl)); }, sv_kind::OP, sv_form::VV, false, SVSIMD::OP::AND, SVSIMD::CMP::COUNT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vand_vi(ctx, i.vtype->vtype, i.vm, i.vd, i.vs2, i.src1, i.vstart, i.vl)); }, sv_kind::OP, sv_form::VI, true, SVSIMD::OP::AND, SVSIMD::CMP::COUNT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vand_vx(ctx, i.vtype->vtype, i.vm, i.vd, i.vs2, i.src1, i.vstart, i.vl)); }, sv_kind::OP, sv_form::VX, true, SVSIMD::OP::AND, SVSIMD::CMP::COUNT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vor_vv(ctx, i.vtype->vtype, i.vm, i.vd, i.src1, i.vs2, i.vstart, i.vl)); }, sv_kind::OP, sv_form::VV, false, SVSIMD::OP::OR, SVSIMD::CMP::COUNT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vor_vi(ctx, i.vtype->vtype, i.vm, i.vd, i.vs2, i.src1, i.vstart, i.vl)); }, sv_kind::OP, sv_form::VI, true, SVSIMD::OP::OR, SVSIMD::CMP::COUNT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vor_vx(ctx, i.vtype->vtype, i.vm, i.vd, i.vs2, i.src1, i.vstart, i.vl)); }, sv_kind::OP, sv_form::VX, true, SVSIMD::OP::OR, SVSIMD::CMP::COUNT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vxor_vv(ctx, i.vtype->vtype, i.vm, i.vd, i.src1, i.vs2, i.vstart, i.vl)); }, sv_kind::OP, sv_form::VV, false, SVSIMD::OP::XOR, SVSIMD::CMP::COUNT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vxor_vi(ctx, i.vtype->vtype, i.vm, i.vd, i.vs2, i.src1, i.vstart, i.vl)); }, sv_kind::OP, sv_form::VI, true, SVSIMD::OP::XOR, SVSIMD::CMP::COUNT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vxor_vx(ctx, i.vtype->vtype, i.vm, i.vd, i.vs2, i.src1, i.vstart, i.vl)); }, sv_kind::OP, sv_form::VX, true, SVSIMD::OP::XOR, SVSIMD::CMP::COUNT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vsll_vv(ctx, i.vtype->vtype, i.vm, i.vd, i.src1, i.vs2, i.vstart, i.vl)); }, sv_kind::OP, sv_form::VV, false, SVSIMD::OP::SLL, SVSIMD::CMP::COUNT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vsll_vi(ctx, i.vtype->vtype, i.vm, i.vd, i.vs2, i.src1, i.vstart, i.vl)); }, sv_kind::OP, sv_form::VI, false, SVSIMD::OP::SLL, SVSIMD::CMP::COUNT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vsll_vx(ctx, i.vtype->vtype, i.vm, i.vd, i.vs2, i.src1, i.vstart, i.vl)); }, sv_kind::OP, sv_form::VX, false, SVSIMD::OP::SLL, SVSIMD::CMP::COUNT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vsrl_vv(ctx, i.vtype->vtype, i.vm, i.vd, i.src1, i.vs2, i.vstart, i.vl)); }, sv_kind::OP, sv_form::VV, false, SVSIMD::OP::SRL, SVSIMD::CMP::COUNT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vsrl_vi(ctx, i.vtype->vtype, i.vm, i.vd, i.vs2, i.src1, i.vstart, i.vl)); }, sv_kind::OP, sv_form::VI, false, SVSIMD::OP::SRL, SVSIMD::CMP::COUNT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vsrl_vx(ctx, i.vtype->vtype, i.vm, i.vd, i.vs2, i.src1, i.vstart, i.vl)); }, sv_kind::OP, sv_form::VX, false, SVSIMD::OP::SRL, SVSIMD::CMP::COUNT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vsra_vv(ctx, i.vtype->vtype, i.vm, i.vd, i.src1, i.vs2, i.vstart, i.vl)); }, sv_kind::OP, sv_form::VV, false, SVSIMD::OP::SRA, SVSIMD::CMP::COUNT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vsra_vi(ctx, i.vtype->vtype, i.vm, i.vd, i.vs2, i.src1, i.vstart, i.vl)); }, sv_kind::OP, sv_form::VI, false, SVSIMD::OP::SRA, SVSIMD::CMP::COUNT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vsra_vx(ctx, i.vtype->vtype, i.vm, i.vd, i.vs2, i.src1, i.vstart, i.vl)); }, sv_kind::OP, sv_form::VX, false, SVSIMD::OP::SRA, SVSIMD::CMP::COUNT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vmseq_vv(ctx, i.vtype->vtype, i.vm, i.vd, i.src1, i.vs2, i.vstart, i.vl)); }, sv_kind::COMPARE, sv_form::VV, false, SVSIMD::OP::COUNT, SVSIMD::CMP::EQ},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vmseq_vi(ctx, i.vtype->vtype, i.vm, i.vd, i.vs2, i.src1, i.vstart, i.vl)); }, sv_kind::COMPARE, sv_form::VI, true, SVSIMD::OP::COUNT, SVSIMD::CMP::EQ},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vmseq_vx(ctx, i.vtype->vtype, i.vm, i.vd, i.vs2, i.src1, i.vstart, i.vl)); }, sv_kind::COMPARE, sv_form::VX, false, SVSIMD::OP::COUNT, SVSIMD::CMP::EQ},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vmsne_vv(ctx, i.vtype->vtype, i.vm, i.vd, i.src1, i.vs2, i.vstart, i.vl)); }, sv_kind::COMPARE, sv_form::VV, false, SVSIMD::OP::COUNT, SVSIMD::CMP::NE},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vmsne_vi(ctx, i.vtype->vtype, i.vm, i.vd, i.vs2, i.src1, i.vstart, i.vl)); }, sv_kind::COMPARE, sv_form::VI, true, SVSIMD::OP::COUNT, SVSIMD::CMP::NE},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vmsne_vx(ctx, i.vtype->vtype, i.vm, i.vd, i.vs2, i.src1, i.vstart, i.vl)); }, sv_kind::COMPARE, sv_form::VX, false, SVSIMD::OP::COUNT, SVSIMD::CMP::NE},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vmsltu_vv(ctx, i.vtype->vtype, i.vm, i.vd, i.src1, i.vs2, i.vstart, i.vl)); }, sv_kind::COMPARE, sv_form::VV, false, SVSIMD::OP::COUNT, SVSIMD::CMP::LTU},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vmsltu_vx(ctx, i.vtype->vtype, i.vm, i.vd, i.vs2, i.src1, i.vstart, i.vl)); }, sv_kind::COMPARE, sv_form::VX, false, SVSIMD::OP::COUNT, SVSIMD::CMP::LTU},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vmslt_vv(ctx, i.vtype->vtype, i.vm, i.vd, i.src1, i.vs2, i.vstart, i.vl)); }, sv_kind::COMPARE, sv_form::VV, false, SVSIMD::OP::COUNT, SVSIMD::CMP::LT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vmslt_vx(ctx, i.vtype->vtype, i.vm, i.vd, i.vs2, i.src1, i.vstart, i.vl)); }, sv_kind::COMPARE, sv_form::VX, true, SVSIMD::OP::COUNT, SVSIMD::CMP::LT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vmsleu_vv(ctx, i.vtype->vtype, i.vm, i.vd, i.src1, i.vs2, i.vstart, i.vl)); }, sv_kind::COMPARE, sv_form::VV, false, SVSIMD::OP::COUNT, SVSIMD::CMP::LEU},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vmsleu_vi(ctx, i.vtype->vtype, i.vm, i.vd, i.vs2, i.src1, i.vstart, i.vl)); }, sv_kind::COMPARE, sv_form::VI, false, SVSIMD::OP::COUNT, SVSIMD::CMP::LEU},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vmsleu_vx(ctx, i.vtype->vtype, i.vm, i.vd, i.vs2, i.src1, i.vstart, i.vl)); }, sv_kind::COMPARE, sv_form::VX, false, SVSIMD::OP::COUNT, SVSIMD::CMP::LEU},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vmsle_vv(ctx, i.vtype->vtype, i.vm, i.vd, i.src1, i.vs2, i.vstart, i.vl)); }, sv_kind::COMPARE, sv_form::VV, false, SVSIMD::OP::COUNT, SVSIMD::CMP::LE},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vmsle_vi(ctx, i.vtype->vtype, i.vm, i.vd, i.vs2, i.src1, i.vstart, i.vl)); }, sv_kind::COMPARE, sv_form::VI, true, SVSIMD::OP::COUNT, SVSIMD::CMP::LE},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vmsle_vx(ctx, i.vtype->vtype, i.vm, i.vd, i.vs2, i.src1, i.vstart, i.vl)); }, sv_kind::COMPARE, sv_form::VX, true, SVSIMD::OP::COUNT, SVSIMD::CMP::LE},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vmsgtu_vv(ctx, i.vtype->vtype, i.vm, i.vd, i.src1, i.vs2, i.vstart, i.vl)); }, sv_kind::COMPARE, sv_form::VV, false, SVSIMD::OP::COUNT, SVSIMD::CMP::GTU},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vmsgtu_vx(ctx, i.vtype->vtype, i.vm, i.vd, i.vs2, i.src1, i.vstart, i.vl)); }, sv_kind::COMPARE, sv_form::VX, false, SVSIMD::OP::COUNT, SVSIMD::CMP::GTU},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vmsgt_vv(ctx, i.vtype->vtype, i.vm, i.vd, i.src1, i.vs2, i.vstart, i.vl)); }, sv_kind::COMPARE, sv_form::VV, false, SVSIMD::OP::COUNT, SVSIMD::CMP::GT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vmsgt_vx(ctx, i.vtype->vtype, i.vm, i.vd, i.vs2, i.src1, i.vstart, i.vl)); }, sv_kind::COMPARE, sv_form::VX, false, SVSIMD::OP::COUNT, SVSIMD::CMP::GT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vmv_vv(ctx, i.vtype->vtype, i.vd, i.src1, i.vstart, i.vl)); }, sv_kind::GENERIC, sv_form::VV, false, SVSIMD::OP::COUNT, SVSIMD::CMP::COUNT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vmv_vi(ctx, i.vtype->vtype, i.vd, i.src1, i.vstart, i.vl)); }, sv_kind::GENERIC, sv_form::VI, false, SVSIMD::OP::COUNT, SVSIMD::CMP::COUNT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vmv_vx(ctx, i.vtype->vtype, i.vd, i.src1, i.vstart, i.vl)); }, sv_kind::GENERIC, sv_form::VX, false, SVSIMD::OP::COUNT, SVSIMD::CMP::COUNT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vmul_vv(ctx, i.vtype->vtype, i.vm, i.vd, i.src1, i.vs2, i.vstart, i.vl)); }, sv_kind::OP, sv_form::VV, false, SVSIMD::OP::MUL, SVSIMD::CMP::COUNT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vmul_vx(ctx, i.vtype->vtype, i.vm, i.vd, i.vs2, i.src1, i.vstart, i.vl)); }, sv_kind::OP, sv_form::VX, true, SVSIMD::OP::MUL, SVSIMD::CMP::COUNT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vmulh_vv(ctx, i.vtype->vtype, i.vm, i.vd, i.src1, i.vs2, i.vstart, i.vl)); }, sv_kind::GENERIC, sv_form::VV, false, SVSIMD::OP::COUNT, SVSIMD::CMP::COUNT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vmulh_vx(ctx, i.vtype->vtype, i.vm, i.vd, i.vs2, i.src1, i.vstart, i.vl)); }, sv_kind::GENERIC, sv_form::VX, false, SVSIMD::OP::COUNT, SVSIMD::CMP::COUNT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vmulhu_vv(ctx, i.vtype->vtype, i.vm, i.vd, i.src1, i.vs2, i.vstart, i.vl)); }, sv_kind::GENERIC, sv_form::VV, false, SVSIMD::OP::COUNT, SVSIMD::CMP::COUNT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vmulhu_vx(ctx, i.vtype->vtype, i.vm, i.vd, i.vs2, i.src1, i.vstart, i.vl)); }, sv_kind::GENERIC, sv_form::VX, false, SVSIMD::OP::COUNT, SVSIMD::CMP::COUNT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vmulhsu_vv(ctx, i.vtype->vtype, i.vm, i.vd, i.src1, i.vs2, i.vstart, i.vl)); }, sv_kind::GENERIC, sv_form::VV, false, SVSIMD::OP::COUNT, SVSIMD::CMP::COUNT},
+	{[](sv_context* ctx, const sv_insn& i) { return (sv_vmulhsu_vx(ctx, i.vtype->vtype, i.vm, i.vd, i.vs2, i.src1, i.vstart, i.vl)); }, sv_kind::GENERIC, sv_form::VX, false, SVSIMD::OP::COUNT, SVSIMD::CMP::COUNT},
+};
+
+static_assert(sizeof(SPEC_TABLE)/sizeof(SPEC_TABLE[0]) == SV_OPCODE_COUNT, "SPEC_TABLE does not match sv_opcode");
+
+// Scalar operand of the .vx and .vi forms, extended as by the VARITH_INT functions
+template<sv_form F>
+inline uint64_t plan_scalar(const sv_plan& p, sv_context* ctx, const sv_insn& i) {
+	if(F == sv_form::VI) {
+		if(!p.spec->sign_extend) {
+			return(i.src1 & 0x1F);
+		}
+		return(static_cast<uint64_t>(static_cast<int64_t>((i.src1 & 0x10) ? (i.src1 | ~0x1F) : i.src1)));
+	}
+	const uint8_t* x = ctx->scalar_reg(i.src1);
+	if(ctx->xlen_bytes() > 4) {
+		return(SVNATIVE::load<uint64_t>(x));
+	}
+	return(p.spec->sign_extend ? static_cast<uint64_t>(static_cast<int64_t>(SVNATIVE::load<int32_t>(x))) : SVNATIVE::load<uint32_t>(x));
+}
+
+// Misaligned registers and vl beyond VLMAX are left to the generic executor
+template<sv_form F>
+inline bool plan_applies(const sv_plan& p, const sv_insn& i) {
+	const uint32_t regs = i.vd | i.vs2 | ((F == sv_form::VV) ? i.src1 : 0);
+	return(!(regs & p.reg_mask) && (i.vl <= p.vlmax));
+}
+
+static uint8_t plan_generic(const sv_plan& p, sv_context* ctx, const sv_insn& i) {
+	return(p.spec->exec(ctx, i));
+}
+
+// Lane-wise operations: unmasked straight through the kernel, masked through SVSIMD::run(), which may decline sparse masks
+template<sv_form F>
+static uint8_t plan_op(const sv_plan& p, sv_context* ctx, const sv_insn& i) {
+	if(!plan_applies<F>(p, i)) {
+		return(p.spec->exec(ctx, i));
+	}
+	if(i.vstart >= i.vl) {
+		return(0);
+	}
+	uint8_t* vd = ctx->vector_reg(i.vd);
+	const uint8_t* vs2 = ctx->vector_reg(i.vs2);
+	const uint8_t* vs1 = (F == sv_form::VV) ? ctx->vector_reg(i.src1) : nullptr;
+	const uint64_t rhs = (F == sv_form::VV) ? 0 : plan_scalar<F>(p, ctx, i);
+	if(i.vm) {
+		const size_t offset = i.vstart*p.element_bytes;
+		p.k(vd + offset, vs2 + offset, vs1 ? vs1 + offset : nullptr, rhs, (i.vl - i.vstart)*p.element_bytes);
+	} else if(!SVSIMD::run(p.spec->op, 8*p.element_bytes, 8*p.element_bytes, vd, vs2, vs1, rhs, i.vl, ctx->vector_reg(0), i.vstart, p.fill_ones)) {
+		return(p.spec->exec(ctx, i));
+	}
+	if(p.tail_end > i.vl) {
+		std::memset(vd + i.vl*p.element_bytes, 0xFF, (p.tail_end - i.vl)*p.element_bytes);
+	}
+	return(0);
+}
+
+template<sv_form F>
+static uint8_t plan_compare(const sv_plan& p, sv_context* ctx, const sv_insn& i) {
+	if(!plan_applies<F>(p, i)) {
+		return(p.spec->exec(ctx, i));
+	}
+	if(i.vstart < i.vl) {
+		const uint8_t* vs1 = (F == sv_form::VV) ? ctx->vector_reg(i.src1) : nullptr;
+		const uint64_t rhs = (F == sv_form::VV) ? 0 : plan_scalar<F>(p, ctx, i);
+		p.k_compare(ctx->vector_reg(i.vd), ctx->vector_reg(i.vs2), vs1, rhs, i.vm ? nullptr : ctx->vector_reg(0), i.vstart, i.vl);
+	}
+	return(0);
+}
+
+const sv_plan& sv_context::plan(const sv_insn& i) {
+	const uint32_t key = (static_cast<uint32_t>(i.opcode) << 9) | ((i.vtype->vtype & 0xFF) << 1) | (i.vm ? 1 : 0);
+	sv_plan& p = plans_[(key*2654435761u) >> 26];
+	if(p.key == key) {
+		return(p);
+	}
+
+	static const sv_plan_exec_t EXEC_OP[] = {&plan_op<sv_form::VV>, &plan_op<sv_form::VX>, &plan_op<sv_form::VI>};
+	static const sv_plan_exec_t EXEC_COMPARE[] = {&plan_compare<sv_form::VV>, &plan_compare<sv_form::VX>, &plan_compare<sv_form::VI>};
+	const sv_spec& s = SPEC_TABLE[i.opcode];
+	const sv_vtype& vt = *i.vtype;
+	const bool agnostic = SVPolicy::enabled();
+
+	p = sv_plan{};
+	p.key = key;
+	p.exec = &plan_generic;
+	p.spec = &s;
+	p.reg_mask = ~static_cast<uint32_t>(31) | (vt.z_lmul - 1u);
+	p.element_bytes = vt.sew/8;
+	p.vlmax = vlen_bits()*vt.z_lmul/vt.n_lmul/vt.sew;
+	p.tail_end = (agnostic && vt.ta) ? p.vlmax : 0;
+	p.fill_ones = agnostic && vt.ma;
+	switch(s.kind) {
+	case sv_kind::OP:
+		p.k = SVSIMD::kernel(s.op, vt.sew);
+		p.exec = p.k ? EXEC_OP[static_cast<size_t>(s.form)] : p.exec;
+		break;
+	case sv_kind::COMPARE:
+		p.k_compare = SVSIMD::compare_kernel(s.cmp, vt.sew);
+		p.exec = p.k_compare ? EXEC_COMPARE[static_cast<size_t>(s.form)] : p.exec;
+		break;
+	default: break;
+	}
+	return(p);
+}
 
 extern "C" {
 
@@ -59,6 +307,10 @@ uint16_t vcfg_concatEEW(uint8_t mew, uint8_t width) {
 	return (VTYPE::concatEEW(mew, width));
 }
 
+const sv_vtype* vtype_config(uint16_t pVTYPE) {
+	return (&VTYPE_TABLE[pVTYPE & 0xFF]);
+}
+
 uint8_t vload_encoded_unitstride(
 	void* pV,
 	uint8_t* pM,
@@ -73,14 +325,7 @@ uint8_t vload_encoded_unitstride(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	std::function<void(size_t, uint8_t*, size_t)> f_readMem = [pM](size_t addr, uint8_t* buff, size_t len) {
-		for (size_t i = 0; i<len; ++i)
-			buff[i] = pM[addr+i];
-	};
-
-	VLSU::load_eew(f_readMem, VectorRegField, _z_emul, _n_emul, pEEW/8, pVL, pVLEN/8, pVd, pMSTART, pVSTART, pVm, 0);
-
-	return (0);
+	return (VLSU::load_unitstride(pM, VectorRegField, _z_emul, _n_emul, pEEW/8, pVL, pVLEN/8, pVd, pMSTART, pVSTART, pVm) ? 1 : 0);
 }
 
 uint8_t vload_encoded_stride(
@@ -104,9 +349,7 @@ uint8_t vload_encoded_stride(
 			buff[i] = pM[addr+i];
 	};
 
-	VLSU::load_eew(f_readMem, VectorRegField, _z_emul, _n_emul, pEEW/8, pVL, pVLEN/8, pVd, pMSTART, pVSTART, pVm, pSTRIDE);
-
-	return (0);
+	return (VLSU::load_eew(f_readMem, VectorRegField, _z_emul, _n_emul, pEEW/8, pVL, pVLEN/8, pVd, pMSTART, pVSTART, pVm, pSTRIDE) ? 1 : 0);
 }
 
 uint8_t vload_segment_unitstride(
@@ -118,23 +361,20 @@ uint8_t vload_segment_unitstride(
 	uint64_t _n_emul = _vt._sew*_vt._n_lmul;
 
 	if ((_n_emul > _z_emul*pNF*8) || (_z_emul*pNF > _n_emul*8)) return 1;
-	if ((pVd + pNF*_z_emul/_n_emul) > 32) return 1;
+	uint64_t _group = (_z_emul > _n_emul) ? _z_emul/_n_emul : 1;
+
+	if ((pVd + pNF*_group) > 32) return 1;
 	if (pVSTART >= pVL) return (0);
 
 	uint8_t* VectorRegField;
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	std::function<void(size_t, uint8_t*, size_t)> f_readMem = [pM](size_t addr, uint8_t* buff, size_t len) {
-		for (size_t i = 0; i<len; ++i)
-			buff[i] = pM[addr+i];
-	};
-
 	uint16_t _vstart = pVSTART;
 	uint64_t _moffset = pMSTART;
 
 	for(int i = 0; i< pNF; ++i) {
-		VLSU::load_eew(f_readMem, VectorRegField, _z_emul, _n_emul, pEEW/8, pVL, pVLEN/8, pVd + (i*_z_emul/_n_emul), _moffset, _vstart, pVm, 0);
+		if (VLSU::load_unitstride(pM, VectorRegField, _z_emul, _n_emul, pEEW/8, pVL, pVLEN/8, pVd + i*_group, _moffset, _vstart, pVm)) return 1;
 		_moffset+= (pVL-_vstart)*pEEW/8;
 		_vstart = 0;
 	}
@@ -151,13 +391,19 @@ uint8_t vload_segment_stride(
 	uint64_t _n_emul = _vt._sew*_vt._n_lmul;
 
 	if ((_n_emul > _z_emul*pNF*8) || (_z_emul*pNF > _n_emul*8)) return 1;
-	if ((pVd + pNF*_z_emul/_n_emul) > 32) return 1;
+	uint64_t _group = (_z_emul > _n_emul) ? _z_emul/_n_emul : 1;
+
+	if ((pVd + pNF*_group) > 32) return 1;
 	if (pVSTART >= pVL) return (0);
 
 	uint8_t* VectorRegField;
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
+	if (pSTRIDE == (pNF - 1)*pEEW/8) {
+		return (VLSU::load_segment(pM, VectorRegField, _z_emul, _n_emul, pEEW/8, pNF, pVL, pVLEN/8, pVd, pMSTART, pVSTART, pVm) ? 1 : 0);
+	}
+
 	std::function<void(size_t, uint8_t*, size_t)> f_readMem = [pM](size_t addr, uint8_t* buff, size_t len) {
 		for (size_t i = 0; i<len; ++i)
 			buff[i] = pM[addr+i];
@@ -168,8 +414,7 @@ uint8_t vload_segment_stride(
 
 	for(int i = 0; i< pNF; ++i) {
 		_moffset = pMSTART + i*pEEW/8;
-		VLSU::load_eew(f_readMem, VectorRegField, _z_emul, _n_emul, pEEW/8, pVL, pVLEN/8, pVd + (i*_z_emul/_n_emul), _moffset, _vstart, pVm, pSTRIDE);
-		_vstart = 0;
+		if (VLSU::load_eew(f_readMem, VectorRegField, _z_emul, _n_emul, pEEW/8, pVL, pVLEN/8, pVd + i*_group, _moffset, _vstart, pVm, pSTRIDE)) return 1;
 	}
 
 	return (0);
@@ -189,14 +434,7 @@ uint8_t vstore_encoded_unitstride(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	std::function<void(size_t, uint8_t*, size_t)> f_writeMem = [pM](size_t addr, uint8_t* buff, size_t len) {
-		for (size_t i = 0; i<len; ++i)
-			pM[addr+i] = buff[i];
-	};
-
-	VLSU::store_eew(f_writeMem, VectorRegField, _z_emul, _n_emul, pEEW/8, pVL, pVLEN/8, pVd, pMSTART, pVSTART, pVm, 0);
-
-	return (0);
+	return (VLSU::store_unitstride(pM, VectorRegField, _z_emul, _n_emul, pEEW/8, pVL, pVLEN/8, pVd, pMSTART, pVSTART, pVm) ? 1 : 0);
 }
 
 uint8_t vstore_encoded_stride(
@@ -217,9 +455,7 @@ uint8_t vstore_encoded_stride(
 		for (size_t i = 0; i<len; ++i)
 			pM[addr+i] = buff[i];
 	};
-	VLSU::store_eew(f_writeMem, VectorRegField, _z_emul, _n_emul, pEEW/8, pVL, pVLEN/8, pVd, pMSTART, pVSTART, pVm, pStride);
-
-	return (0);
+	return (VLSU::store_eew(f_writeMem, VectorRegField, _z_emul, _n_emul, pEEW/8, pVL, pVLEN/8, pVd, pMSTART, pVSTART, pVm, pStride) ? 1 : 0);
 }
 
 uint8_t vstore_segment_unitstride(
@@ -231,23 +467,20 @@ uint8_t vstore_segment_unitstride(
 	uint64_t _n_emul = _vt._sew*_vt._n_lmul;
 
 	if ((_n_emul > _z_emul*pNF*8) || (_z_emul*pNF > _n_emul*8)) return 1;
-	if ((pVd + pNF*_z_emul/_n_emul) > 32) return 1;
+	uint64_t _group = (_z_emul > _n_emul) ? _z_emul/_n_emul : 1;
+
+	if ((pVd + pNF*_group) > 32) return 1;
 	if (pVSTART >= pVL) return (0);
 
 	uint8_t* VectorRegField;
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	std::function<void(size_t, uint8_t*, size_t)> f_writeMem = [pM](size_t addr, uint8_t* buff, size_t len) {
-		for (size_t i = 0; i<len; ++i)
-			pM[addr+i] = buff[i];
-	};
-
 	uint16_t _vstart = pVSTART;
 	uint64_t _moffset = pMSTART;
 
 	for(int i = 0; i< pNF; ++i) {
-		VLSU::store_eew(f_writeMem, VectorRegField, _z_emul, _n_emul, pEEW/8, pVL, pVLEN/8, pVd + (i*_z_emul/_n_emul), _moffset, _vstart, pVm, 0);
+		if (VLSU::store_unitstride(pM, VectorRegField, _z_emul, _n_emul, pEEW/8, pVL, pVLEN/8, pVd + i*_group, _moffset, _vstart, pVm)) return 1;
 		_moffset+= (pVL-_vstart)*pEEW/8;
 		_vstart = 0;
 	}
@@ -264,13 +497,19 @@ uint8_t vstore_segment_stride(
 	uint64_t _n_emul = _vt._sew*_vt._n_lmul;
 
 	if ((_n_emul > _z_emul*pNF*8) || (_z_emul*pNF > _n_emul*8)) return 1;
-	if ((pVd + pNF*_z_emul/_n_emul) > 32) return 1;
+	uint64_t _group = (_z_emul > _n_emul) ? _z_emul/_n_emul : 1;
+
+	if ((pVd + pNF*_group) > 32) return 1;
 	if (pVSTART >= pVL) return (0);
 
 	uint8_t* VectorRegField;
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
+	if (pStride == (pNF - 1)*pEEW/8) {
+		return (VLSU::store_segment(pM, VectorRegField, _z_emul, _n_emul, pEEW/8, pNF, pVL, pVLEN/8, pVd, pMSTART, pVSTART, pVm) ? 1 : 0);
+	}
+
 	std::function<void(size_t, uint8_t*, size_t)> f_writeMem = [pM](size_t addr, uint8_t* buff, size_t len) {
 		for (size_t i = 0; i<len; ++i)
 			pM[addr+i] = buff[i];
@@ -280,14 +519,278 @@ uint8_t vstore_segment_stride(
 	uint64_t _moffset = pMSTART;
 	for(int i = 0; i< pNF; ++i) {
 		_moffset = pMSTART + i*pEEW/8;
-		VLSU::store_eew(f_writeMem, VectorRegField, _z_emul, _n_emul, pEEW/8, pVL, pVLEN/8, pVd + (i*_z_emul/_n_emul), _moffset, _vstart, pVm, 0);
-		_moffset+= (pVL-_vstart)*pEEW/8;
-	   _vstart = 0;
+		if (VLSU::store_eew(f_writeMem, VectorRegField, _z_emul, _n_emul, pEEW/8, pVL, pVLEN/8, pVd + i*_group, _moffset, _vstart, pVm, pStride)) return 1;
 	}
 
 	return (0);
 }
 
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Range buffer of the vload/vstore_ranges_* functions, kept per thread, i.e. only grows
+static std::vector<sv_mem_range>& range_buffer(void) {
+	static thread_local std::vector<sv_mem_range> ranges;
+	ranges.clear();
+	return (ranges);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Collects the memory ranges of an encoded load/store and hands them to pAccess in a single call.
+static uint8_t vaccess_ranges(
+	void* pV,
+	sv_mem_access pAccess,
+	void* pUser,
+	uint16_t pVTYPE, uint8_t pVm, uint16_t pEEW, uint8_t pVd, uint16_t pVSTART, uint16_t pVLEN, uint16_t pVL, uint64_t pMSTART, int16_t pSTRIDE) {
+	VTYPE::VTYPE _vt(pVTYPE);
+	uint64_t _z_emul = pEEW*_vt._z_lmul;
+	uint64_t _n_emul = _vt._sew*_vt._n_lmul;
+
+	if ((_n_emul > _z_emul*8) || (_z_emul > _n_emul*8)) return 1;
+
+	std::vector<sv_mem_range>& ranges = range_buffer();
+
+	VILL::vpu_return_t ret = VLSU::for_each_range(static_cast<uint8_t*>(pV), _z_emul, _n_emul, pEEW/8, pVL, pVLEN/8, pVd, pMSTART, pVSTART, pVm, pSTRIDE,
+		[&ranges](uint64_t addr, uint8_t* data, size_t len) {
+			ranges.push_back(sv_mem_range{addr, data, len});
+		});
+	if (ret != VILL::VPU_RETURN::NO_EXCEPT) return 1;
+	if (ranges.empty()) return (0);
+
+	return (pAccess(pUser, ranges.data(), static_cast<uint32_t>(ranges.size())) ? 1 : 0);
+}
+
+uint8_t vload_ranges_unitstride(
+	void* pV,
+	sv_mem_access pRead,
+	void* pUser,
+	uint16_t pVTYPE, uint8_t  pVm, uint16_t pEEW, uint8_t  pVd, uint16_t pVSTART, uint16_t pVLEN, uint16_t pVL, uint64_t pMSTART) {
+	return (vaccess_ranges(pV, pRead, pUser, pVTYPE, pVm, pEEW, pVd, pVSTART, pVLEN, pVL, pMSTART, 0));
+}
+
+uint8_t vload_ranges_stride(
+	void* pV,
+	sv_mem_access pRead,
+	void* pUser,
+	uint16_t pVTYPE, uint8_t  pVm, uint16_t pEEW, uint8_t  pVd, uint16_t pVSTART, uint16_t pVLEN, uint16_t pVL, uint64_t pMSTART, int16_t pSTRIDE) {
+	return (vaccess_ranges(pV, pRead, pUser, pVTYPE, pVm, pEEW, pVd, pVSTART, pVLEN, pVL, pMSTART, pSTRIDE));
+}
+
+uint8_t vstore_ranges_unitstride(
+	void* pV,
+	sv_mem_access pWrite,
+	void* pUser,
+	uint16_t pVTYPE, uint8_t pVm, uint16_t pEEW, uint8_t pVd, uint16_t pVSTART, uint16_t pVLEN, uint16_t pVL, uint64_t pMSTART) {
+	return (vaccess_ranges(pV, pWrite, pUser, pVTYPE, pVm, pEEW, pVd, pVSTART, pVLEN, pVL, pMSTART, 0));
+}
+
+uint8_t vstore_ranges_stride(
+	void* pV,
+	sv_mem_access pWrite,
+	void* pUser,
+	uint16_t pVTYPE, uint8_t pVm, uint16_t pEEW, uint8_t pVd, uint16_t pVSTART, uint16_t pVLEN, uint16_t pVL, uint64_t pMSTART, int16_t pStride) {
+	return (vaccess_ranges(pV, pWrite, pUser, pVTYPE, pVm, pEEW, pVd, pVSTART, pVLEN, pVL, pMSTART, pStride));
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Probes the pages of a fault-only-first load and trims pVL to the first faulting element
+/// \return 1 if element 0 faults
+static uint8_t vprobe_ff(
+	void* pV,
+	sv_page_valid pValid,
+	void* pUser,
+	uint64_t pPAGESIZE,
+	uint8_t pVm, uint16_t pEEW, uint16_t pVSTART, uint16_t pVLEN, uint16_t* pVL, uint64_t pMSTART) {
+	// No elements, nothing to probe. first_fault() would return vl, i.e. 0
+	if (pVSTART >= *pVL) return (0);
+
+	size_t _fault = VLSU::first_fault(static_cast<uint8_t*>(pV), pEEW/8, *pVL, pVLEN/8, pMSTART, pVSTART, pVm, pPAGESIZE,
+		[pValid, pUser](uint64_t page) {
+			return (pValid(pUser, page) != 0);
+		});
+	if (_fault == 0) return 1;
+	*pVL = _fault;
+
+	return (0);
+}
+
+uint8_t vload_ff_unitstride(
+	void* pV,
+	uint8_t* pM,
+	sv_page_valid pValid,
+	void* pUser,
+	uint64_t pPAGESIZE,
+	uint16_t pVTYPE, uint8_t  pVm, uint16_t pEEW, uint8_t  pVd, uint16_t pVSTART, uint16_t pVLEN, uint16_t* pVL, uint64_t pMSTART) {
+	VTYPE::VTYPE _vt(pVTYPE);
+	uint64_t _z_emul = pEEW*_vt._z_lmul;
+	uint64_t _n_emul = _vt._sew*_vt._n_lmul;
+
+	if ((_n_emul > _z_emul*8) || (_z_emul > _n_emul*8) || !pPAGESIZE) return 1;
+
+	const SVMul _emul(_z_emul, _n_emul);
+	if (!_emul.is_frac() && (pVd % (_emul.n_/_emul.d_))) return 1;
+
+	uint8_t* VectorRegField;
+
+	VectorRegField = static_cast<uint8_t*>(pV);
+
+	if (vprobe_ff(pV, pValid, pUser, pPAGESIZE, pVm, pEEW, pVSTART, pVLEN, pVL, pMSTART)) return 1;
+
+	return (VLSU::load_unitstride(pM, VectorRegField, _z_emul, _n_emul, pEEW/8, *pVL, pVLEN/8, pVd, pMSTART, pVSTART, pVm) ? 1 : 0);
+}
+
+uint8_t vload_ranges_ff_unitstride(
+	void* pV,
+	sv_mem_access pRead,
+	sv_page_valid pValid,
+	void* pUser,
+	uint64_t pPAGESIZE,
+	uint16_t pVTYPE, uint8_t  pVm, uint16_t pEEW, uint8_t  pVd, uint16_t pVSTART, uint16_t pVLEN, uint16_t* pVL, uint64_t pMSTART) {
+	VTYPE::VTYPE _vt(pVTYPE);
+	uint64_t _z_emul = pEEW*_vt._z_lmul;
+	uint64_t _n_emul = _vt._sew*_vt._n_lmul;
+
+	if ((_n_emul > _z_emul*8) || (_z_emul > _n_emul*8) || !pPAGESIZE) return 1;
+
+	const SVMul _emul(_z_emul, _n_emul);
+	if (!_emul.is_frac() && (pVd % (_emul.n_/_emul.d_))) return 1;
+
+	if (vprobe_ff(pV, pValid, pUser, pPAGESIZE, pVm, pEEW, pVSTART, pVLEN, pVL, pMSTART)) return 1;
+
+	return (vaccess_ranges(pV, pRead, pUser, pVTYPE, pVm, pEEW, pVd, pVSTART, pVLEN, *pVL, pMSTART, 0));
+}
+
+uint8_t vload_indexed_unordered(
+	void* pV,
+	uint8_t* pM,
+	uint16_t pVTYPE, uint8_t  pVm, uint16_t pEEW, uint8_t  pVd, uint8_t pVs2, uint16_t pVSTART, uint16_t pVLEN, uint16_t pVL, uint64_t pMSTART) {
+	return (vload_indexed_ordered(pV, pM, pVTYPE, pVm, pEEW, pVd, pVs2, pVSTART, pVLEN, pVL, pMSTART));
+}
+
+uint8_t vload_indexed_ordered(
+	void* pV,
+	uint8_t* pM,
+	uint16_t pVTYPE, uint8_t  pVm, uint16_t pEEW, uint8_t  pVd, uint8_t pVs2, uint16_t pVSTART, uint16_t pVLEN, uint16_t pVL, uint64_t pMSTART) {
+	VTYPE::VTYPE _vt(pVTYPE);
+	uint64_t _z_emul = pEEW*_vt._z_lmul;
+	uint64_t _n_emul = _vt._sew*_vt._n_lmul;
+
+	if ((_n_emul > _z_emul*8) || (_z_emul > _n_emul*8)) return 1;
+	// Offsets are zero-extended into 64 bits
+	if ((pEEW != 8) && (pEEW != 16) && (pEEW != 32) && (pEEW != 64)) return 1;
+
+	uint8_t* VectorRegField;
+
+	VectorRegField = static_cast<uint8_t*>(pV);
+
+	if (VLSU::load_indexed(pM, VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew/8, _z_emul, _n_emul, pEEW/8, pVL, pVLEN/8, pVd, pVs2, pMSTART, pVSTART, pVm) != VILL::VPU_RETURN::NO_EXCEPT) return 1;
+
+	return (0);
+}
+
+uint8_t vstore_indexed_unordered(
+	void* pV,
+	uint8_t* pM,
+	uint16_t pVTYPE, uint8_t pVm, uint16_t pEEW, uint8_t pVd, uint8_t pVs2, uint16_t pVSTART, uint16_t pVLEN, uint16_t pVL, uint64_t pMSTART) {
+	return (vstore_indexed_ordered(pV, pM, pVTYPE, pVm, pEEW, pVd, pVs2, pVSTART, pVLEN, pVL, pMSTART));
+}
+
+uint8_t vstore_indexed_ordered(
+	void* pV,
+	uint8_t* pM,
+	uint16_t pVTYPE, uint8_t pVm, uint16_t pEEW, uint8_t pVd, uint8_t pVs2, uint16_t pVSTART, uint16_t pVLEN, uint16_t pVL, uint64_t pMSTART) {
+	VTYPE::VTYPE _vt(pVTYPE);
+	uint64_t _z_emul = pEEW*_vt._z_lmul;
+	uint64_t _n_emul = _vt._sew*_vt._n_lmul;
+
+	if ((_n_emul > _z_emul*8) || (_z_emul > _n_emul*8)) return 1;
+	// Offsets are zero-extended into 64 bits
+	if ((pEEW != 8) && (pEEW != 16) && (pEEW != 32) && (pEEW != 64)) return 1;
+
+	uint8_t* VectorRegField;
+
+	VectorRegField = static_cast<uint8_t*>(pV);
+
+	if (VLSU::store_indexed(pM, VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew/8, _z_emul, _n_emul, pEEW/8, pVL, pVLEN/8, pVd, pVs2, pMSTART, pVSTART, pVm) != VILL::VPU_RETURN::NO_EXCEPT) return 1;
+
+	return (0);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Collects the memory ranges of an indexed load/store and hands them to pAccess in a single call.
+/// Unordered accesses are stable sorted by address. Ranges adjacent in memory and register field are merged.
+static uint8_t vaccess_ranges_indexed(
+	void* pV,
+	sv_mem_access pAccess,
+	void* pUser,
+	bool pOrdered,
+	uint16_t pVTYPE, uint8_t pVm, uint16_t pEEW, uint8_t pVd, uint8_t pVs2, uint16_t pVSTART, uint16_t pVLEN, uint16_t pVL, uint64_t pMSTART) {
+	VTYPE::VTYPE _vt(pVTYPE);
+	uint64_t _z_emul = pEEW*_vt._z_lmul;
+	uint64_t _n_emul = _vt._sew*_vt._n_lmul;
+
+	if ((_n_emul > _z_emul*8) || (_z_emul > _n_emul*8)) return 1;
+	// Offsets are zero-extended into 64 bits
+	if ((pEEW != 8) && (pEEW != 16) && (pEEW != 32) && (pEEW != 64)) return 1;
+
+	std::vector<sv_mem_range>& ranges = range_buffer();
+
+	VILL::vpu_return_t ret = VLSU::for_each_indexed(static_cast<uint8_t*>(pV), _vt._z_lmul, _vt._n_lmul, _vt._sew/8, _z_emul, _n_emul, pEEW/8, pVL, pVLEN/8, pVd, pVs2, pMSTART, pVSTART, pVm,
+		[&ranges](uint64_t addr, uint8_t* data, size_t len) {
+			ranges.push_back(sv_mem_range{addr, data, len});
+		});
+	if (ret != VILL::VPU_RETURN::NO_EXCEPT) return 1;
+	if (ranges.empty()) return (0);
+
+	if (!pOrdered) {
+		std::stable_sort(ranges.begin(), ranges.end(), [](const sv_mem_range& a, const sv_mem_range& b) {
+			return (a.addr < b.addr);
+		});
+	}
+	size_t _n = 0;
+	for (size_t i = 1; i < ranges.size(); ++i) {
+		sv_mem_range& _last = ranges[_n];
+		if ((_last.addr + _last.len == ranges[i].addr) && (_last.data + _last.len == ranges[i].data)) {
+			_last.len += ranges[i].len;
+		} else {
+			ranges[++_n] = ranges[i];
+		}
+	}
+	ranges.resize(_n + 1);
+
+	return (pAccess(pUser, ranges.data(), static_cast<uint32_t>(ranges.size())) ? 1 : 0);
+}
+
+uint8_t vload_ranges_indexed_unordered(
+	void* pV,
+	sv_mem_access pRead,
+	void* pUser,
+	uint16_t pVTYPE, uint8_t  pVm, uint16_t pEEW, uint8_t  pVd, uint8_t pVs2, uint16_t pVSTART, uint16_t pVLEN, uint16_t pVL, uint64_t pMSTART) {
+	return (vaccess_ranges_indexed(pV, pRead, pUser, false, pVTYPE, pVm, pEEW, pVd, pVs2, pVSTART, pVLEN, pVL, pMSTART));
+}
+
+uint8_t vload_ranges_indexed_ordered(
+	void* pV,
+	sv_mem_access pRead,
+	void* pUser,
+	uint16_t pVTYPE, uint8_t  pVm, uint16_t pEEW, uint8_t  pVd, uint8_t pVs2, uint16_t pVSTART, uint16_t pVLEN, uint16_t pVL, uint64_t pMSTART) {
+	return (vaccess_ranges_indexed(pV, pRead, pUser, true, pVTYPE, pVm, pEEW, pVd, pVs2, pVSTART, pVLEN, pVL, pMSTART));
+}
+
+uint8_t vstore_ranges_indexed_unordered(
+	void* pV,
+	sv_mem_access pWrite,
+	void* pUser,
+	uint16_t pVTYPE, uint8_t pVm, uint16_t pEEW, uint8_t pVd, uint8_t pVs2, uint16_t pVSTART, uint16_t pVLEN, uint16_t pVL, uint64_t pMSTART) {
+	return (vaccess_ranges_indexed(pV, pWrite, pUser, false, pVTYPE, pVm, pEEW, pVd, pVs2, pVSTART, pVLEN, pVL, pMSTART));
+}
+
+uint8_t vstore_ranges_indexed_ordered(
+	void* pV,
+	sv_mem_access pWrite,
+	void* pUser,
+	uint16_t pVTYPE, uint8_t pVm, uint16_t pEEW, uint8_t pVd, uint8_t pVs2, uint16_t pVSTART, uint16_t pVLEN, uint16_t pVL, uint64_t pMSTART) {
+	return (vaccess_ranges_indexed(pV, pWrite, pUser, true, pVTYPE, pVm, pEEW, pVd, pVs2, pVSTART, pVLEN, pVL, pMSTART));
+}
+
 /* Vector Arithmetic functions*/
 
 uint8_t vadd_vv(
@@ -298,9 +801,10 @@ uint8_t vadd_vv(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::add_vv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVs2, pVSTART, pVm);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::add_vv(V, pVd, pVs1, pVs2, pVSTART, pVm, _vt._ta, _vt._ma) ? 1 : 0);
 }
 
 uint8_t vadd_vi(
@@ -311,9 +815,10 @@ uint8_t vadd_vi(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::add_vi(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, pVimm, pVSTART, pVm);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::add_vi(V, pVd, pVs2, pVimm, pVSTART, pVm, _vt._ta, _vt._ma) ? 1 : 0);
 }
 
 uint8_t vadd_vx(
@@ -328,9 +833,10 @@ uint8_t vadd_vx(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pR))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pR)[pRs1*8]);
 
-	VARITH_INT::add_vx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::add_vx(V, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8, _vt._ta, _vt._ma) ? 1 : 0);
 }
 
 uint8_t vsub_vv(
@@ -341,9 +847,10 @@ uint8_t vsub_vv(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::sub_vv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVs2, pVSTART, pVm);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::sub_vv(V, pVd, pVs1, pVs2, pVSTART, pVm, _vt._ta, _vt._ma) ? 1 : 0);
 }
 
 uint8_t vsub_vx(
@@ -358,9 +865,10 @@ uint8_t vsub_vx(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pR))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pR)[pRs1*8]);
 
-	VARITH_INT::sub_vx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::sub_vx(V, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8, _vt._ta, _vt._ma) ? 1 : 0);
 }
 
 uint8_t vwaddu_vv(
@@ -371,9 +879,7 @@ uint8_t vwaddu_vv(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::wop_vv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVs2, pVSTART, pVm, true, false);
-
-	return (0);
+	return (VARITH_INT::wop_vv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVs2, pVSTART, pVm, true, false) ? 1 : 0);
 }
 
 uint8_t vwadd_vv(
@@ -384,9 +890,7 @@ uint8_t vwadd_vv(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::wop_vv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVs2, pVSTART, pVm, true, true);
-
-	return (0);
+	return (VARITH_INT::wop_vv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVs2, pVSTART, pVm, true, true) ? 1 : 0);
 }
 
 uint8_t vwsubu_vv(
@@ -397,9 +901,7 @@ uint8_t vwsubu_vv(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::wop_vv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVs2, pVSTART, pVm, false, false);
-
-	return (0);
+	return (VARITH_INT::wop_vv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVs2, pVSTART, pVm, false, false) ? 1 : 0);
 }
 
 uint8_t vwsub_vv(
@@ -410,9 +912,7 @@ uint8_t vwsub_vv(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::wop_vv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVs2, pVSTART, pVm, false, true);
-
-	return (0);
+	return (VARITH_INT::wop_vv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVs2, pVSTART, pVm, false, true) ? 1 : 0);
 }
 
 uint8_t vwaddu_vx(
@@ -427,9 +927,7 @@ uint8_t vwaddu_vx(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pR))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pR)[pRs1*8]);
 
-	VARITH_INT::wop_vx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, true, false, pXLEN/8);
-
-	return (0);
+	return (VARITH_INT::wop_vx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, true, false, pXLEN/8) ? 1 : 0);
 }
 
 uint8_t vwadd_vx(
@@ -444,9 +942,7 @@ uint8_t vwadd_vx(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pR))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pR)[pRs1*8]);
 
-	VARITH_INT::wop_vx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, true, true, pXLEN/8);
-
-	return (0);
+	return (VARITH_INT::wop_vx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, true, true, pXLEN/8) ? 1 : 0);
 }
 
 uint8_t vwsubu_vx(
@@ -461,9 +957,7 @@ uint8_t vwsubu_vx(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pR))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pR)[pRs1*8]);
 
-	VARITH_INT::wop_vx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, false, false, pXLEN/8);
-
-	return (0);
+	return (VARITH_INT::wop_vx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, false, false, pXLEN/8) ? 1 : 0);
 }
 
 uint8_t vwsub_vx(
@@ -478,9 +972,7 @@ uint8_t vwsub_vx(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pR))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pR)[pRs1*8]);
 
-	VARITH_INT::wop_vx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, false, true, pXLEN/8);
-
-	return (0);
+	return (VARITH_INT::wop_vx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, false, true, pXLEN/8) ? 1 : 0);
 }
 
 uint8_t vwaddu_w_vv(
@@ -491,9 +983,7 @@ uint8_t vwaddu_w_vv(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::wop_wv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVs2, pVSTART, pVm, true, false);
-
-	return (0);
+	return (VARITH_INT::wop_wv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVs2, pVSTART, pVm, true, false) ? 1 : 0);
 }
 
 uint8_t vwadd_w_vv(
@@ -504,9 +994,7 @@ uint8_t vwadd_w_vv(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::wop_wv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVs2, pVSTART, pVm, true, true);
-
-	return (0);
+	return (VARITH_INT::wop_wv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVs2, pVSTART, pVm, true, true) ? 1 : 0);
 }
 
 uint8_t vwsubu_w_vv(
@@ -517,9 +1005,7 @@ uint8_t vwsubu_w_vv(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::wop_wv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVs2, pVSTART, pVm, false, false);
-
-	return (0);
+	return (VARITH_INT::wop_wv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVs2, pVSTART, pVm, false, false) ? 1 : 0);
 }
 
 uint8_t vwsub_w_vv(
@@ -530,9 +1016,7 @@ uint8_t vwsub_w_vv(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::wop_wv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVs2, pVSTART, pVm, false, true);
-
-	return (0);
+	return (VARITH_INT::wop_wv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVs2, pVSTART, pVm, false, true) ? 1 : 0);
 }
 
 uint8_t vwaddu_w_vx(
@@ -547,9 +1031,7 @@ uint8_t vwaddu_w_vx(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pR))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pR)[pRs1*8]);
 
-	VARITH_INT::wop_wx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, true, false, pXLEN/8);
-
-	return (0);
+	return (VARITH_INT::wop_wx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, true, false, pXLEN/8) ? 1 : 0);
 }
 
 uint8_t vwadd_w_vx(
@@ -564,9 +1046,7 @@ uint8_t vwadd_w_vx(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pR))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pR)[pRs1*8]);
 
-	VARITH_INT::wop_wx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, true, true, pXLEN/8);
-
-	return (0);
+	return (VARITH_INT::wop_wx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, true, true, pXLEN/8) ? 1 : 0);
 }
 
 uint8_t vwsubu_w_vx(
@@ -581,9 +1061,7 @@ uint8_t vwsubu_w_vx(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pR))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pR)[pRs1*8]);
 
-	VARITH_INT::wop_wx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, false, false, pXLEN/8);
-
-	return (0);
+	return (VARITH_INT::wop_wx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, false, false, pXLEN/8) ? 1 : 0);
 }
 
 uint8_t vwsub_w_vx(
@@ -598,9 +1076,7 @@ uint8_t vwsub_w_vx(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pR))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pR)[pRs1*8]);
 
-	VARITH_INT::wop_wx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, false, true, pXLEN/8);
-
-	return (0);
+	return (VARITH_INT::wop_wx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, false, true, pXLEN/8) ? 1 : 0);
 }
 
 uint8_t vand_vv(
@@ -611,9 +1087,10 @@ uint8_t vand_vv(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::and_vv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVs2, pVSTART, pVm);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::and_vv(V, pVd, pVs1, pVs2, pVSTART, pVm, _vt._ta, _vt._ma) ? 1 : 0);
 }
 
 uint8_t vand_vi(
@@ -624,9 +1101,10 @@ uint8_t vand_vi(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::and_vi(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, pVimm, pVSTART, pVm);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::and_vi(V, pVd, pVs2, pVimm, pVSTART, pVm, _vt._ta, _vt._ma) ? 1 : 0);
 }
 
 uint8_t vand_vx(
@@ -641,9 +1119,10 @@ uint8_t vand_vx(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pR))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pR)[pRs1*8]);
 
-	VARITH_INT::and_vx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::and_vx(V, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8, _vt._ta, _vt._ma) ? 1 : 0);
 }
 
 uint8_t vor_vv(
@@ -654,9 +1133,10 @@ uint8_t vor_vv(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::or_vv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVs2, pVSTART, pVm);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::or_vv(V, pVd, pVs1, pVs2, pVSTART, pVm, _vt._ta, _vt._ma) ? 1 : 0);
 }
 
 uint8_t vor_vi(
@@ -667,9 +1147,10 @@ uint8_t vor_vi(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::or_vi(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, pVimm, pVSTART, pVm);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::or_vi(V, pVd, pVs2, pVimm, pVSTART, pVm, _vt._ta, _vt._ma) ? 1 : 0);
 }
 
 uint8_t vor_vx(
@@ -684,9 +1165,10 @@ uint8_t vor_vx(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pR))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pR)[pRs1*8]);
 
-	VARITH_INT::or_vx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::or_vx(V, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8, _vt._ta, _vt._ma) ? 1 : 0);
 }
 
 uint8_t vxor_vv(
@@ -697,9 +1179,10 @@ uint8_t vxor_vv(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::xor_vv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVs2, pVSTART, pVm);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::xor_vv(V, pVd, pVs1, pVs2, pVSTART, pVm, _vt._ta, _vt._ma) ? 1 : 0);
 }
 
 uint8_t vxor_vi(
@@ -710,9 +1193,10 @@ uint8_t vxor_vi(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::xor_vi(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, pVimm, pVSTART, pVm);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::xor_vi(V, pVd, pVs2, pVimm, pVSTART, pVm, _vt._ta, _vt._ma) ? 1 : 0);
 }
 
 uint8_t vxor_vx(
@@ -727,9 +1211,10 @@ uint8_t vxor_vx(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pR))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pR)[pRs1*8]);
 
-	VARITH_INT::xor_vx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::xor_vx(V, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8, _vt._ta, _vt._ma) ? 1 : 0);
 }
 
 uint8_t vsll_vv(
@@ -740,9 +1225,10 @@ uint8_t vsll_vv(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::sll_vv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVs2, pVSTART, pVm);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::sll_vv(V, pVd, pVs1, pVs2, pVSTART, pVm, _vt._ta, _vt._ma) ? 1 : 0);
 }
 
 uint8_t vsll_vi(
@@ -752,9 +1238,10 @@ uint8_t vsll_vi(
 	uint8_t* VectorRegField;
 
 	VectorRegField = static_cast<uint8_t*>(pV);
-	VARITH_INT::sll_vi(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, pVimm, pVSTART, pVm);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::sll_vi(V, pVd, pVs2, pVimm, pVSTART, pVm, _vt._ta, _vt._ma) ? 1 : 0);
 }
 
 uint8_t vsll_vx(
@@ -769,9 +1256,10 @@ uint8_t vsll_vx(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pR))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pR)[pRs1*8]);
 
-	VARITH_INT::sll_vx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::sll_vx(V, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8, _vt._ta, _vt._ma) ? 1 : 0);
 }
 
 uint8_t vsrl_vv(
@@ -782,9 +1270,10 @@ uint8_t vsrl_vv(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::srl_vv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVs2, pVSTART, pVm);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::srl_vv(V, pVd, pVs1, pVs2, pVSTART, pVm, _vt._ta, _vt._ma) ? 1 : 0);
 }
 
 uint8_t vsrl_vi(
@@ -795,9 +1284,10 @@ uint8_t vsrl_vi(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::srl_vi(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, pVimm, pVSTART, pVm);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::srl_vi(V, pVd, pVs2, pVimm, pVSTART, pVm, _vt._ta, _vt._ma) ? 1 : 0);
 }
 
 uint8_t vsrl_vx(
@@ -812,9 +1302,10 @@ uint8_t vsrl_vx(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pR))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pR)[pRs1*8]);
 
-	VARITH_INT::srl_vx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::srl_vx(V, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8, _vt._ta, _vt._ma) ? 1 : 0);
 }
 
 uint8_t vsra_vv(
@@ -825,9 +1316,10 @@ uint8_t vsra_vv(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::sra_vv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVs2, pVSTART, pVm);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::sra_vv(V, pVd, pVs1, pVs2, pVSTART, pVm, _vt._ta, _vt._ma) ? 1 : 0);
 }
 
 uint8_t vsra_vi(
@@ -838,9 +1330,10 @@ uint8_t vsra_vi(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::sra_vi(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, pVimm, pVSTART, pVm);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::sra_vi(V, pVd, pVs2, pVimm, pVSTART, pVm, _vt._ta, _vt._ma) ? 1 : 0);
 }
 
 uint8_t vsra_vx(
@@ -855,9 +1348,10 @@ uint8_t vsra_vx(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pR))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pR)[pRs1*8]);
 
-	VARITH_INT::sra_vx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::sra_vx(V, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8, _vt._ta, _vt._ma) ? 1 : 0);
 }
 
 uint8_t vmseq_vv(
@@ -868,9 +1362,10 @@ uint8_t vmseq_vv(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::mseq_vv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVs2, pVSTART, pVm);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::mseq_vv(V, pVd, pVs1, pVs2, pVSTART, pVm) ? 1 : 0);
 }
 
 uint8_t vmseq_vi(
@@ -881,9 +1376,10 @@ uint8_t vmseq_vi(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::mseq_vi(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, pVimm, pVSTART, pVm);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::mseq_vi(V, pVd, pVs2, pVimm, pVSTART, pVm) ? 1 : 0);
 }
 
 uint8_t vmseq_vx(
@@ -898,9 +1394,10 @@ uint8_t vmseq_vx(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pR))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pR)[pRs1*8]);
 
-	VARITH_INT::mseq_vx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::mseq_vx(V, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8) ? 1 : 0);
 }
 
 uint8_t vmsne_vv(
@@ -911,9 +1408,10 @@ uint8_t vmsne_vv(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::msne_vv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVs2, pVSTART, pVm);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::msne_vv(V, pVd, pVs1, pVs2, pVSTART, pVm) ? 1 : 0);
 }
 
 uint8_t vmsne_vi(
@@ -924,9 +1422,10 @@ uint8_t vmsne_vi(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::msne_vi(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, pVimm, pVSTART, pVm);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::msne_vi(V, pVd, pVs2, pVimm, pVSTART, pVm) ? 1 : 0);
 }
 
 uint8_t vmsne_vx(
@@ -941,9 +1440,10 @@ uint8_t vmsne_vx(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pR))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pR)[pRs1*8]);
 
-	VARITH_INT::msne_vx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::msne_vx(V, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8) ? 1 : 0);
 }
 
 uint8_t vmsltu_vv(
@@ -954,9 +1454,10 @@ uint8_t vmsltu_vv(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::msltu_vv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVs2, pVSTART, pVm);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::msltu_vv(V, pVd, pVs1, pVs2, pVSTART, pVm) ? 1 : 0);
 }
 
 uint8_t vmsltu_vx(
@@ -971,9 +1472,10 @@ uint8_t vmsltu_vx(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pR))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pR)[pRs1*8]);
 
-	VARITH_INT::msltu_vx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::msltu_vx(V, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8) ? 1 : 0);
 }
 
 uint8_t vmslt_vv(
@@ -984,9 +1486,10 @@ uint8_t vmslt_vv(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::mslt_vv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVs2, pVSTART, pVm);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::mslt_vv(V, pVd, pVs1, pVs2, pVSTART, pVm) ? 1 : 0);
 }
 
 uint8_t vmslt_vx(
@@ -1001,9 +1504,10 @@ uint8_t vmslt_vx(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pR))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pR)[pRs1*8]);
 
-	VARITH_INT::mslt_vx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::mslt_vx(V, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8) ? 1 : 0);
 }
 
 uint8_t vmsleu_vv(
@@ -1014,9 +1518,10 @@ uint8_t vmsleu_vv(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::msleu_vv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVs2, pVSTART, pVm);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::msleu_vv(V, pVd, pVs1, pVs2, pVSTART, pVm) ? 1 : 0);
 }
 
 uint8_t vmsleu_vi(
@@ -1027,9 +1532,10 @@ uint8_t vmsleu_vi(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::msleu_vi(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, pVimm, pVSTART, pVm);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::msleu_vi(V, pVd, pVs2, pVimm, pVSTART, pVm) ? 1 : 0);
 }
 
 uint8_t vmsleu_vx(
@@ -1044,9 +1550,10 @@ uint8_t vmsleu_vx(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pR))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pR)[pRs1*8]);
 
-	VARITH_INT::msleu_vx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::msleu_vx(V, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8) ? 1 : 0);
 }
 
 uint8_t vmsle_vv(
@@ -1057,9 +1564,10 @@ uint8_t vmsle_vv(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::msle_vv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVs2, pVSTART, pVm);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::msle_vv(V, pVd, pVs1, pVs2, pVSTART, pVm) ? 1 : 0);
 }
 
 uint8_t vmsle_vi(
@@ -1070,9 +1578,10 @@ uint8_t vmsle_vi(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::msle_vi(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, pVimm, pVSTART, pVm);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::msle_vi(V, pVd, pVs2, pVimm, pVSTART, pVm) ? 1 : 0);
 }
 
 uint8_t vmsle_vx(
@@ -1087,9 +1596,10 @@ uint8_t vmsle_vx(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pR))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pR)[pRs1*8]);
 
-	VARITH_INT::msle_vx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::msle_vx(V, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8) ? 1 : 0);
 }
 
 uint8_t vmsgtu_vv(
@@ -1100,9 +1610,10 @@ uint8_t vmsgtu_vv(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::msgtu_vv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVs2, pVSTART, pVm);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::msgtu_vv(V, pVd, pVs1, pVs2, pVSTART, pVm) ? 1 : 0);
 }
 
 uint8_t vmsgtu_vx(
@@ -1117,9 +1628,10 @@ uint8_t vmsgtu_vx(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pR))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pR)[pRs1*8]);
 
-	VARITH_INT::msgtu_vx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::msgtu_vx(V, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8) ? 1 : 0);
 }
 
 uint8_t vmsgt_vv(
@@ -1130,9 +1642,10 @@ uint8_t vmsgt_vv(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::msgt_vv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVs2, pVSTART, pVm);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::msgt_vv(V, pVd, pVs1, pVs2, pVSTART, pVm) ? 1 : 0);
 }
 
 uint8_t vmsgt_vx(
@@ -1147,9 +1660,10 @@ uint8_t vmsgt_vx(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pR))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pR)[pRs1*8]);
 
-	VARITH_INT::msgt_vx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::msgt_vx(V, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8) ? 1 : 0);
 }
 
 uint8_t vmv_vv(
@@ -1161,9 +1675,10 @@ uint8_t vmv_vv(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::mv_vv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVSTART);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::mv_vv(V, pVd, pVs1, pVSTART) ? 1 : 0);
 }
 
 uint8_t vmv_vi(
@@ -1175,9 +1690,10 @@ uint8_t vmv_vi(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::mv_vi(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVimm, pVSTART);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::mv_vi(V, pVd, pVimm, pVSTART) ? 1 : 0);
 }
 
 uint8_t vmv_vx(
@@ -1193,9 +1709,10 @@ uint8_t vmv_vx(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pR))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pR)[pRs1*8]);
 
-	VARITH_INT::mv_vx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, ScalarReg, pVSTART, pXLEN/8);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::mv_vx(V, pVd, ScalarReg, pVSTART, pXLEN/8) ? 1 : 0);
 }
 
 uint8_t vmv_xs(
@@ -1210,9 +1727,7 @@ uint8_t vmv_xs(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pR))[pRd*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pR)[pRd*8]);
 
-	VPERM::mv_xs(VectorRegField, _vt._sew / 8, pVL, pVLEN / 8, pVs2, ScalarReg, pXLEN/8);
-
-	return (0);
+	return (VPERM::mv_xs(VectorRegField, _vt._sew / 8, pVL, pVLEN / 8, pVs2, ScalarReg, pXLEN/8) ? 1 : 0);
 }
 
 uint8_t vmv_sx(
@@ -1227,9 +1742,7 @@ uint8_t vmv_sx(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pR))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pR)[pRs1*8]);
 
-	VPERM::mv_sx(VectorRegField, _vt._sew / 8, pVL, pVLEN / 8, pVd, ScalarReg, pVSTART, pXLEN/8);
-
-	return (0);
+	return (VPERM::mv_sx(VectorRegField, _vt._sew / 8, pVL, pVLEN / 8, pVd, ScalarReg, pVSTART, pXLEN/8) ? 1 : 0);
 }
 
 uint8_t vfmv_fs(
@@ -1244,9 +1757,7 @@ uint8_t vfmv_fs(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pF))[pRd*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pF)[pRd*8]);
 
-	VPERM::fmv_fs(VectorRegField, _vt._sew / 8, pVL, pVLEN / 8, pVs2, ScalarReg, pXLEN/8);
-
-	return (0);
+	return (VPERM::fmv_fs(VectorRegField, _vt._sew / 8, pVL, pVLEN / 8, pVs2, ScalarReg, pXLEN/8) ? 1 : 0);
 }
 
 uint8_t vfmv_sf(
@@ -1261,9 +1772,7 @@ uint8_t vfmv_sf(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pF))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pF)[pRs1*8]);
 
-	VPERM::fmv_sf(VectorRegField, _vt._sew / 8, pVL, pVLEN / 8, pVd, ScalarReg, pVSTART, pXLEN/8);
-
-	return (0);
+	return (VPERM::fmv_sf(VectorRegField, _vt._sew / 8, pVL, pVLEN / 8, pVd, ScalarReg, pVSTART, pXLEN/8) ? 1 : 0);
 }
 
 uint8_t vslideup_vx(
@@ -1278,9 +1787,7 @@ uint8_t vslideup_vx(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pR))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pR)[pRs1*8]);
 
-	VPERM::slideup_vx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8);
-
-	return (0);
+	return (VPERM::slideup_vx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8) ? 1 : 0);
 }
 
 uint8_t vslideup_vi(
@@ -1291,9 +1798,7 @@ uint8_t vslideup_vi(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VPERM::slideup_vi(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, pVimm, pVSTART, pVm);
-
-	return (0);
+	return (VPERM::slideup_vi(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, pVimm, pVSTART, pVm) ? 1 : 0);
 }
 
 uint8_t vslidedown_vx(
@@ -1308,9 +1813,7 @@ uint8_t vslidedown_vx(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pR))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pR)[pRs1*8]);
 
-	VPERM::slidedown_vx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8);
-
-	return (0);
+	return (VPERM::slidedown_vx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8) ? 1 : 0);
 }
 
 uint8_t vslidedown_vi(
@@ -1321,9 +1824,7 @@ uint8_t vslidedown_vi(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VPERM::slidedown_vi(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, pVimm, pVSTART, pVm);
-
-	return (0);
+	return (VPERM::slidedown_vi(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, pVimm, pVSTART, pVm) ? 1 : 0);
 }
 
 uint8_t vslide1up_vx(
@@ -1338,9 +1839,7 @@ uint8_t vslide1up_vx(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pR))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pR)[pRs1*8]);
 
-	VPERM::slide1up(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8);
-
-	return (0);
+	return (VPERM::slide1up(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8) ? 1 : 0);
 }
 
 uint8_t vfslide1up(
@@ -1355,9 +1854,7 @@ uint8_t vfslide1up(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pF))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pF)[pRs1*8]);
 
-	VPERM::fslide1up(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8);
-
-	return (0);
+	return (VPERM::fslide1up(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8) ? 1 : 0);
 }
 
 uint8_t vslide1down_vx(
@@ -1372,9 +1869,7 @@ uint8_t vslide1down_vx(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pR))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pR)[pRs1*8]);
 
-	VPERM::slide1down(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8);
-
-	return (0);
+	return (VPERM::slide1down(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8) ? 1 : 0);
 }
 
 uint8_t vfslide1down(
@@ -1389,9 +1884,7 @@ uint8_t vfslide1down(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pF))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pF)[pRs1*8]);
 
-	VPERM::fslide1down(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8);
-
-	return (0);
+	return (VPERM::fslide1down(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8) ? 1 : 0);
 }
 
 uint8_t vmul_vv(
@@ -1402,9 +1895,10 @@ uint8_t vmul_vv(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::vmul_vv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVs2, pVSTART, pVm);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::vmul_vv(V, pVd, pVs1, pVs2, pVSTART, pVm, _vt._ta, _vt._ma) ? 1 : 0);
 }
 
 uint8_t vmul_vx(
@@ -1419,9 +1913,10 @@ uint8_t vmul_vx(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pR))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pR)[pRs1*8]);
 
-	VARITH_INT::vmul_vx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::vmul_vx(V, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8, _vt._ta, _vt._ma) ? 1 : 0);
 }
 
 uint8_t vmulh_vv(
@@ -1432,9 +1927,10 @@ uint8_t vmulh_vv(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::vmulh_vv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVs2, pVSTART, pVm);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::vmulh_vv(V, pVd, pVs1, pVs2, pVSTART, pVm) ? 1 : 0);
 }
 
 uint8_t vmulh_vx(
@@ -1449,9 +1945,10 @@ uint8_t vmulh_vx(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pR))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pR)[pRs1*8]);
 
-	VARITH_INT::vmulh_vx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::vmulh_vx(V, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8) ? 1 : 0);
 }
 
 uint8_t vmulhu_vv(
@@ -1462,9 +1959,10 @@ uint8_t vmulhu_vv(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::vmulhu_vv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVs2, pVSTART, pVm);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::vmulhu_vv(V, pVd, pVs1, pVs2, pVSTART, pVm) ? 1 : 0);
 }
 
 uint8_t vmulhu_vx(
@@ -1479,9 +1977,10 @@ uint8_t vmulhu_vx(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pR))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pR)[pRs1*8]);
 
-	VARITH_INT::vmulhu_vx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::vmulhu_vx(V, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8) ? 1 : 0);
 }
 
 uint8_t vmulhsu_vv(
@@ -1492,9 +1991,10 @@ uint8_t vmulhsu_vv(
 
 	VectorRegField = static_cast<uint8_t*>(pV);
 
-	VARITH_INT::vmulhsu_vv(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs1, pVs2, pVSTART, pVm);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::vmulhsu_vv(V, pVd, pVs1, pVs2, pVSTART, pVm) ? 1 : 0);
 }
 uint8_t vmulhsu_vx(
 	void* pV,
@@ -1508,9 +2008,351 @@ uint8_t vmulhsu_vx(
 	if(pXLEN <= 32) ScalarReg = &((static_cast<uint8_t*>(pR))[pRs1*4]);
 	else ScalarReg = &(static_cast<uint8_t*>(pR)[pRs1*8]);
 
-	VARITH_INT::vmulhsu_vx(VectorRegField, _vt._z_lmul, _vt._n_lmul, _vt._sew / 8, pVL, pVLEN / 8, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8);
+	RVVRegField V(pVLEN, pVL, _vt._sew, SVMul(_vt._z_lmul, _vt._n_lmul), VectorRegField);
+	V.init();
 
-	return (0);
+	return (VARITH_INT::vmulhsu_vx(V, pVd, pVs2, ScalarReg, pVSTART, pVm, pXLEN/8) ? 1 : 0);
+}
+
+/* Vector Unit Context */
+
+sv_context* sv_context_create(void* pV, void* pR, uint16_t pVLEN, uint8_t pXLEN) {
+	return (new (std::nothrow) sv_context(static_cast<uint8_t*>(pV), static_cast<uint8_t*>(pR), pVLEN, pXLEN));
+}
+
+void sv_context_destroy(sv_context* ctx) {
+	delete ctx;
+}
+
+uint8_t sv_vadd_vv(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::add_vv(ctx->field(pVTYPE, pVL), pVd, pVs1, pVs2, pVSTART, pVm, VTYPE::extractTA(pVTYPE), VTYPE::extractMA(pVTYPE)) ? 1 : 0);
+}
+
+uint8_t sv_vadd_vi(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pVimm, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::add_vi(ctx->field(pVTYPE, pVL), pVd, pVs2, pVimm, pVSTART, pVm, VTYPE::extractTA(pVTYPE), VTYPE::extractMA(pVTYPE)) ? 1 : 0);
+}
+
+uint8_t sv_vadd_vx(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::add_vx(ctx->field(pVTYPE, pVL), pVd, pVs2, ctx->scalar_reg(pRs1), pVSTART, pVm, ctx->xlen_bytes(), VTYPE::extractTA(pVTYPE), VTYPE::extractMA(pVTYPE)) ? 1 : 0);
+}
+
+uint8_t sv_vsub_vv(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::sub_vv(ctx->field(pVTYPE, pVL), pVd, pVs1, pVs2, pVSTART, pVm, VTYPE::extractTA(pVTYPE), VTYPE::extractMA(pVTYPE)) ? 1 : 0);
+}
+
+uint8_t sv_vsub_vx(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::sub_vx(ctx->field(pVTYPE, pVL), pVd, pVs2, ctx->scalar_reg(pRs1), pVSTART, pVm, ctx->xlen_bytes(), VTYPE::extractTA(pVTYPE), VTYPE::extractMA(pVTYPE)) ? 1 : 0);
+}
+
+uint8_t sv_vand_vv(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::and_vv(ctx->field(pVTYPE, pVL), pVd, pVs1, pVs2, pVSTART, pVm, VTYPE::extractTA(pVTYPE), VTYPE::extractMA(pVTYPE)) ? 1 : 0);
+}
+
+uint8_t sv_vand_vi(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pVimm, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::and_vi(ctx->field(pVTYPE, pVL), pVd, pVs2, pVimm, pVSTART, pVm, VTYPE::extractTA(pVTYPE), VTYPE::extractMA(pVTYPE)) ? 1 : 0);
+}
+
+uint8_t sv_vand_vx(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::and_vx(ctx->field(pVTYPE, pVL), pVd, pVs2, ctx->scalar_reg(pRs1), pVSTART, pVm, ctx->xlen_bytes(), VTYPE::extractTA(pVTYPE), VTYPE::extractMA(pVTYPE)) ? 1 : 0);
+}
+
+uint8_t sv_vor_vv(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::or_vv(ctx->field(pVTYPE, pVL), pVd, pVs1, pVs2, pVSTART, pVm, VTYPE::extractTA(pVTYPE), VTYPE::extractMA(pVTYPE)) ? 1 : 0);
+}
+
+uint8_t sv_vor_vi(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pVimm, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::or_vi(ctx->field(pVTYPE, pVL), pVd, pVs2, pVimm, pVSTART, pVm, VTYPE::extractTA(pVTYPE), VTYPE::extractMA(pVTYPE)) ? 1 : 0);
+}
+
+uint8_t sv_vor_vx(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::or_vx(ctx->field(pVTYPE, pVL), pVd, pVs2, ctx->scalar_reg(pRs1), pVSTART, pVm, ctx->xlen_bytes(), VTYPE::extractTA(pVTYPE), VTYPE::extractMA(pVTYPE)) ? 1 : 0);
+}
+
+uint8_t sv_vxor_vv(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::xor_vv(ctx->field(pVTYPE, pVL), pVd, pVs1, pVs2, pVSTART, pVm, VTYPE::extractTA(pVTYPE), VTYPE::extractMA(pVTYPE)) ? 1 : 0);
+}
+
+uint8_t sv_vxor_vi(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pVimm, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::xor_vi(ctx->field(pVTYPE, pVL), pVd, pVs2, pVimm, pVSTART, pVm, VTYPE::extractTA(pVTYPE), VTYPE::extractMA(pVTYPE)) ? 1 : 0);
+}
+
+uint8_t sv_vxor_vx(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::xor_vx(ctx->field(pVTYPE, pVL), pVd, pVs2, ctx->scalar_reg(pRs1), pVSTART, pVm, ctx->xlen_bytes(), VTYPE::extractTA(pVTYPE), VTYPE::extractMA(pVTYPE)) ? 1 : 0);
+}
+
+uint8_t sv_vsll_vv(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::sll_vv(ctx->field(pVTYPE, pVL), pVd, pVs1, pVs2, pVSTART, pVm, VTYPE::extractTA(pVTYPE), VTYPE::extractMA(pVTYPE)) ? 1 : 0);
+}
+
+uint8_t sv_vsll_vi(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pVimm, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::sll_vi(ctx->field(pVTYPE, pVL), pVd, pVs2, pVimm, pVSTART, pVm, VTYPE::extractTA(pVTYPE), VTYPE::extractMA(pVTYPE)) ? 1 : 0);
+}
+
+uint8_t sv_vsll_vx(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::sll_vx(ctx->field(pVTYPE, pVL), pVd, pVs2, ctx->scalar_reg(pRs1), pVSTART, pVm, ctx->xlen_bytes(), VTYPE::extractTA(pVTYPE), VTYPE::extractMA(pVTYPE)) ? 1 : 0);
+}
+
+uint8_t sv_vsrl_vv(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::srl_vv(ctx->field(pVTYPE, pVL), pVd, pVs1, pVs2, pVSTART, pVm, VTYPE::extractTA(pVTYPE), VTYPE::extractMA(pVTYPE)) ? 1 : 0);
+}
+
+uint8_t sv_vsrl_vi(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pVimm, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::srl_vi(ctx->field(pVTYPE, pVL), pVd, pVs2, pVimm, pVSTART, pVm, VTYPE::extractTA(pVTYPE), VTYPE::extractMA(pVTYPE)) ? 1 : 0);
+}
+
+uint8_t sv_vsrl_vx(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::srl_vx(ctx->field(pVTYPE, pVL), pVd, pVs2, ctx->scalar_reg(pRs1), pVSTART, pVm, ctx->xlen_bytes(), VTYPE::extractTA(pVTYPE), VTYPE::extractMA(pVTYPE)) ? 1 : 0);
+}
+
+uint8_t sv_vsra_vv(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::sra_vv(ctx->field(pVTYPE, pVL), pVd, pVs1, pVs2, pVSTART, pVm, VTYPE::extractTA(pVTYPE), VTYPE::extractMA(pVTYPE)) ? 1 : 0);
+}
+
+uint8_t sv_vsra_vi(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pVimm, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::sra_vi(ctx->field(pVTYPE, pVL), pVd, pVs2, pVimm, pVSTART, pVm, VTYPE::extractTA(pVTYPE), VTYPE::extractMA(pVTYPE)) ? 1 : 0);
+}
+
+uint8_t sv_vsra_vx(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::sra_vx(ctx->field(pVTYPE, pVL), pVd, pVs2, ctx->scalar_reg(pRs1), pVSTART, pVm, ctx->xlen_bytes(), VTYPE::extractTA(pVTYPE), VTYPE::extractMA(pVTYPE)) ? 1 : 0);
+}
+
+uint8_t sv_vmseq_vv(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::mseq_vv(ctx->field(pVTYPE, pVL), pVd, pVs1, pVs2, pVSTART, pVm) ? 1 : 0);
+}
+
+uint8_t sv_vmseq_vi(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pVimm, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::mseq_vi(ctx->field(pVTYPE, pVL), pVd, pVs2, pVimm, pVSTART, pVm) ? 1 : 0);
+}
+
+uint8_t sv_vmseq_vx(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::mseq_vx(ctx->field(pVTYPE, pVL), pVd, pVs2, ctx->scalar_reg(pRs1), pVSTART, pVm, ctx->xlen_bytes()) ? 1 : 0);
+}
+
+uint8_t sv_vmsne_vv(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::msne_vv(ctx->field(pVTYPE, pVL), pVd, pVs1, pVs2, pVSTART, pVm) ? 1 : 0);
+}
+
+uint8_t sv_vmsne_vi(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pVimm, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::msne_vi(ctx->field(pVTYPE, pVL), pVd, pVs2, pVimm, pVSTART, pVm) ? 1 : 0);
+}
+
+uint8_t sv_vmsne_vx(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::msne_vx(ctx->field(pVTYPE, pVL), pVd, pVs2, ctx->scalar_reg(pRs1), pVSTART, pVm, ctx->xlen_bytes()) ? 1 : 0);
+}
+
+uint8_t sv_vmsltu_vv(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::msltu_vv(ctx->field(pVTYPE, pVL), pVd, pVs1, pVs2, pVSTART, pVm) ? 1 : 0);
+}
+
+uint8_t sv_vmsltu_vx(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::msltu_vx(ctx->field(pVTYPE, pVL), pVd, pVs2, ctx->scalar_reg(pRs1), pVSTART, pVm, ctx->xlen_bytes()) ? 1 : 0);
+}
+
+uint8_t sv_vmslt_vv(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::mslt_vv(ctx->field(pVTYPE, pVL), pVd, pVs1, pVs2, pVSTART, pVm) ? 1 : 0);
+}
+
+uint8_t sv_vmslt_vx(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::mslt_vx(ctx->field(pVTYPE, pVL), pVd, pVs2, ctx->scalar_reg(pRs1), pVSTART, pVm, ctx->xlen_bytes()) ? 1 : 0);
+}
+
+uint8_t sv_vmsleu_vv(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::msleu_vv(ctx->field(pVTYPE, pVL), pVd, pVs1, pVs2, pVSTART, pVm) ? 1 : 0);
+}
+
+uint8_t sv_vmsleu_vi(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pVimm, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::msleu_vi(ctx->field(pVTYPE, pVL), pVd, pVs2, pVimm, pVSTART, pVm) ? 1 : 0);
+}
+
+uint8_t sv_vmsleu_vx(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::msleu_vx(ctx->field(pVTYPE, pVL), pVd, pVs2, ctx->scalar_reg(pRs1), pVSTART, pVm, ctx->xlen_bytes()) ? 1 : 0);
+}
+
+uint8_t sv_vmsle_vv(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::msle_vv(ctx->field(pVTYPE, pVL), pVd, pVs1, pVs2, pVSTART, pVm) ? 1 : 0);
+}
+
+uint8_t sv_vmsle_vi(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pVimm, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::msle_vi(ctx->field(pVTYPE, pVL), pVd, pVs2, pVimm, pVSTART, pVm) ? 1 : 0);
+}
+
+uint8_t sv_vmsle_vx(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::msle_vx(ctx->field(pVTYPE, pVL), pVd, pVs2, ctx->scalar_reg(pRs1), pVSTART, pVm, ctx->xlen_bytes()) ? 1 : 0);
+}
+
+uint8_t sv_vmsgtu_vv(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::msgtu_vv(ctx->field(pVTYPE, pVL), pVd, pVs1, pVs2, pVSTART, pVm) ? 1 : 0);
+}
+
+uint8_t sv_vmsgtu_vx(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::msgtu_vx(ctx->field(pVTYPE, pVL), pVd, pVs2, ctx->scalar_reg(pRs1), pVSTART, pVm, ctx->xlen_bytes()) ? 1 : 0);
+}
+
+uint8_t sv_vmsgt_vv(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::msgt_vv(ctx->field(pVTYPE, pVL), pVd, pVs1, pVs2, pVSTART, pVm) ? 1 : 0);
+}
+
+uint8_t sv_vmsgt_vx(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::msgt_vx(ctx->field(pVTYPE, pVL), pVd, pVs2, ctx->scalar_reg(pRs1), pVSTART, pVm, ctx->xlen_bytes()) ? 1 : 0);
+}
+
+uint8_t sv_vmv_vv(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVd, uint8_t pVs1, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::mv_vv(ctx->field(pVTYPE, pVL), pVd, pVs1, pVSTART) ? 1 : 0);
+}
+
+uint8_t sv_vmv_vi(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVd, uint8_t pVimm, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::mv_vi(ctx->field(pVTYPE, pVL), pVd, pVimm, pVSTART) ? 1 : 0);
+}
+
+uint8_t sv_vmv_vx(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVd, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::mv_vx(ctx->field(pVTYPE, pVL), pVd, ctx->scalar_reg(pRs1), pVSTART, ctx->xlen_bytes()) ? 1 : 0);
+}
+
+uint8_t sv_vmul_vv(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::vmul_vv(ctx->field(pVTYPE, pVL), pVd, pVs1, pVs2, pVSTART, pVm, VTYPE::extractTA(pVTYPE), VTYPE::extractMA(pVTYPE)) ? 1 : 0);
+}
+
+uint8_t sv_vmul_vx(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::vmul_vx(ctx->field(pVTYPE, pVL), pVd, pVs2, ctx->scalar_reg(pRs1), pVSTART, pVm, ctx->xlen_bytes(), VTYPE::extractTA(pVTYPE), VTYPE::extractMA(pVTYPE)) ? 1 : 0);
+}
+
+uint8_t sv_vmulh_vv(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::vmulh_vv(ctx->field(pVTYPE, pVL), pVd, pVs1, pVs2, pVSTART, pVm) ? 1 : 0);
+}
+
+uint8_t sv_vmulh_vx(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::vmulh_vx(ctx->field(pVTYPE, pVL), pVd, pVs2, ctx->scalar_reg(pRs1), pVSTART, pVm, ctx->xlen_bytes()) ? 1 : 0);
+}
+
+uint8_t sv_vmulhu_vv(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::vmulhu_vv(ctx->field(pVTYPE, pVL), pVd, pVs1, pVs2, pVSTART, pVm) ? 1 : 0);
+}
+
+uint8_t sv_vmulhu_vx(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::vmulhu_vx(ctx->field(pVTYPE, pVL), pVd, pVs2, ctx->scalar_reg(pRs1), pVSTART, pVm, ctx->xlen_bytes()) ? 1 : 0);
+}
+
+uint8_t sv_vmulhsu_vv(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs1, uint8_t pVs2, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::vmulhsu_vv(ctx->field(pVTYPE, pVL), pVd, pVs1, pVs2, pVSTART, pVm) ? 1 : 0);
+}
+
+uint8_t sv_vmulhsu_vx(
+	sv_context* ctx,
+	uint16_t pVTYPE, uint8_t pVm, uint8_t pVd, uint8_t pVs2, uint8_t pRs1, uint16_t pVSTART, uint16_t pVL) {
+	return (VARITH_INT::vmulhsu_vx(ctx->field(pVTYPE, pVL), pVd, pVs2, ctx->scalar_reg(pRs1), pVSTART, pVm, ctx->xlen_bytes()) ? 1 : 0);
+}
+
+uint8_t sv_execute(sv_context* ctx, const sv_insn* insn) {
+	if ((insn->opcode >= SV_OPCODE_COUNT) || insn->vtype->vill) return 1;
+
+	const sv_plan& _plan = ctx->plan(*insn);
+	return (_plan.exec(_plan, ctx, *insn));
 }
 
 } // extern "C"
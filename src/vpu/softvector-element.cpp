@@ -20,30 +20,51 @@
 //////////////////////////////////////////////////////////////////////////////////////
 
 #include "vpu/softvector-types.hpp"
+#include "vpu/softvector-native.hpp"
+#include "vpu/softvector-limb.hpp"
+
+// Full width unsigned product. Lower and upper half are written to lo and hi, which must be zero initialized and not alias op1 or op2
+inline void u_mul_u(SVElement& lo, SVElement& hi, const SVElement& op1, const SVElement& op2) {
+	size_t size = lo.width_in_bits_ >> 3;
+
+	// SEW <= 32: product fits into a host word
+	if((lo.width_in_bits_ < 64) && SVNATIVE::dispatch(lo.width_in_bits_, [&](auto t) {
+		using T = decltype(t);
+		if constexpr (sizeof(T) < sizeof(uint64_t)) {
+			const uint64_t p = static_cast<uint64_t>(SVNATIVE::load<T>(op1.mem_)) * SVNATIVE::load<T>(op2.mem_);
+			SVNATIVE::store<T>(lo.mem_, static_cast<T>(p));
+			SVNATIVE::store<T>(hi.mem_, static_cast<T>(p >> (8*sizeof(T))));
+		}
+	})) return;
+	// SEW >= 64: 64x64->128 bit limb products
+	if(SVNATIVE::enabled && !(lo.width_in_bits_ % 64)) {
+		SVLIMB::mul(lo.mem_, hi.mem_, op1.mem_, op2.mem_, lo.width_in_bits_/64);
+		return;
+	}
 
-inline SVElement u_mul_u(const SVElement& target, const SVElement& op1, const SVElement& op2) {
-	size_t size = target.width_in_bits_ >> 3;
-	SVElement out(target.width_in_bits_ << 1);
+	auto out = [&](const size_t k) -> uint8_t& {
+		return((k < size) ? lo[k] : hi[k - size]);
+	};
 	uint16_t temp1 = 0;
 	uint8_t temp2 = 0;
 	uint16_t temp3 = 0;
 
-	for (int i = 0; i < size; i++) {
-		for (int j = 0; j < size; j++) {
+	for (size_t i = 0; i < size; i++) {
+		for (size_t j = 0; j < size; j++) {
 			temp1 = op1[i] * op2[j];
 
-			temp3 = (uint16_t)out[i + j] + temp1;
-			out[i + j] = (uint8_t)temp3;
+			temp3 = (uint16_t)out(i + j) + temp1;
+			out(i + j) = (uint8_t)temp3;
 
 			temp2 = (temp3 >> 8);
-			temp3 = (uint16_t)out[i + j + 1] + temp2;
-			out[i + j + 1] = (uint8_t)temp3;
+			temp3 = (uint16_t)out(i + j + 1) + temp2;
+			out(i + j + 1) = (uint8_t)temp3;
 
 			temp1 = (temp3 >> 8);
 
-			for (int k = i + j + 2 ; k < size * 2; k++) {
-				temp3 = out[k] + temp1;
-				out[k] = (uint8_t)temp3;
+			for (size_t k = i + j + 2 ; k < size * 2; k++) {
+				temp3 = out(k) + temp1;
+				out(k) = (uint8_t)temp3;
 				temp1 = (temp3 >> 8);
 				if(temp1 == 0) {
 					break;
@@ -51,53 +72,94 @@ inline SVElement u_mul_u(const SVElement& target, const SVElement& op1, const SV
 			}
 		}
 	}
-	return out;
 }
 
+// Shift amount is given by the lower log2(SEW) bits of rhs, i.e. at most 10 bits for SEW=1024
 inline size_t get_shiftamount(size_t target_width_bits, const uint8_t* rhs) {
-	size_t numberofbits = 0;
-	size_t shiftamount = 0;
-	while(target_width_bits) {
-		target_width_bits = target_width_bits >> 1;
-		shiftamount |= rhs[numberofbits/8] & (1 << numberofbits);
-		numberofbits++;
+	size_t shiftamount = rhs[0];
+	if(target_width_bits > 8) {
+		shiftamount |= static_cast<size_t>(rhs[1]) << 8;
 	}
-	return(shiftamount);
+	return(shiftamount & (target_width_bits - 1));
 }
 
 inline size_t get_shiftamount(size_t target_width_bits, uint64_t rhs) {
-	size_t numberofbits = 0;
-	size_t shiftamount = 0;
-	while(target_width_bits) {
-		target_width_bits = target_width_bits >> 1;
-		shiftamount |= rhs & (1 << numberofbits);
-		numberofbits++;
+	return(rhs & (target_width_bits - 1));
+}
+
+// Barrel shift on byte granularity: byte move followed by a sub-byte shift. dst may alias src.
+inline void arr_shift_left(uint8_t* dst, const uint8_t* src, size_t size, size_t amount) {
+	const size_t byte_shift = amount / 8;
+	const unsigned bit_shift = amount % 8;
+	for(size_t i = size; i-- > 0;) {
+		uint8_t v = 0;
+		if(i >= byte_shift) {
+			const size_t j = i - byte_shift;
+			v = src[j] << bit_shift;
+			if(bit_shift && j) {
+				v |= src[j-1] >> (8 - bit_shift);
+			}
+		}
+		dst[i] = v;
 	}
-	return(shiftamount);
 }
 
-inline uint8_t arr_shift_left(uint8_t* dat, size_t size) {
-		uint8_t cin = 0;
+inline void arr_shift_right(uint8_t* dst, const uint8_t* src, size_t size, size_t amount, bool arith = false) {
+	const uint8_t fill = (arith && (src[size-1] & 0x80)) ? 0xFF : 0x00;
+	const size_t byte_shift = amount / 8;
+	const unsigned bit_shift = amount % 8;
 	for(size_t i = 0; i < size; ++i) {
-			uint8_t cout = (dat[i] & 0x80) ? 0x1:0;
-			dat[i] = cin | (dat[i] << 1);
-			cin = cout;
+		const size_t j = i + byte_shift;
+		uint8_t v = fill;
+		if(j < size) {
+			const uint8_t hi = (j+1 < size) ? src[j+1] : fill;
+			v = src[j] >> bit_shift;
+			if(bit_shift) {
+				v |= hi << (8 - bit_shift);
+			}
 		}
-	return(cin);
+		dst[i] = v;
+	}
 }
 
-inline uint8_t arr_shift_right(uint8_t* dat, size_t size, bool arith = false) {
-	uint8_t msb = dat[size-1] & 0x80;
-	uint8_t cin = arith ? msb : 0;
-	for(int i = size -1; i >= 0 ; --i) {
-		uint8_t cout = (dat[i] & 0x01) ? 0x80 : 0;
-		dat[i] = cin | (dat[i] >> 1);
-		cin = cout;
+// Element shifts: native for standard SEWs, limb-wise for wide SEWs, byte-wise otherwise. amount has to be less than width_in_bits.
+inline void shift_left(size_t width_in_bits, uint8_t* dst, const uint8_t* src, size_t amount) {
+	if(SVNATIVE::dispatch(width_in_bits, [&](auto t) {
+		using T = decltype(t);
+		SVNATIVE::store<T>(dst, static_cast<T>(SVNATIVE::load<T>(src) << amount));
+	})) return;
+	if(SVLIMB::applicable(width_in_bits)) {
+		SVLIMB::shl(dst, src, width_in_bits/64, amount);
+		return;
 	}
-	return(cin);
+	arr_shift_left(dst, src, width_in_bits/8, amount);
+}
+
+inline void shift_right(size_t width_in_bits, uint8_t* dst, const uint8_t* src, size_t amount, bool arith) {
+	if(SVNATIVE::dispatch(width_in_bits, [&](auto t) {
+		using T = decltype(t);
+		using S = SVNATIVE::signed_t<T>;
+		if(arith)
+			SVNATIVE::store<T>(dst, static_cast<T>(static_cast<S>(SVNATIVE::load<T>(src)) >> amount));
+		else
+			SVNATIVE::store<T>(dst, static_cast<T>(SVNATIVE::load<T>(src) >> amount));
+	})) return;
+	if(SVLIMB::applicable(width_in_bits)) {
+		SVLIMB::shr(dst, src, width_in_bits/64, amount, arith);
+		return;
+	}
+	arr_shift_right(dst, src, width_in_bits/8, amount, arith);
 }
 
 SVElement& SVElement::operator=(const SVElement& rhs) {
+	if(SVNATIVE::dispatch(width_in_bits_, [&](auto t) {
+		using T = decltype(t);
+		SVNATIVE::store<T>(mem_, SVNATIVE::load<T>(rhs.mem_));
+	})) return (*this);
+	if(SVLIMB::applicable(width_in_bits_)) {
+		std::memmove(mem_, rhs.mem_, width_in_bits_/8);
+		return (*this);
+	}
 	for (size_t i_byte = 0; i_byte < width_in_bits_/8; ++i_byte) {
 		(*this)[i_byte] = rhs[i_byte];
 	}
@@ -105,6 +167,14 @@ SVElement& SVElement::operator=(const SVElement& rhs) {
 }
 
 SVElement& SVElement::operator=(const int64_t rhs) {
+	if(SVNATIVE::dispatch(width_in_bits_, [&](auto t) {
+		using T = decltype(t);
+		SVNATIVE::store<T>(mem_, static_cast<T>(rhs));
+	})) return (*this);
+	if(SVLIMB::applicable(width_in_bits_)) {
+		SVLIMB::assign(mem_, SVLIMB::imm(rhs), width_in_bits_/64);
+		return (*this);
+	}
 	for (size_t i_byte = 0; i_byte < width_in_bits_/8; ++i_byte) {
 		if(i_byte < 8) (*this)[i_byte] = 0xFF&(rhs >> 8*i_byte);
 		else (*this)[i_byte] = (rhs >= 0) ? 0 : 0xFF;
@@ -135,6 +205,14 @@ SVElement SVElement::operator--(int) {
 }
 
 void SVElement::twos_complement(void) {
+	if(SVNATIVE::dispatch(width_in_bits_, [&](auto t) {
+		using T = decltype(t);
+		SVNATIVE::store<T>(mem_, static_cast<T>(0) - SVNATIVE::load<T>(mem_));
+	})) return;
+	if(SVLIMB::applicable(width_in_bits_)) {
+		SVLIMB::sub(mem_, SVLIMB::imm(0), SVLIMB::mem(mem_), width_in_bits_/64);
+		return;
+	}
 
 	for(size_t i = 0; i < width_in_bits_/8; ++i)
 	{
@@ -145,164 +223,99 @@ void SVElement::twos_complement(void) {
 
 SVElement SVElement::operator+(const SVElement& rhs) const {
 	SVElement ret(width_in_bits_);
-	uint8_t carry = 0;
-	for (size_t i_byte = 0; i_byte < width_in_bits_/8; ++i_byte) {
-		uint16_t x = (*this)[i_byte] + rhs[i_byte] + carry;
-		carry = (x & (0xFF00)) ? 1 : 0;
-		ret[i_byte] = static_cast<uint8_t>(x);
-	}
-	return(ret);
+	return(ret.s_add(*this, rhs));
 }
 
 SVElement SVElement::operator+(const int64_t rhs) const {
 	SVElement ret(width_in_bits_);
-	uint8_t carry = 0;
-	for (size_t i_byte = 0; i_byte < width_in_bits_/8; ++i_byte) {
-		uint16_t x = 0;
-		if(i_byte < 8)  x = (*this)[i_byte] + (0xFF&(rhs >> 8*i_byte)) + carry;
-		else x = (*this)[i_byte] + ((rhs >= 0) ? 0 : 0xFF) + carry;
-		carry = (x&0xFF00)? 1 : 0;
-		ret[i_byte] = static_cast<uint8_t>(x);
-	}
-	return (ret);
+	return(ret.s_add(*this, rhs));
 }
 
 SVElement SVElement::operator-(const SVElement& rhs) const {
 	SVElement ret(width_in_bits_);
-	SVElement twos(rhs);
-	twos.twos_complement();
-	uint8_t carry = 0;
-	for (size_t i_byte = 0; i_byte < width_in_bits_/8; ++i_byte) {
-		uint16_t x = (*this)[i_byte] + twos[i_byte] + carry;
-		carry = (x & (0xFF00)) ? 1 : 0;
-		ret[i_byte] = static_cast<uint8_t>(x);
-	}
-	return(ret);
+	return(ret.s_sub(*this, rhs));
 }
 
 SVElement SVElement::operator-(const int64_t rhs) const {
 	SVElement ret(width_in_bits_);
-	SVElement twos(width_in_bits_);
-	twos = rhs;
-	return(*this - twos);
+	return(ret.s_sub(*this, rhs));
 }
 
 SVElement SVElement::operator&(const SVElement& rhs) const {
 	SVElement ret(width_in_bits_);
-	for (size_t i_byte = 0; i_byte < width_in_bits_/8; ++i_byte) {
-		uint16_t x = (*this)[i_byte] & rhs[i_byte];
-		ret[i_byte] = static_cast<uint8_t>(x);
-	}
-	return(ret);
+	return(ret.s_and(*this, rhs));
 }
 
 SVElement SVElement::operator&(const int64_t rhs) const {
 	SVElement ret(width_in_bits_);
-	for (size_t i_byte = 0; i_byte < width_in_bits_/8; ++i_byte) {
-		uint16_t x = 0;
-		if(i_byte < 8)  x = (*this)[i_byte] & (0xFF&(rhs >> 8*i_byte));
-		else x = (*this)[i_byte] & ((rhs >= 0) ? 0 : 0xFF);
-		ret[i_byte] = static_cast<uint8_t>(x);
-	}
-	return (ret);
+	return(ret.s_and(*this, rhs));
 }
 
 SVElement SVElement::operator|(const SVElement& rhs) const {
 	SVElement ret(width_in_bits_);
-	for (size_t i_byte = 0; i_byte < width_in_bits_/8; ++i_byte) {
-		uint16_t x = (*this)[i_byte] | rhs[i_byte];
-		ret[i_byte] = static_cast<uint8_t>(x);
-	}
-	return(ret);
+	return(ret.s_or(*this, rhs));
 }
 
 SVElement SVElement::operator|(const int64_t rhs) const {
 	SVElement ret(width_in_bits_);
-	for (size_t i_byte = 0; i_byte < width_in_bits_/8; ++i_byte) {
-		uint16_t x = 0;
-		if(i_byte < 8)  x = (*this)[i_byte] | (0xFF&(rhs >> 8*i_byte));
-		else x = (*this)[i_byte] | ((rhs >= 0) ? 0 : 0xFF);
-		ret[i_byte] = static_cast<uint8_t>(x);
-	}
-	return (ret);
+	return(ret.s_or(*this, rhs));
 }
 
 SVElement SVElement::operator^(const SVElement& rhs) const {
 	SVElement ret(width_in_bits_);
-	for (size_t i_byte = 0; i_byte < width_in_bits_/8; ++i_byte) {
-		uint16_t x = (*this)[i_byte] ^ rhs[i_byte];
-		ret[i_byte] = static_cast<uint8_t>(x);
-	}
-	return(ret);
+	return(ret.s_xor(*this, rhs));
 }
 
 SVElement SVElement::operator^(const int64_t rhs) const {
 	SVElement ret(width_in_bits_);
-	for (size_t i_byte = 0; i_byte < width_in_bits_/8; ++i_byte) {
-		uint16_t x = 0;
-		if(i_byte < 8)  x = (*this)[i_byte] ^ (0xFF&(rhs >> 8*i_byte));
-		else x = (*this)[i_byte] ^ ((rhs >= 0) ? 0 : 0xFF);
-		ret[i_byte] = static_cast<uint8_t>(x);
-	}
-	return (ret);
+	return(ret.s_xor(*this, rhs));
 }
 
 SVElement SVElement::operator<<(const SVElement& rhs) const {
-	SVElement ret(*this);
-	size_t shiftamount = get_shiftamount(width_in_bits_, &(rhs[0]));
-	while (shiftamount--) {
-		arr_shift_left(&(ret[0]), width_in_bits_/8);
-	}
+	SVElement ret(width_in_bits_);
+	shift_left(width_in_bits_, ret.mem_, mem_, get_shiftamount(width_in_bits_, rhs.mem_));
 	return(ret);
 }
 
 SVElement SVElement::operator<<(const uint64_t rhs) const {
-	SVElement ret(*this);
-	size_t shiftamount = get_shiftamount(width_in_bits_, rhs);
-		while (shiftamount--) {
-			arr_shift_left(&(ret[0]), width_in_bits_/8);
-		}
-		return(ret);
+	SVElement ret(width_in_bits_);
+	shift_left(width_in_bits_, ret.mem_, mem_, get_shiftamount(width_in_bits_, rhs));
+	return(ret);
 }
 
 SVElement SVElement::operator>>(const SVElement& rhs) const {
-	SVElement ret(*this);
-	size_t shiftamount = get_shiftamount(width_in_bits_, &(rhs[0]));
-		while (shiftamount--) {
-			arr_shift_right(&(ret[0]), width_in_bits_/8, true);
-		}
-		return(ret);
+	SVElement ret(width_in_bits_);
+	shift_right(width_in_bits_, ret.mem_, mem_, get_shiftamount(width_in_bits_, rhs.mem_), true);
+	return(ret);
 }
 
 SVElement SVElement::operator>>(const uint64_t rhs) const {
-	SVElement ret(*this);
-	size_t shiftamount = get_shiftamount(width_in_bits_, rhs);
-		while (shiftamount--) {
-			arr_shift_right(&(ret[0]), width_in_bits_/8, true);
-		}
-		return(ret);
+	SVElement ret(width_in_bits_);
+	shift_right(width_in_bits_, ret.mem_, mem_, get_shiftamount(width_in_bits_, rhs), true);
+	return(ret);
 }
 
 SVElement SVElement::srl(const SVElement& rhs) const {
-	SVElement ret(*this);
-	size_t shiftamount = get_shiftamount(width_in_bits_, &(rhs[0]));
-		while (shiftamount--) {
-			arr_shift_right(&(ret[0]), width_in_bits_/8, false);
-		}
-		return(ret);
+	SVElement ret(width_in_bits_);
+	shift_right(width_in_bits_, ret.mem_, mem_, get_shiftamount(width_in_bits_, rhs.mem_), false);
+	return(ret);
 }
 
 SVElement SVElement::srl(const uint64_t rhs) const {
-	SVElement ret(*this);
-	size_t shiftamount = get_shiftamount(width_in_bits_, rhs);
-		while (shiftamount--) {
-			arr_shift_right(&(ret[0]), width_in_bits_/8, false);
-		}
-		return(ret);
+	SVElement ret(width_in_bits_);
+	shift_right(width_in_bits_, ret.mem_, mem_, get_shiftamount(width_in_bits_, rhs), false);
+	return(ret);
 }
 
 bool SVElement::operator==(const SVElement& rhs) const {
 	bool ret = true;
+	if(SVNATIVE::dispatch(width_in_bits_, [&](auto t) {
+		using T = decltype(t);
+		ret = SVNATIVE::load<T>(mem_) == SVNATIVE::load<T>(rhs.mem_);
+	})) return (ret);
+	if(SVLIMB::applicable(width_in_bits_)) {
+		return (SVLIMB::cmp_u(SVLIMB::mem(mem_), SVLIMB::mem(rhs.mem_), width_in_bits_/64) == 0);
+	}
 	for (size_t i_byte = 0; i_byte < width_in_bits_/8; ++i_byte) {
 		if((*this)[i_byte] != rhs[i_byte] ) {
 			ret = false;
@@ -314,6 +327,13 @@ bool SVElement::operator==(const SVElement& rhs) const {
 
 bool SVElement::operator==(const int64_t rhs) const {
 	bool ret = true;
+	if(SVNATIVE::dispatch(width_in_bits_, [&](auto t) {
+		using T = decltype(t);
+		ret = SVNATIVE::load<T>(mem_) == static_cast<T>(rhs);
+	})) return (ret);
+	if(SVLIMB::applicable(width_in_bits_)) {
+		return (SVLIMB::cmp_u(SVLIMB::mem(mem_), SVLIMB::imm(rhs), width_in_bits_/64) == 0);
+	}
 	for (size_t i_byte = 0; i_byte < width_in_bits_/8; ++i_byte) {
 		uint8_t x = (i_byte < 8) ? (rhs >> i_byte*8) : ((rhs >= 0) ? 0x00 : 0xFF);
 		if(  (*this)[i_byte] != x ) {
@@ -332,108 +352,135 @@ bool SVElement::operator!=(const int64_t rhs) const {
 	return( !((*this)==rhs) );
 }
 
+int SVElement::compare(const size_t width_in_bits, const uint8_t* lhs, const uint8_t* rhs, const bool is_signed) {
+	int ret = 0;
+	if(SVNATIVE::dispatch(width_in_bits, [&](auto t) {
+		using T = decltype(t);
+		using S = SVNATIVE::signed_t<T>;
+		if(is_signed) {
+			const S a = SVNATIVE::load<S>(lhs), b = SVNATIVE::load<S>(rhs);
+			ret = (a > b) - (a < b);
+		} else {
+			const T a = SVNATIVE::load<T>(lhs), b = SVNATIVE::load<T>(rhs);
+			ret = (a > b) - (a < b);
+		}
+	})) return (ret);
+	if(SVLIMB::applicable(width_in_bits)) {
+		const size_t n = width_in_bits/64;
+		return(is_signed ? SVLIMB::cmp_s(SVLIMB::mem(lhs), SVLIMB::mem(rhs), n) : SVLIMB::cmp_u(SVLIMB::mem(lhs), SVLIMB::mem(rhs), n));
+	}
+	// most significant byte first, sign is taken into account by flipping the top bit
+	for (size_t i_byte = width_in_bits/8; i_byte-- > 0;) {
+		uint8_t a = lhs[i_byte], b = rhs[i_byte];
+		if(is_signed && (i_byte == width_in_bits/8 -1)) {
+			a ^= 0x80;
+			b ^= 0x80;
+		}
+		if(a != b) {
+			return((a < b) ? -1 : 1);
+		}
+	}
+	return (0);
+}
+
+// rhs is zero extended to element size
+inline void assign_unsigned(SVElement& dst, const uint64_t rhs) {
+	for (size_t i_byte = 0; (i_byte < 8) && (i_byte < dst.width_in_bits_/8); ++i_byte) {
+		dst[i_byte] = rhs >> 8*i_byte;
+	}
+}
+
 // signed comparisons
 bool SVElement::operator<(const SVElement& rhs) const {
-	SVElement x(*this);
-	x = *this - rhs;
-	if(x[x.width_in_bits_/8 -1] & 0x80) return(true);
-	else return(false);
+	return(compare(width_in_bits_, mem_, rhs.mem_, true) < 0);
 }
 
 bool SVElement::operator<(const int64_t rhs) const {
-	SVElement x(*this);
-	x = *this - rhs;
-	if(x[x.width_in_bits_/8 -1] & 0x80) return(true);
-	else return(false);
+	SVElement _rhs(width_in_bits_);
+	_rhs = rhs;
+	return(compare(width_in_bits_, mem_, _rhs.mem_, true) < 0);
 }
 
 bool SVElement::operator<=(const SVElement& rhs) const {
-	return (!(*this > rhs));
+	return(compare(width_in_bits_, mem_, rhs.mem_, true) <= 0);
 }
 bool SVElement::operator<=(const int64_t rhs) const {
-	return (!(*this > rhs));
+	SVElement _rhs(width_in_bits_);
+	_rhs = rhs;
+	return(compare(width_in_bits_, mem_, _rhs.mem_, true) <= 0);
 }
 
 bool SVElement::operator>(const SVElement& rhs) const {
-	return(rhs < *this);
+	return(compare(width_in_bits_, mem_, rhs.mem_, true) > 0);
 }
 
 bool SVElement::operator>(const int64_t rhs) const {
-	SVElement x(*this);
-	x = *this - rhs;
-	if(x[x.width_in_bits_/8 -1] & 0x80) return(false);
-	else return(true);
+	SVElement _rhs(width_in_bits_);
+	_rhs = rhs;
+	return(compare(width_in_bits_, mem_, _rhs.mem_, true) > 0);
 }
 
 bool SVElement::operator>=(const SVElement& rhs) const {
-	return (!(*this < rhs));
+	return(compare(width_in_bits_, mem_, rhs.mem_, true) >= 0);
 }
 
 bool SVElement::operator>=(const int64_t rhs) const {
-	return (!(*this < rhs));
+	SVElement _rhs(width_in_bits_);
+	_rhs = rhs;
+	return(compare(width_in_bits_, mem_, _rhs.mem_, true) >= 0);
 }
 
 // unsigned comparisons
 bool SVElement::op_u_lt(const SVElement& rhs) const {
-	bool ret = true;
-	for (int i_byte = width_in_bits_/8 -1; i_byte > 0 ; --i_byte) {
-		if(  (*this)[i_byte] > rhs[i_byte] ) {
-			ret = false;
-			break;
-		}
-	}
-	if((*this)[0] >= rhs[0]) ret = false;
-	return (ret);
+	return(compare(width_in_bits_, mem_, rhs.mem_, false) < 0);
 }
 
 bool SVElement::op_u_lt(const uint64_t rhs) const {
-	bool ret = true;
-	for (size_t i_byte = 0; i_byte < width_in_bits_/8; ++i_byte) {
-		uint8_t x = (i_byte < 8) ? (rhs >> i_byte*8) : 0;
-		if(  (*this)[i_byte] > x ) {
-			ret = false;
-			break;
-		}
-	}
-	if((*this)[0] >= (rhs&0xff)) ret = false;
-	return (ret);
+	SVElement _rhs(width_in_bits_);
+	assign_unsigned(_rhs, rhs);
+	return(compare(width_in_bits_, mem_, _rhs.mem_, false) < 0);
 }
 
 bool SVElement::op_u_lte(const SVElement& rhs) const {
-	return(!(this->op_u_gt(rhs)));
+	return(compare(width_in_bits_, mem_, rhs.mem_, false) <= 0);
 }
 bool SVElement::op_u_lte(const uint64_t rhs) const {
-	return(!(this->op_u_gt(rhs)));
+	SVElement _rhs(width_in_bits_);
+	assign_unsigned(_rhs, rhs);
+	return(compare(width_in_bits_, mem_, _rhs.mem_, false) <= 0);
 }
 
 bool SVElement::op_u_gt(const SVElement& rhs) const {
-	return (rhs.op_u_lt(*this));
+	return(compare(width_in_bits_, mem_, rhs.mem_, false) > 0);
 }
 
 bool SVElement::op_u_gt(const uint64_t rhs) const {
-	bool ret = true;
-	for (size_t i_byte = 0; i_byte < width_in_bits_/8; ++i_byte) {
-		uint8_t x = (i_byte < 8) ? (rhs >> i_byte*8) : 0;
-		if(  (*this)[i_byte] < x ) {
-			ret = false;
-			break;
-		}
-	}
-	if((*this)[0] <= (rhs&0xff)) ret = false;
-	return (ret);
+	SVElement _rhs(width_in_bits_);
+	assign_unsigned(_rhs, rhs);
+	return(compare(width_in_bits_, mem_, _rhs.mem_, false) > 0);
 }
 
 bool SVElement::op_u_gte(const SVElement& rhs) const {
-	return(!(this->op_u_lt(rhs)));
+	return(compare(width_in_bits_, mem_, rhs.mem_, false) >= 0);
 }
 bool SVElement::op_u_gte(const uint64_t rhs) const {
-	return(!(this->op_u_lt(rhs)));
+	SVElement _rhs(width_in_bits_);
+	assign_unsigned(_rhs, rhs);
+	return(compare(width_in_bits_, mem_, _rhs.mem_, false) >= 0);
 }
 
 
 
 
 SVElement& SVElement::s_add(const SVElement& opL, const SVElement& rhs) {
+	if(SVNATIVE::dispatch(width_in_bits_, [&](auto t) {
+		using T = decltype(t);
+		SVNATIVE::store<T>(mem_, SVNATIVE::load<T>(opL.mem_) + SVNATIVE::load<T>(rhs.mem_));
+	})) return(*this);
+	if(SVLIMB::applicable(width_in_bits_)) {
+		SVLIMB::add(mem_, SVLIMB::mem(opL.mem_), SVLIMB::mem(rhs.mem_), width_in_bits_/64);
+		return(*this);
+	}
 	uint8_t carry = 0;
 	for (size_t i_byte = 0; i_byte < width_in_bits_/8; ++i_byte) {
 		uint16_t x = opL[i_byte] + rhs[i_byte] + carry;
@@ -444,6 +491,14 @@ SVElement& SVElement::s_add(const SVElement& opL, const SVElement& rhs) {
 }
 
 SVElement& SVElement::s_add(const SVElement& opL, const int64_t rhs) {
+	if(SVNATIVE::dispatch(width_in_bits_, [&](auto t) {
+		using T = decltype(t);
+		SVNATIVE::store<T>(mem_, SVNATIVE::load<T>(opL.mem_) + static_cast<T>(rhs));
+	})) return(*this);
+	if(SVLIMB::applicable(width_in_bits_)) {
+		SVLIMB::add(mem_, SVLIMB::mem(opL.mem_), SVLIMB::imm(rhs), width_in_bits_/64);
+		return(*this);
+	}
 	uint8_t carry = 0;
 	for (size_t i_byte = 0; i_byte < width_in_bits_/8; ++i_byte) {
 		uint16_t x = 0;
@@ -457,90 +512,137 @@ SVElement& SVElement::s_add(const SVElement& opL, const int64_t rhs) {
 
 
 SVElement& SVElement::s_sub(const SVElement& opL, const SVElement& rhs) {
+	if(SVNATIVE::dispatch(width_in_bits_, [&](auto t) {
+		using T = decltype(t);
+		SVNATIVE::store<T>(mem_, SVNATIVE::load<T>(opL.mem_) - SVNATIVE::load<T>(rhs.mem_));
+	})) return(*this);
+	if(SVLIMB::applicable(width_in_bits_)) {
+		SVLIMB::sub(mem_, SVLIMB::mem(opL.mem_), SVLIMB::mem(rhs.mem_), width_in_bits_/64);
+		return(*this);
+	}
 	SVElement twos(rhs);
 	twos.twos_complement();
 	return(s_add(opL, twos));
 }
 
 SVElement& SVElement::s_sub(const SVElement& opL, const int64_t rhs) {
-	return(s_add(opL, (~rhs) +1));
+	if(SVNATIVE::dispatch(width_in_bits_, [&](auto t) {
+		using T = decltype(t);
+		SVNATIVE::store<T>(mem_, SVNATIVE::load<T>(opL.mem_) - static_cast<T>(rhs));
+	})) return(*this);
+	if(SVLIMB::applicable(width_in_bits_)) {
+		SVLIMB::sub(mem_, SVLIMB::mem(opL.mem_), SVLIMB::imm(rhs), width_in_bits_/64);
+		return(*this);
+	}
+	// negating rhs in 64 bit would overflow for INT64_MIN
+	SVElement _rhs(width_in_bits_);
+	_rhs = rhs;
+	return(s_sub(opL, _rhs));
 }
 
 SVElement& SVElement::s_rsub(const int64_t lhs, const SVElement& opR) {
+	if(SVNATIVE::dispatch(width_in_bits_, [&](auto t) {
+		using T = decltype(t);
+		SVNATIVE::store<T>(mem_, static_cast<T>(lhs) - SVNATIVE::load<T>(opR.mem_));
+	})) return(*this);
+	if(SVLIMB::applicable(width_in_bits_)) {
+		SVLIMB::sub(mem_, SVLIMB::imm(lhs), SVLIMB::mem(opR.mem_), width_in_bits_/64);
+		return(*this);
+	}
 	// this = lhs - opR = (-opR) + lhs (but slow)
 	SVElement twos(opR);
-	return(s_add(opR, lhs));
+	twos.twos_complement();
+	return(s_add(twos, lhs));
 }
 
-SVElement& SVElement::s_waddu(const SVElement& opL, const SVElement& rhs) {
-	uint8_t carry = 0;
-	for (size_t i_byte = 0; i_byte < width_in_bits_/8; ++i_byte) {
-		uint8_t _rhs = (i_byte < rhs.width_in_bits_) ? rhs[i_byte] : 0;
-		uint8_t _lhs = (i_byte < opL.width_in_bits_) ? opL[i_byte] : 0;
-		uint16_t x = _lhs + _rhs + carry;
-		carry = (x & (0xFF00)) ? 1 : 0;
-		(*this)[i_byte] = static_cast<uint8_t>(x);
+// Zero or sign extend src to the width of dst
+inline void extend(SVElement& dst, const SVElement& src, const bool sign) {
+	const size_t src_bytes = src.width_in_bits_/8;
+	const uint8_t fill = (sign && (src[src_bytes -1] & 0x80)) ? 0xFF : 0x00;
+	for (size_t i_byte = 0; i_byte < dst.width_in_bits_/8; ++i_byte) {
+		dst[i_byte] = (i_byte < src_bytes) ? src[i_byte] : fill;
 	}
-	return(*this);
 }
 
-SVElement& SVElement::s_waddu(const SVElement& opL, const int64_t rhs) {
-	uint8_t carry = 0;
-	for (size_t i_byte = 0; i_byte < width_in_bits_/8; ++i_byte) {
-		uint8_t _rhs = (i_byte < 8) ? (0xFF&(rhs >> 8*i_byte)) : 0;
-		uint8_t _lhs = (i_byte < opL.width_in_bits_) ? opL[i_byte] : 0;
-		uint16_t x = _lhs + _rhs + carry;
-		carry = (x&0xFF00)? 1 : 0;
-		(*this)[i_byte] = static_cast<uint8_t>(x);
+// Truncate a scalar to SEW, i.e. half the width of dst, then zero or sign extend it to the width of dst
+inline void extend(SVElement& dst, const int64_t src, const bool sign) {
+	const size_t sew = dst.width_in_bits_/2;
+	uint64_t val = static_cast<uint64_t>(src);
+	if(sew < 64) {
+		val &= (1ULL << sew) -1;
+		if(sign && ((val >> (sew -1)) & 1)) val |= ~((1ULL << sew) -1);
 	}
-	return (*this);
+	const uint8_t fill = (sign && (val >> 63)) ? 0xFF : 0x00;
+	for (size_t i_byte = 0; i_byte < dst.width_in_bits_/8; ++i_byte) {
+		dst[i_byte] = (i_byte < 8) ? (0xFF&(val >> 8*i_byte)) : fill;
+	}
+}
+
+SVElement& SVElement::s_waddu(const SVElement& opL, const SVElement& rhs) {
+	SVElement _lhs(width_in_bits_), _rhs(width_in_bits_);
+	extend(_lhs, opL, false);
+	extend(_rhs, rhs, false);
+	return(s_add(_lhs, _rhs));
+}
+
+SVElement& SVElement::s_waddu(const SVElement& opL, const int64_t rhs) {
+	SVElement _lhs(width_in_bits_), _rhs(width_in_bits_);
+	extend(_lhs, opL, false);
+	extend(_rhs, rhs, false);
+	return(s_add(_lhs, _rhs));
 }
 
 SVElement& SVElement::s_wsubu(const SVElement& opL, const SVElement& rhs) {
-	SVElement twos(rhs);
-	twos.twos_complement();
-	return(s_waddu(opL, twos));
+	SVElement _lhs(width_in_bits_), _rhs(width_in_bits_);
+	extend(_lhs, opL, false);
+	extend(_rhs, rhs, false);
+	return(s_sub(_lhs, _rhs));
 }
 
 SVElement& SVElement::s_wsubu(const SVElement& opL, const int64_t rhs) {
-	return(s_waddu(opL, (~rhs) +1));
+	SVElement _lhs(width_in_bits_), _rhs(width_in_bits_);
+	extend(_lhs, opL, false);
+	extend(_rhs, rhs, false);
+	return(s_sub(_lhs, _rhs));
 }
 
 SVElement& SVElement::s_wadd(const SVElement& opL, const SVElement& rhs) {
-	uint8_t carry = 0;
-	for (size_t i_byte = 0; i_byte < width_in_bits_/8; ++i_byte) {
-		uint8_t _rhs = (i_byte < rhs.width_in_bits_) ? rhs[i_byte] : (rhs[opL.width_in_bits_/8 -1] & 0x80) ? 0xFF : 0x00;
-		uint8_t _lhs = (i_byte < opL.width_in_bits_) ? opL[i_byte] : (opL[opL.width_in_bits_/8 -1] & 0x80) ? 0xFF : 0x00;
-		uint16_t x = _lhs + _rhs + carry;
-		carry = (x & (0xFF00)) ? 1 : 0;
-		(*this)[i_byte] = static_cast<uint8_t>(x);
-	}
-	return(*this);
+	SVElement _lhs(width_in_bits_), _rhs(width_in_bits_);
+	extend(_lhs, opL, true);
+	extend(_rhs, rhs, true);
+	return(s_add(_lhs, _rhs));
 }
 
 SVElement& SVElement::s_wadd(const SVElement& opL, const int64_t rhs) {
-	uint8_t carry = 0;
-	for (size_t i_byte = 0; i_byte < width_in_bits_/8; ++i_byte) {
-		uint8_t _rhs = (i_byte < 8) ? (0xFF&(rhs >> 8*i_byte)) : ((rhs >= 0) ? 0 : 0xFF);
-		uint8_t _lhs = (i_byte < opL.width_in_bits_) ? opL[i_byte] : (opL[opL.width_in_bits_/8 -1] & 0x80) ? 0xFF : 0x00;
-		uint16_t x = _lhs + _rhs + carry;
-		carry = (x&0xFF00)? 1 : 0;
-		(*this)[i_byte] = static_cast<uint8_t>(x);
-	}
-	return (*this);
+	SVElement _lhs(width_in_bits_), _rhs(width_in_bits_);
+	extend(_lhs, opL, true);
+	extend(_rhs, rhs, true);
+	return(s_add(_lhs, _rhs));
 }
 
 SVElement& SVElement::s_wsub(const SVElement& opL, const SVElement& rhs) {
-	SVElement twos(rhs);
-	twos.twos_complement();
-	return(s_wadd(opL, twos));
+	SVElement _lhs(width_in_bits_), _rhs(width_in_bits_);
+	extend(_lhs, opL, true);
+	extend(_rhs, rhs, true);
+	return(s_sub(_lhs, _rhs));
 }
 
 SVElement& SVElement::s_wsub(const SVElement& opL, const int64_t rhs) {
-	return(s_wadd(opL, (~rhs) +1));
+	SVElement _lhs(width_in_bits_), _rhs(width_in_bits_);
+	extend(_lhs, opL, true);
+	extend(_rhs, rhs, true);
+	return(s_sub(_lhs, _rhs));
 }
 
 SVElement& SVElement::s_and(const SVElement& opL, const SVElement& rhs) {
+	if(SVNATIVE::dispatch(width_in_bits_, [&](auto t) {
+		using T = decltype(t);
+		SVNATIVE::store<T>(mem_, SVNATIVE::load<T>(opL.mem_) & SVNATIVE::load<T>(rhs.mem_));
+	})) return(*this);
+	if(SVLIMB::applicable(width_in_bits_)) {
+		SVLIMB::bitwise(mem_, SVLIMB::mem(opL.mem_), SVLIMB::mem(rhs.mem_), width_in_bits_/64, [](uint64_t a, uint64_t b) { return(a & b); });
+		return(*this);
+	}
 	for (size_t i_byte = 0; i_byte < width_in_bits_/8; ++i_byte) {
 		(*this)[i_byte] = opL[i_byte] & rhs[i_byte];
 	}
@@ -548,6 +650,14 @@ SVElement& SVElement::s_and(const SVElement& opL, const SVElement& rhs) {
 }
 
 SVElement& SVElement::s_and(const SVElement& opL, const int64_t rhs) {
+	if(SVNATIVE::dispatch(width_in_bits_, [&](auto t) {
+		using T = decltype(t);
+		SVNATIVE::store<T>(mem_, SVNATIVE::load<T>(opL.mem_) & static_cast<T>(rhs));
+	})) return(*this);
+	if(SVLIMB::applicable(width_in_bits_)) {
+		SVLIMB::bitwise(mem_, SVLIMB::mem(opL.mem_), SVLIMB::imm(rhs), width_in_bits_/64, [](uint64_t a, uint64_t b) { return(a & b); });
+		return(*this);
+	}
 	for (size_t i_byte = 0; i_byte < width_in_bits_/8; ++i_byte) {
 		if(i_byte < 8)
 			(*this)[i_byte] = opL[i_byte] & (0xFF&(rhs >> 8*i_byte));
@@ -558,6 +668,14 @@ SVElement& SVElement::s_and(const SVElement& opL, const int64_t rhs) {
 }
 
 SVElement& SVElement::s_or(const SVElement& opL, const SVElement& rhs) {
+	if(SVNATIVE::dispatch(width_in_bits_, [&](auto t) {
+		using T = decltype(t);
+		SVNATIVE::store<T>(mem_, SVNATIVE::load<T>(opL.mem_) | SVNATIVE::load<T>(rhs.mem_));
+	})) return(*this);
+	if(SVLIMB::applicable(width_in_bits_)) {
+		SVLIMB::bitwise(mem_, SVLIMB::mem(opL.mem_), SVLIMB::mem(rhs.mem_), width_in_bits_/64, [](uint64_t a, uint64_t b) { return(a | b); });
+		return(*this);
+	}
 	for (size_t i_byte = 0; i_byte < width_in_bits_/8; ++i_byte) {
 		(*this)[i_byte] = opL[i_byte] | rhs[i_byte];
 	}
@@ -565,6 +683,14 @@ SVElement& SVElement::s_or(const SVElement& opL, const SVElement& rhs) {
 }
 
 SVElement& SVElement::s_or(const SVElement& opL, const int64_t rhs) {
+	if(SVNATIVE::dispatch(width_in_bits_, [&](auto t) {
+		using T = decltype(t);
+		SVNATIVE::store<T>(mem_, SVNATIVE::load<T>(opL.mem_) | static_cast<T>(rhs));
+	})) return(*this);
+	if(SVLIMB::applicable(width_in_bits_)) {
+		SVLIMB::bitwise(mem_, SVLIMB::mem(opL.mem_), SVLIMB::imm(rhs), width_in_bits_/64, [](uint64_t a, uint64_t b) { return(a | b); });
+		return(*this);
+	}
 	for (size_t i_byte = 0; i_byte < width_in_bits_/8; ++i_byte) {
 		if(i_byte < 8)
 			(*this)[i_byte] = opL[i_byte] | (0xFF&(rhs >> 8*i_byte));
@@ -575,6 +701,14 @@ SVElement& SVElement::s_or(const SVElement& opL, const int64_t rhs) {
 }
 
 SVElement& SVElement::s_xor(const SVElement& opL, const SVElement& rhs) {
+	if(SVNATIVE::dispatch(width_in_bits_, [&](auto t) {
+		using T = decltype(t);
+		SVNATIVE::store<T>(mem_, SVNATIVE::load<T>(opL.mem_) ^ SVNATIVE::load<T>(rhs.mem_));
+	})) return(*this);
+	if(SVLIMB::applicable(width_in_bits_)) {
+		SVLIMB::bitwise(mem_, SVLIMB::mem(opL.mem_), SVLIMB::mem(rhs.mem_), width_in_bits_/64, [](uint64_t a, uint64_t b) { return(a ^ b); });
+		return(*this);
+	}
 	for (size_t i_byte = 0; i_byte < width_in_bits_/8; ++i_byte) {
 		(*this)[i_byte] = opL[i_byte] ^ rhs[i_byte];
 	}
@@ -582,6 +716,14 @@ SVElement& SVElement::s_xor(const SVElement& opL, const SVElement& rhs) {
 }
 
 SVElement& SVElement::s_xor(const SVElement& opL, const int64_t rhs) {
+	if(SVNATIVE::dispatch(width_in_bits_, [&](auto t) {
+		using T = decltype(t);
+		SVNATIVE::store<T>(mem_, SVNATIVE::load<T>(opL.mem_) ^ static_cast<T>(rhs));
+	})) return(*this);
+	if(SVLIMB::applicable(width_in_bits_)) {
+		SVLIMB::bitwise(mem_, SVLIMB::mem(opL.mem_), SVLIMB::imm(rhs), width_in_bits_/64, [](uint64_t a, uint64_t b) { return(a ^ b); });
+		return(*this);
+	}
 	for (size_t i_byte = 0; i_byte < width_in_bits_/8; ++i_byte) {
 		if(i_byte < 8)
 			(*this)[i_byte] = opL[i_byte] ^ (0xFF&(rhs >> 8*i_byte));
@@ -592,90 +734,42 @@ SVElement& SVElement::s_xor(const SVElement& opL, const int64_t rhs) {
 }
 
 SVElement& SVElement::s_sll(const SVElement& opL, const SVElement& rhs) {
-	if(*this != opL)
-		*this = opL;
-	size_t shiftamount = get_shiftamount(width_in_bits_, &(rhs[0]));
-	while (shiftamount--) {
-		arr_shift_left(mem_, width_in_bits_/8);
-	}
+	shift_left(width_in_bits_, mem_, opL.mem_, get_shiftamount(width_in_bits_, rhs.mem_));
 	return(*this);
 }
 
 SVElement& SVElement::s_sll(const SVElement& opL, const uint64_t rhs) {
-	if(*this != opL)
-		*this = opL;
-	size_t shiftamount = get_shiftamount(width_in_bits_, rhs);
-	while (shiftamount--) {
-		arr_shift_left(mem_, width_in_bits_/8);
-	}
+	shift_left(width_in_bits_, mem_, opL.mem_, get_shiftamount(width_in_bits_, rhs));
 	return(*this);
 }
 
 SVElement& SVElement::s_sra(const SVElement& opL, const SVElement& rhs) {
-	if(*this != opL)
-		*this = opL;
-	size_t shiftamount = get_shiftamount(width_in_bits_, &(rhs[0]));
-	while (shiftamount--) {
-		arr_shift_right(mem_, width_in_bits_/8, true);
-	}
+	shift_right(width_in_bits_, mem_, opL.mem_, get_shiftamount(width_in_bits_, rhs.mem_), true);
 	return(*this);
 }
 
 SVElement& SVElement::s_sra(const SVElement& opL, const uint64_t rhs) {
-	if(*this != opL)
-		*this = opL;
-	size_t shiftamount = get_shiftamount(width_in_bits_, rhs);
-	while (shiftamount--) {
-		arr_shift_right(mem_, width_in_bits_/8, true);
-	}
+	shift_right(width_in_bits_, mem_, opL.mem_, get_shiftamount(width_in_bits_, rhs), true);
 	return(*this);
 }
 
 SVElement& SVElement::s_srl(const SVElement& opL, const SVElement& rhs) {
-	if(*this != opL)
-		*this = opL;
-	size_t shiftamount = get_shiftamount(width_in_bits_, &(rhs[0]));
-	while (shiftamount--) {
-		arr_shift_right(mem_, width_in_bits_/8, false);
-	}
+	shift_right(width_in_bits_, mem_, opL.mem_, get_shiftamount(width_in_bits_, rhs.mem_), false);
 	return(*this);
 }
 
 SVElement& SVElement::s_srl(const SVElement& opL, const uint64_t rhs) {
-	if(*this != opL)
-		*this = opL;
-	size_t shiftamount = get_shiftamount(width_in_bits_, rhs);
-	while (shiftamount--) {
-		arr_shift_right(mem_, width_in_bits_/8, false);
-	}
+	shift_right(width_in_bits_, mem_, opL.mem_, get_shiftamount(width_in_bits_, rhs), false);
 	return(*this);
 }
 
 //MUL 12.10
 ///////////////////////////////////////////////////////////////////////////////////////////
 SVElement& SVElement::s_ssmul(const SVElement& opL, const SVElement &rhs) {
-	SVElement _op1(opL);
-	SVElement _op2(rhs);
-
-	bool op1_neg = _op1 < 0;
-	bool op2_neg = _op2 < 0;
-
-	if(op1_neg)
-		_op1.twos_complement();
-
-	if(op2_neg)
-		_op2.twos_complement();
-
-	auto x = u_mul_u(*this, _op1, _op2);
-
-	if ( (op1_neg && !op2_neg)
-		||
-		(!op1_neg && op2_neg)
-	) {
-		x.twos_complement();
-	}
-
-	*this = x;
+	// lower half of the product does not depend on signedness
+	SVElement lo(width_in_bits_), hi(width_in_bits_);
+	u_mul_u(lo, hi, opL, rhs);
+	*this = lo;
 
 	return (*this);
 }
@@ -686,47 +780,59 @@ SVElement& SVElement::s_ssmul(const SVElement& opL, const int64_t rhs) {
 	return(this->s_ssmul(opL, _op2));
 }
 
+// Signed upper halves are derived from the unsigned product:
+// hi_s(a,b) = hi_u(a,b) - (a < 0 ? b : 0) - (b < 0 ? a : 0)  (mod 2^SEW)
 SVElement& SVElement::s_ssmulh(const SVElement& opL, const SVElement &rhs) {
-	SVElement _op1(opL);
-	SVElement _op2(rhs);
+	if(SVNATIVE::enabled && (width_in_bits_ == 64)) {
+		SVNATIVE::store<int64_t>(mem_, SVNATIVE::mulh_ss(SVNATIVE::load<int64_t>(opL.mem_), SVNATIVE::load<int64_t>(rhs.mem_)));
+		return (*this);
+	}
 
-	bool op1_neg = _op1 < 0;
-	bool op2_neg = _op2 < 0;
+	bool op1_neg = opL < 0;
+	bool op2_neg = rhs < 0;
+
+	SVElement lo(width_in_bits_), hi(width_in_bits_);
+	u_mul_u(lo, hi, opL, rhs);
 
 	if(op1_neg)
-		_op1.twos_complement();
+		hi.s_sub(hi, rhs);
 
 	if(op2_neg)
-		_op2.twos_complement();
+		hi.s_sub(hi, opL);
 
-	auto x = u_mul_u(*this, _op1, _op2);
-
-	if ( (op1_neg && !op2_neg)
-		||
-		(!op1_neg && op2_neg)
-	) {
-		x.twos_complement();
-	}
-
-	*this = x >> width_in_bits_;
+	*this = hi;
 
 	return (*this);
 }
 
 SVElement& SVElement::s_ssmulh(const SVElement& opL, const int64_t rhs) {
+	if(SVNATIVE::enabled && (width_in_bits_ == 64)) {
+		SVNATIVE::store<int64_t>(mem_, SVNATIVE::mulh_ss(SVNATIVE::load<int64_t>(opL.mem_), rhs));
+		return (*this);
+	}
 	SVElement _op2(opL.width_in_bits_);
 	_op2 = rhs;
 	return(this->s_ssmulh(opL, _op2));
 }
 
 SVElement& SVElement::s_uumulh(const SVElement& opL, const SVElement &rhs) {
-	auto x = u_mul_u(*this, opL, rhs);
-	*this = x >> width_in_bits_;
+	if(SVNATIVE::enabled && (width_in_bits_ == 64)) {
+		SVNATIVE::store<uint64_t>(mem_, SVNATIVE::mulh_uu(SVNATIVE::load<uint64_t>(opL.mem_), SVNATIVE::load<uint64_t>(rhs.mem_)));
+		return (*this);
+	}
+
+	SVElement lo(width_in_bits_), hi(width_in_bits_);
+	u_mul_u(lo, hi, opL, rhs);
+	*this = hi;
 
 	return (*this);
 }
 
 SVElement& SVElement::s_uumulh(const SVElement& opL, const int64_t rhs) {
+	if(SVNATIVE::enabled && (width_in_bits_ == 64)) {
+		SVNATIVE::store<uint64_t>(mem_, SVNATIVE::mulh_uu(SVNATIVE::load<uint64_t>(opL.mem_), static_cast<uint64_t>(rhs)));
+		return (*this);
+	}
 	SVElement _op2(opL.width_in_bits_);
 	_op2 = rhs;
 
@@ -734,22 +840,29 @@ SVElement& SVElement::s_uumulh(const SVElement& opL, const int64_t rhs) {
 }
 
 SVElement& SVElement::s_sumulh(const SVElement& opL, const SVElement &rhs) {
-	SVElement _op1(opL);
-	bool op1_neg = _op1 < 0;
-	if(op1_neg)
-		_op1.twos_complement();
+	if(SVNATIVE::enabled && (width_in_bits_ == 64)) {
+		SVNATIVE::store<int64_t>(mem_, SVNATIVE::mulh_su(SVNATIVE::load<int64_t>(opL.mem_), SVNATIVE::load<uint64_t>(rhs.mem_)));
+		return (*this);
+	}
 
-	auto x = u_mul_u(*this, _op1, rhs);
+	bool op1_neg = opL < 0;
+
+	SVElement lo(width_in_bits_), hi(width_in_bits_);
+	u_mul_u(lo, hi, opL, rhs);
 
 	if(op1_neg)
-		x.twos_complement();
+		hi.s_sub(hi, rhs);
 
-	*this = x >> width_in_bits_;
+	*this = hi;
 
 	return (*this);
 }
 
 SVElement& SVElement::s_sumulh(const SVElement& opL, const int64_t rhs) {
+	if(SVNATIVE::enabled && (width_in_bits_ == 64)) {
+		SVNATIVE::store<int64_t>(mem_, SVNATIVE::mulh_su(SVNATIVE::load<int64_t>(opL.mem_), static_cast<uint64_t>(rhs)));
+		return (*this);
+	}
 	SVElement _op2(opL.width_in_bits_);
 	_op2 = rhs;
 
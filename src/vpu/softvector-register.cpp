@@ -20,6 +20,77 @@
 //////////////////////////////////////////////////////////////////////////////////////
 
 #include "vpu/softvector-types.hpp"
+#include "vpu/softvector-native.hpp"
+#include "vpu/softvector-simd.hpp"
+
+// Outcome of op for the three-way comparison c
+template<SVSIMD::CMP op>
+constexpr bool holds(const int c) {
+	switch(op) {
+	case SVSIMD::CMP::EQ: return(c == 0);
+	case SVSIMD::CMP::NE: return(c != 0);
+	case SVSIMD::CMP::LT: case SVSIMD::CMP::LTU: return(c < 0);
+	case SVSIMD::CMP::LE: case SVSIMD::CMP::LEU: return(c <= 0);
+	case SVSIMD::CMP::GT: case SVSIMD::CMP::GTU: return(c > 0);
+	default: return(c >= 0);
+	}
+}
+
+// Compare kernel. Writes opL[i] op rhs[i] to bit i of vd for all active elements. rhs is either a vector of rhs_stride
+// bytes per element or a single element (rhs_stride 0), whose value is rhs_val as well.
+// Results are assembled to 64 bit words and merged into vd a word at a time, by SIMD kernels where available. Else the
+// element width is dispatched once, i.e. standard SEWs compare native integers, wide SEWs fall back to SVElement::compare (MSB-first limbs).
+// A word of vm is read before the word of vd is written, i.e. vd may be vm.
+template<SVSIMD::CMP op>
+inline SVRegister& m_compare(SVRegister& vd, const SVector& opL, const uint8_t* rhs_mem, const size_t rhs_stride, const uint64_t rhs_val, const SVRegister& vm, bool mask, size_t start_index) {
+	constexpr bool SIGNED = (op == SVSIMD::CMP::LT) || (op == SVSIMD::CMP::LE) || (op == SVSIMD::CMP::GT) || (op == SVSIMD::CMP::GE);
+	const size_t width_in_bits = opL.single_element_width_bits_;
+	const size_t n_elements = opL.length_;
+	if(SVSIMD::compare(op, width_in_bits, vd.mem_, opL.mem_, rhs_stride ? rhs_mem : nullptr, rhs_val, n_elements, mask ? vm.mem_ : nullptr, start_index)) {
+		return(vd);
+	}
+	auto words = [&](auto&& cmp) {
+		for(size_t i_word = start_index/64; 64*i_word < n_elements; ++i_word) {
+			const uint64_t write = vm.active_word(i_word, start_index, n_elements, mask);
+			uint64_t res = 0;
+			for(uint64_t bits = write; bits; bits &= bits - 1) {
+				const size_t i_bit = SVNATIVE::ctz(bits);
+				res |= static_cast<uint64_t>(holds<op>(cmp(64*i_word + i_bit))) << i_bit;
+			}
+			if(write) {
+				vd.merge_word(i_word, res, write, n_elements);
+			}
+		}
+	};
+	if(SVNATIVE::dispatch(width_in_bits, [&](auto t) {
+		using T = typename std::conditional<SIGNED, SVNATIVE::signed_t<decltype(t)>, decltype(t)>::type;
+		words([&](size_t i_element) {
+			const T a = SVNATIVE::load<T>(opL.mem_ + i_element*sizeof(T));
+			const T b = SVNATIVE::load<T>(rhs_mem + i_element*rhs_stride);
+			return((a > b) - (a < b));
+		});
+	})) return(vd);
+	words([&](size_t i_element) {
+		return(SVElement::compare(width_in_bits, opL[i_element].mem_, rhs_mem + i_element*rhs_stride, SIGNED));
+	});
+	return(vd);
+}
+
+// Scalar operands are expanded to element width once per instruction
+inline SVElement scalar_element(const SVector& opL, const int64_t rhs) {
+	SVElement ret(opL.single_element_width_bits_);
+	ret = rhs;
+	return(ret);
+}
+
+inline SVElement scalar_element_u(const SVector& opL, const uint64_t rhs) {
+	SVElement ret(opL.single_element_width_bits_);
+	for (size_t i_byte = 0; (i_byte < 8) && (i_byte < ret.width_in_bits_/8); ++i_byte) {
+		ret[i_byte] = rhs >> 8*i_byte;
+	}
+	return(ret);
+}
+
 
 SVRegister& SVRegister::operator=(const SVRegister& rhs) {
 	for (size_t i_byte = 0; i_byte < length_bits_/8; ++i_byte) {
@@ -55,162 +126,92 @@ void SVRegister::m_assign(
 }
 
 SVRegister& SVRegister::m_eq(const SVector& opL, const SVector& rhs,  const SVRegister& vm, bool mask, size_t start_index) {
-	for(size_t i_element = start_index; i_element < opL.length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			set_bit(i_element, opL[i_element] == rhs[i_element]);
-	}
-	return(*this);
+	return(m_compare<SVSIMD::CMP::EQ>(*this, opL, rhs.mem_, rhs.single_element_width_bits_/8, 0, vm, mask, start_index));
 }
 
 SVRegister& SVRegister::m_eq(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index ) {
-	for(size_t i_element = start_index; i_element < opL.length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			set_bit(i_element, opL[i_element] == rhs);
-	}
-	return(*this);
+	const SVElement x = scalar_element(opL, rhs);
+	return(m_compare<SVSIMD::CMP::EQ>(*this, opL, x.mem_, 0, static_cast<uint64_t>(rhs), vm, mask, start_index));
 }
 
 SVRegister& SVRegister::m_neq(const SVector& opL, const SVector& rhs,  const SVRegister& vm, bool mask, size_t start_index) {
-	for(size_t i_element = start_index; i_element < opL.length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			set_bit(i_element, opL[i_element] != rhs[i_element]);
-	}
-	return(*this);
+	return(m_compare<SVSIMD::CMP::NE>(*this, opL, rhs.mem_, rhs.single_element_width_bits_/8, 0, vm, mask, start_index));
 }
 
 SVRegister& SVRegister::m_neq(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index ) {
-	for(size_t i_element = start_index; i_element < opL.length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			set_bit(i_element, opL[i_element] != rhs);
-	}
-	return(*this);
+	const SVElement x = scalar_element(opL, rhs);
+	return(m_compare<SVSIMD::CMP::NE>(*this, opL, x.mem_, 0, static_cast<uint64_t>(rhs), vm, mask, start_index));
 }
 
 SVRegister& SVRegister::m_s_lt(const SVector& opL, const SVector& rhs,  const SVRegister& vm, bool mask, size_t start_index) {
-	for(size_t i_element = start_index; i_element < opL.length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			set_bit(i_element, opL[i_element] < rhs[i_element]);
-	}
-	return(*this);
+	return(m_compare<SVSIMD::CMP::LT>(*this, opL, rhs.mem_, rhs.single_element_width_bits_/8, 0, vm, mask, start_index));
 }
 
 SVRegister& SVRegister::m_s_lt(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index ) {
-	for(size_t i_element = start_index; i_element < opL.length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			set_bit(i_element, opL[i_element] < rhs);
-	}
-	return(*this);
+	const SVElement x = scalar_element(opL, rhs);
+	return(m_compare<SVSIMD::CMP::LT>(*this, opL, x.mem_, 0, static_cast<uint64_t>(rhs), vm, mask, start_index));
 }
 
 SVRegister& SVRegister::m_s_lte(const SVector& opL, const SVector& rhs,  const SVRegister& vm, bool mask, size_t start_index) {
-	for(size_t i_element = start_index; i_element < opL.length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			set_bit(i_element, opL[i_element] <= rhs[i_element]);
-	}
-	return(*this);
+	return(m_compare<SVSIMD::CMP::LE>(*this, opL, rhs.mem_, rhs.single_element_width_bits_/8, 0, vm, mask, start_index));
 }
 
 SVRegister& SVRegister::m_s_lte(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index ) {
-	for(size_t i_element = start_index; i_element < opL.length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			set_bit(i_element, opL[i_element] <= rhs);
-	}
-	return(*this);
+	const SVElement x = scalar_element(opL, rhs);
+	return(m_compare<SVSIMD::CMP::LE>(*this, opL, x.mem_, 0, static_cast<uint64_t>(rhs), vm, mask, start_index));
 }
 
 SVRegister& SVRegister::m_s_gt(const SVector& opL, const SVector& rhs,  const SVRegister& vm, bool mask, size_t start_index) {
-	for(size_t i_element = start_index; i_element < opL.length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			set_bit(i_element, opL[i_element] > rhs[i_element]);
-	}
-	return(*this);
+	return(m_compare<SVSIMD::CMP::GT>(*this, opL, rhs.mem_, rhs.single_element_width_bits_/8, 0, vm, mask, start_index));
 }
 
 SVRegister& SVRegister::m_s_gt(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index ) {
-	for(size_t i_element = start_index; i_element < opL.length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			set_bit(i_element, opL[i_element] > rhs);
-	}
-	return(*this);
+	const SVElement x = scalar_element(opL, rhs);
+	return(m_compare<SVSIMD::CMP::GT>(*this, opL, x.mem_, 0, static_cast<uint64_t>(rhs), vm, mask, start_index));
 }
 
 SVRegister& SVRegister::m_s_gte(const SVector& opL, const SVector& rhs,  const SVRegister& vm, bool mask, size_t start_index) {
-	for(size_t i_element = start_index; i_element < opL.length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			set_bit(i_element, opL[i_element] >= rhs[i_element]);
-	}
-	return(*this);
+	return(m_compare<SVSIMD::CMP::GE>(*this, opL, rhs.mem_, rhs.single_element_width_bits_/8, 0, vm, mask, start_index));
 }
 
 SVRegister& SVRegister::m_s_gte(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index ) {
-	for(size_t i_element = start_index; i_element < opL.length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			set_bit(i_element, opL[i_element] >= rhs);
-	}
-	return(*this);
+	const SVElement x = scalar_element(opL, rhs);
+	return(m_compare<SVSIMD::CMP::GE>(*this, opL, x.mem_, 0, static_cast<uint64_t>(rhs), vm, mask, start_index));
 }
 
 // unsigned comparisons
 SVRegister& SVRegister::m_u_lt(const SVector& opL, const SVector& rhs,  const SVRegister& vm, bool mask, size_t start_index) {
-	for(size_t i_element = start_index; i_element < opL.length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			set_bit(i_element, opL[i_element].op_u_lt(rhs[i_element]));
-	}
-	return(*this);
+	return(m_compare<SVSIMD::CMP::LTU>(*this, opL, rhs.mem_, rhs.single_element_width_bits_/8, 0, vm, mask, start_index));
 }
 
 SVRegister& SVRegister::m_u_lt(const SVector& opL, const uint64_t rhs, const SVRegister& vm, bool mask, size_t start_index ) {
-	for(size_t i_element = start_index; i_element < opL.length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			set_bit(i_element, opL[i_element].op_u_lt(rhs));
-	}
-	return(*this);
+	const SVElement x = scalar_element_u(opL, rhs);
+	return(m_compare<SVSIMD::CMP::LTU>(*this, opL, x.mem_, 0, rhs, vm, mask, start_index));
 }
 
 SVRegister& SVRegister::m_u_lte(const SVector& opL, const SVector& rhs,  const SVRegister& vm, bool mask, size_t start_index) {
-	for(size_t i_element = start_index; i_element < opL.length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			set_bit(i_element, opL[i_element].op_u_lte(rhs[i_element]));
-	}
-	return(*this);
+	return(m_compare<SVSIMD::CMP::LEU>(*this, opL, rhs.mem_, rhs.single_element_width_bits_/8, 0, vm, mask, start_index));
 }
 
 SVRegister& SVRegister::m_u_lte(const SVector& opL, const uint64_t rhs, const SVRegister& vm, bool mask, size_t start_index ) {
-	for(size_t i_element = start_index; i_element < opL.length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			set_bit(i_element, opL[i_element].op_u_lte(rhs));
-	}
-	return(*this);
+	const SVElement x = scalar_element_u(opL, rhs);
+	return(m_compare<SVSIMD::CMP::LEU>(*this, opL, x.mem_, 0, rhs, vm, mask, start_index));
 }
 
 SVRegister& SVRegister::m_u_gt(const SVector& opL, const SVector& rhs,  const SVRegister& vm, bool mask, size_t start_index) {
-	for(size_t i_element = start_index; i_element < opL.length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			set_bit(i_element, opL[i_element].op_u_gt(rhs[i_element]));
-	}
-	return(*this);
+	return(m_compare<SVSIMD::CMP::GTU>(*this, opL, rhs.mem_, rhs.single_element_width_bits_/8, 0, vm, mask, start_index));
 }
 
 SVRegister& SVRegister::m_u_gt(const SVector& opL, const uint64_t rhs, const SVRegister& vm, bool mask, size_t start_index ) {
-	for(size_t i_element = start_index; i_element < opL.length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			set_bit(i_element, opL[i_element].op_u_gt(rhs));
-	}
-	return(*this);
+	const SVElement x = scalar_element_u(opL, rhs);
+	return(m_compare<SVSIMD::CMP::GTU>(*this, opL, x.mem_, 0, rhs, vm, mask, start_index));
 }
 
 SVRegister& SVRegister::m_u_gte(const SVector& opL, const SVector& rhs,  const SVRegister& vm, bool mask, size_t start_index) {
-	for(size_t i_element = start_index; i_element < opL.length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			set_bit(i_element, opL[i_element].op_u_gte(rhs[i_element]));
-	}
-	return(*this);
+	return(m_compare<SVSIMD::CMP::GEU>(*this, opL, rhs.mem_, rhs.single_element_width_bits_/8, 0, vm, mask, start_index));
 }
 
 SVRegister& SVRegister::m_u_gte(const SVector& opL, const uint64_t rhs, const SVRegister& vm, bool mask, size_t start_index ) {
-	for(size_t i_element = start_index; i_element < opL.length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			set_bit(i_element, opL[i_element].op_u_gte(rhs));
-	}
-	return(*this);
+	const SVElement x = scalar_element_u(opL, rhs);
+	return(m_compare<SVSIMD::CMP::GEU>(*this, opL, x.mem_, 0, rhs, vm, mask, start_index));
 }
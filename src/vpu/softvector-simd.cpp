@@ -0,0 +1,776 @@
+/*
+ * Copyright [2020] [Technical University of Munich]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+//////////////////////////////////////////////////////////////////////////////////////
+/// \file softvector-simd.cpp
+/// \brief SIMD kernels and runtime instruction set dispatch
+/// \date 10/16/2026
+//////////////////////////////////////////////////////////////////////////////////////
+
+#include "vpu/softvector-simd.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+namespace SVSIMD {
+
+#if defined(__GNUC__)
+#define SVSIMD_KERNELS 1
+#define SVSIMD_INLINE inline __attribute__((always_inline))
+#endif
+
+#if defined(SVSIMD_KERNELS) && (defined(__x86_64__) || defined(__i386__))
+#define SVSIMD_X86 1
+#define SVSIMD_TARGET_V128 __attribute__((target("sse4.2")))
+#define SVSIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#define SVSIMD_TARGET_AVX512 __attribute__((target("avx512f,avx512bw")))
+#else
+#define SVSIMD_TARGET_V128
+#endif
+
+typedef void (*masked_kernel_t)(uint8_t* dst, const uint8_t* lhs, const uint8_t* rhs_mem, const uint64_t rhs_val, const uint8_t* mask, const size_t start_index, const size_t n_elements, const bool fill_ones);
+typedef void (*deinterleave_kernel_t)(uint8_t* const* fields, const uint8_t* mem, const size_t n_segments);
+typedef void (*interleave_kernel_t)(uint8_t* mem, const uint8_t* const* fields, const size_t n_segments);
+
+constexpr size_t n_ops = static_cast<size_t>(OP::COUNT);
+constexpr size_t n_cmps = static_cast<size_t>(CMP::COUNT);
+constexpr size_t n_lanes = 4; //!< 8, 16, 32 and 64 bit lanes
+constexpr size_t min_fields = 2; //!< Segment kernels for 2..8 fields
+constexpr size_t max_fields = 8;
+
+//////////////////////////////////////////////////////////////////////////////////////
+/// \brief Kernels of one tier, indexed by operation and lane type
+struct table_t {
+	kernel_t k[n_ops][n_lanes];
+	masked_kernel_t k_masked[n_ops][n_lanes];
+	compare_kernel_t k_compare[n_cmps][n_lanes];
+	deinterleave_kernel_t k_deinterleave[max_fields - min_fields + 1][n_lanes];
+	interleave_kernel_t k_interleave[max_fields - min_fields + 1][n_lanes];
+};
+
+constexpr unsigned default_blend_density = 3; //!< Measured crossover against the element-wise loop, 1024 elements of 32 and 64 bits
+
+// Mask word i_word (bits 64*i_word..64*i_word+63) of a mask of n_bytes. Bytes beyond read as
+// zero, respectively are not written. Little-endian, like the kernels.
+inline uint64_t load_word(const uint8_t* mask, const size_t i_word, const size_t n_bytes) {
+	uint64_t ret = 0;
+	if(8*i_word + 8 <= n_bytes) {
+		std::memcpy(&ret, mask + 8*i_word, 8);
+	} else {
+		std::memcpy(&ret, mask + 8*i_word, n_bytes - 8*i_word);
+	}
+	return(ret);
+}
+
+inline void store_word(uint8_t* mask, const size_t i_word, const size_t n_bytes, const uint64_t word) {
+	if(8*i_word + 8 <= n_bytes) {
+		std::memcpy(mask + 8*i_word, &word, 8);
+	} else {
+		std::memcpy(mask + 8*i_word, &word, n_bytes - 8*i_word);
+	}
+}
+
+// Bits of elements [start_index, n_elements) within mask word i_word
+inline uint64_t range_word(const size_t i_word, const size_t start_index, const size_t n_elements) {
+	const size_t first = 64*i_word;
+	uint64_t ret = (n_elements - first < 64) ? ((1ULL << (n_elements - first)) - 1) : ~0ULL;
+	if(first < start_index) {
+		ret &= ~0ULL << (start_index - first);
+	}
+	return(ret);
+}
+
+#if defined(SVSIMD_KERNELS)
+// Kernels are written with GCC/Clang vector extensions. They are always inlined into the
+// tier specific entry points below, thus, they are lowered to that tier's instruction set.
+// Vectors are passed by reference to keep the ABI independent from the tier.
+
+template<typename T, size_t BYTES>
+struct vec {
+	typedef T type __attribute__((vector_size(BYTES)));
+};
+
+template<OP op, typename T, size_t BYTES>
+SVSIMD_INLINE void apply(typename vec<T, BYTES>::type& r, const typename vec<T, BYTES>::type& a, const typename vec<T, BYTES>::type& b) {
+	using V = typename vec<T, BYTES>::type;
+	using SV = typename vec<std::make_signed_t<T>, BYTES>::type;
+	constexpr T shift_mask = sizeof(T)*8 -1;
+	if constexpr (op == OP::ADD) r = a + b;
+	if constexpr (op == OP::SUB) r = a - b;
+	if constexpr (op == OP::AND) r = a & b;
+	if constexpr (op == OP::OR) r = a | b;
+	if constexpr (op == OP::XOR) r = a ^ b;
+	if constexpr (op == OP::MUL) r = a * b;
+	if constexpr (op == OP::SLL) r = a << (b & shift_mask);
+	if constexpr (op == OP::SRL) r = a >> (b & shift_mask);
+	if constexpr (op == OP::SRA) r = reinterpret_cast<V>(reinterpret_cast<SV>(a) >> reinterpret_cast<SV>(b & shift_mask));
+}
+
+// The tail (less than BYTES) is processed on a zero padded copy
+template<OP op, typename T, size_t BYTES>
+SVSIMD_INLINE void kernel(uint8_t* dst, const uint8_t* lhs, const uint8_t* rhs_mem, const uint64_t rhs_val, const size_t bytes) {
+	using V = typename vec<T, BYTES>::type;
+	V a, b, r;
+	for(size_t i = 0; i < BYTES/sizeof(T); ++i) {
+		b[i] = static_cast<T>(rhs_val);
+	}
+	size_t i_byte = 0;
+	for(; i_byte + BYTES <= bytes; i_byte += BYTES) {
+		std::memcpy(&a, lhs + i_byte, BYTES);
+		if(rhs_mem) {
+			std::memcpy(&b, rhs_mem + i_byte, BYTES);
+		}
+		apply<op, T, BYTES>(r, a, b);
+		std::memcpy(dst + i_byte, &r, BYTES);
+	}
+	if(i_byte < bytes) {
+		const size_t rest = bytes - i_byte;
+		a = V{};
+		std::memcpy(&a, lhs + i_byte, rest);
+		if(rhs_mem) {
+			b = V{};
+			std::memcpy(&b, rhs_mem + i_byte, rest);
+		}
+		apply<op, T, BYTES>(r, a, b);
+		std::memcpy(dst + i_byte, &r, rest);
+	}
+}
+
+// Bit i%K of every lane i of T within a 64 bit lane (K lanes of T each)
+template<typename T>
+constexpr uint64_t lane_sel(void) {
+	uint64_t ret = 0;
+	for(size_t i = 0; i < 8/sizeof(T); ++i) {
+		ret |= 1ULL << (8*sizeof(T)*i + i);
+	}
+	return(ret);
+}
+
+// Expand mask bits to lane masks, lane i is all ones if bit i is set. The bits are spread
+// over 64 bit lanes (K lanes of T each), replicated to every T and tested against bit i%K.
+template<typename T, size_t BYTES>
+SVSIMD_INLINE void expand(typename vec<T, BYTES>::type& m, const uint64_t bits) {
+	using V = typename vec<T, BYTES>::type;
+	using W = typename vec<uint64_t, BYTES>::type;
+	constexpr size_t K = 8/sizeof(T);
+	constexpr uint64_t sel = lane_sel<T>();
+	W w{}, shift{};
+	for(size_t i = 0; i < BYTES/8; ++i) {
+		w[i] = bits;
+		shift[i] = K*i;
+	}
+	w = (w >> shift) & ((1ULL << K) - 1);
+	for(size_t s = 8*sizeof(T); s < 64; s *= 2) {
+		w |= w << s;
+	}
+	m = reinterpret_cast<V>(reinterpret_cast<V>(w & sel) != 0);
+}
+
+// Mask bits of the chunk of lanes (at most L) elements at i_element. Chunks are aligned to
+// multiples of L elements, thus, the bits are either whole bytes (L >= 8) or within a
+// single byte (L < 8). Kernels run on little-endian hosts only (see detect()).
+template<size_t L>
+SVSIMD_INLINE uint64_t chunk_bits(const uint8_t* mask, const size_t i_element, const size_t lanes) {
+	const uint64_t all = (lanes < 64) ? ((1ULL << lanes) - 1) : ~0ULL;
+	if constexpr (L < 8) {
+		return((mask[i_element/8] >> (i_element % 8)) & all);
+	} else {
+		uint64_t ret = 0;
+		std::memcpy(&ret, mask + i_element/8, (lanes + 7)/8);
+		return(ret & all);
+	}
+}
+
+// Compute one chunk of bytes (at most BYTES) and blend it into dst. Inactive lanes are
+// restored from dst by the mask bits expanded to lane masks. With fill_ones, inactive lanes
+// are set to all ones and only lanes outside of write_bits (i.e. before the start index)
+// are restored from dst.
+template<OP op, typename T, size_t BYTES>
+SVSIMD_INLINE void blend(uint8_t* dst, const uint8_t* lhs, const uint8_t* rhs_mem, typename vec<T, BYTES>::type& b, uint64_t bits, const uint64_t write_bits, const bool fill_ones, const size_t bytes) {
+	using V = typename vec<T, BYTES>::type;
+	const uint64_t all = (bytes/sizeof(T) < 64) ? ((1ULL << bytes/sizeof(T)) - 1) : ~0ULL;
+	V a{}, r, d{}, m;
+	std::memcpy(&a, lhs, bytes);
+	if(rhs_mem) {
+		b = V{};
+		std::memcpy(&b, rhs_mem, bytes);
+	}
+	apply<op, T, BYTES>(r, a, b);
+	if(fill_ones) {
+		if(bits != all) {
+			expand<T, BYTES>(m, bits);
+			r |= ~m;
+		}
+		bits = write_bits;
+	}
+	if(bits != all) {
+		std::memcpy(&d, dst, bytes);
+		expand<T, BYTES>(m, bits);
+		r = (r & m) | (d & ~m);
+	}
+	std::memcpy(dst, &r, bytes);
+}
+
+// Masked blend over chunks of L lanes. Chunks without active elements are skipped, unless
+// inactive lanes are filled with ones.
+template<OP op, typename T, size_t BYTES>
+SVSIMD_INLINE void kernel_masked(uint8_t* dst, const uint8_t* lhs, const uint8_t* rhs_mem, const uint64_t rhs_val, const uint8_t* mask, const size_t start_index, const size_t n_elements, const bool fill_ones) {
+	using V = typename vec<T, BYTES>::type;
+	constexpr size_t L = BYTES/sizeof(T);
+	V b;
+	for(size_t i = 0; i < L; ++i) {
+		b[i] = static_cast<T>(rhs_val);
+	}
+	size_t i_element = start_index - start_index % L;
+	if(i_element < start_index) {
+		const size_t lanes = (n_elements - i_element < L) ? n_elements - i_element : L;
+		const uint64_t write_bits = ((lanes < 64) ? ((1ULL << lanes) - 1) : ~0ULL) & (~0ULL << (start_index - i_element));
+		const uint64_t bits = chunk_bits<L>(mask, i_element, lanes) & write_bits;
+		if(bits || fill_ones) {
+			const size_t offset = i_element*sizeof(T);
+			blend<op, T, BYTES>(dst + offset, lhs + offset, rhs_mem ? rhs_mem + offset : nullptr, b, bits, write_bits, fill_ones, lanes*sizeof(T));
+		}
+		i_element += L;
+	}
+	for(; i_element + L <= n_elements; i_element += L) {
+		const uint64_t bits = chunk_bits<L>(mask, i_element, L);
+		if(bits || fill_ones) {
+			const size_t offset = i_element*sizeof(T);
+			blend<op, T, BYTES>(dst + offset, lhs + offset, rhs_mem ? rhs_mem + offset : nullptr, b, bits, (L < 64) ? ((1ULL << L) - 1) : ~0ULL, fill_ones, BYTES);
+		}
+	}
+	if(i_element < n_elements) {
+		const size_t lanes = (n_elements - i_element < L) ? n_elements - i_element : L;
+		const uint64_t bits = chunk_bits<L>(mask, i_element, lanes);
+		if(bits || fill_ones) {
+			const size_t offset = i_element*sizeof(T);
+			blend<op, T, BYTES>(dst + offset, lhs + offset, rhs_mem ? rhs_mem + offset : nullptr, b, bits, (lanes < 64) ? ((1ULL << lanes) - 1) : ~0ULL, fill_ones, lanes*sizeof(T));
+		}
+	}
+}
+
+// Compress lane masks to bits, bit i is set if lane i is all ones. Inverse of expand(): every
+// lane keeps bit i%K, the K lanes of a 64 bit lane are OR-folded into its low K bits and the
+// 64 bit lanes are concatenated.
+template<typename T, size_t BYTES>
+SVSIMD_INLINE uint64_t compress(const typename vec<T, BYTES>::type& m) {
+	using W = typename vec<uint64_t, BYTES>::type;
+	constexpr size_t K = 8/sizeof(T);
+	W w = reinterpret_cast<W>(m) & lane_sel<T>();
+	for(size_t s = 32; s >= 8*sizeof(T); s /= 2) {
+		w |= w >> s;
+	}
+	uint64_t ret = 0;
+	for(size_t i = 0; i < BYTES/8; ++i) {
+		ret |= (w[i] & ((1ULL << K) - 1)) << (K*i);
+	}
+	return(ret);
+}
+
+// Result bits of one chunk of L lanes
+template<CMP op, typename T, size_t BYTES>
+SVSIMD_INLINE uint64_t compare_bits(const typename vec<T, BYTES>::type& a, const typename vec<T, BYTES>::type& b) {
+	using V = typename vec<T, BYTES>::type;
+	using SV = typename vec<std::make_signed_t<T>, BYTES>::type;
+	const SV sa = reinterpret_cast<SV>(a);
+	const SV sb = reinterpret_cast<SV>(b);
+	V r{};
+	if constexpr (op == CMP::EQ) r = reinterpret_cast<V>(a == b);
+	if constexpr (op == CMP::NE) r = reinterpret_cast<V>(a != b);
+	if constexpr (op == CMP::LTU) r = reinterpret_cast<V>(a < b);
+	if constexpr (op == CMP::LEU) r = reinterpret_cast<V>(a <= b);
+	if constexpr (op == CMP::GTU) r = reinterpret_cast<V>(a > b);
+	if constexpr (op == CMP::GEU) r = reinterpret_cast<V>(a >= b);
+	if constexpr (op == CMP::LT) r = reinterpret_cast<V>(sa < sb);
+	if constexpr (op == CMP::LE) r = reinterpret_cast<V>(sa <= sb);
+	if constexpr (op == CMP::GT) r = reinterpret_cast<V>(sa > sb);
+	if constexpr (op == CMP::GE) r = reinterpret_cast<V>(sa >= sb);
+	return(compress<T, BYTES>(r));
+}
+
+// Packed compare. The results of a word of 64 elements are assembled from chunks of L lanes
+// and merged into vd at once, bits of inactive elements keep their value. Chunks without
+// active elements are skipped. The tail chunk is compared on a zero padded copy.
+template<CMP op, typename T, size_t BYTES>
+SVSIMD_INLINE void kernel_compare(uint8_t* vd, const uint8_t* lhs, const uint8_t* rhs_mem, const uint64_t rhs_val, const uint8_t* mask, const size_t start_index, const size_t n_elements) {
+	using V = typename vec<T, BYTES>::type;
+	constexpr size_t L = BYTES/sizeof(T);
+	constexpr uint64_t chunk_all = (L < 64) ? ((1ULL << (L % 64)) - 1) : ~0ULL;
+	const size_t n_bytes = (n_elements + 7)/8;
+	V a, b;
+	for(size_t i = 0; i < L; ++i) {
+		b[i] = static_cast<T>(rhs_val);
+	}
+	for(size_t i_word = start_index/64; 64*i_word < n_elements; ++i_word) {
+		uint64_t write = range_word(i_word, start_index, n_elements);
+		if(mask) {
+			write &= load_word(mask, i_word, n_bytes);
+		}
+		if(!write) {
+			continue;
+		}
+		uint64_t res = 0;
+		for(size_t i_chunk = 0; (i_chunk < 64/L) && (64*i_word + L*i_chunk < n_elements); ++i_chunk) {
+			if(!((write >> (L*i_chunk)) & chunk_all)) {
+				continue;
+			}
+			const size_t i_element = 64*i_word + L*i_chunk;
+			const size_t offset = i_element*sizeof(T);
+			if(i_element + L <= n_elements) {
+				std::memcpy(&a, lhs + offset, BYTES);
+				if(rhs_mem) {
+					std::memcpy(&b, rhs_mem + offset, BYTES);
+				}
+			} else {
+				const size_t bytes = (n_elements - i_element)*sizeof(T);
+				a = V{};
+				std::memcpy(&a, lhs + offset, bytes);
+				if(rhs_mem) {
+					b = V{};
+					std::memcpy(&b, rhs_mem + offset, bytes);
+				}
+			}
+			res |= compare_bits<op, T, BYTES>(a, b) << (L*i_chunk);
+		}
+		const uint64_t d = load_word(vd, i_word, n_bytes);
+		store_word(vd, i_word, n_bytes, (d & ~write) | (res & write));
+	}
+}
+
+// Segment transpose of NF vectors of L lanes, i.e. NF*L elements. De-interleaving, output o
+// holds elements o, o+NF, o+2*NF, ... of the concatenated inputs. Interleaving is the inverse.
+// Every output is gathered by a chain of two-source shuffles: step k takes the lanes sourced
+// from input k and keeps all others.
+template<size_t NF, size_t L, bool INTERLEAVE>
+constexpr int segment_lane(const size_t o, const size_t k, const size_t j) {
+	const size_t e = INTERLEAVE ? (o*L + j) : (j*NF + o);
+	const size_t src = INTERLEAVE ? (e % NF) : (e / L);
+	const size_t lane = INTERLEAVE ? (e / NF) : (e % L);
+	return((src == k) ? static_cast<int>(((k == 0) ? 0 : L) + lane) : static_cast<int>(j));
+}
+
+template<size_t NF, bool INTERLEAVE, size_t O, size_t K, typename V, size_t... J>
+SVSIMD_INLINE void segment_step(V& r, const V& a, const V& in, std::index_sequence<J...>) {
+	r = __builtin_shufflevector(a, in, segment_lane<NF, sizeof...(J), INTERLEAVE>(O, K, J)...);
+}
+
+template<size_t NF, bool INTERLEAVE, size_t L, size_t O, typename V, size_t... K>
+SVSIMD_INLINE void segment_gather(V& r, const V* in, std::index_sequence<K...>) {
+	segment_step<NF, INTERLEAVE, O, 0>(r, in[0], in[0], std::make_index_sequence<L>{});
+	(segment_step<NF, INTERLEAVE, O, K + 1>(r, r, in[K + 1], std::make_index_sequence<L>{}), ...);
+}
+
+template<size_t NF, bool INTERLEAVE, typename T, size_t BYTES, size_t... O>
+SVSIMD_INLINE void transpose(typename vec<T, BYTES>::type* out, const typename vec<T, BYTES>::type* in, std::index_sequence<O...>) {
+	(segment_gather<NF, INTERLEAVE, BYTES/sizeof(T), O>(out[O], in, std::make_index_sequence<NF - 1>{}), ...);
+}
+
+// Segments of NF fields to NF field arrays, L segments at a time. The tail is transposed on a
+// zero padded copy.
+template<size_t NF, typename T, size_t BYTES>
+SVSIMD_INLINE void kernel_deinterleave(uint8_t* const* fields, const uint8_t* mem, const size_t n_segments) {
+	using V = typename vec<T, BYTES>::type;
+	constexpr size_t L = BYTES/sizeof(T);
+	V in[NF], out[NF];
+	size_t i_segment = 0;
+	for(; i_segment + L <= n_segments; i_segment += L) {
+		std::memcpy(in, mem + i_segment*NF*sizeof(T), NF*BYTES);
+		transpose<NF, false, T, BYTES>(out, in, std::make_index_sequence<NF>{});
+		for(size_t f = 0; f < NF; ++f) {
+			std::memcpy(fields[f] + i_segment*sizeof(T), &out[f], BYTES);
+		}
+	}
+	if(i_segment < n_segments) {
+		const size_t rest = (n_segments - i_segment)*sizeof(T);
+		for(size_t f = 0; f < NF; ++f) {
+			in[f] = V{};
+		}
+		std::memcpy(in, mem + i_segment*NF*sizeof(T), NF*rest);
+		transpose<NF, false, T, BYTES>(out, in, std::make_index_sequence<NF>{});
+		for(size_t f = 0; f < NF; ++f) {
+			std::memcpy(fields[f] + i_segment*sizeof(T), &out[f], rest);
+		}
+	}
+}
+
+// NF field arrays to segments, inverse of kernel_deinterleave()
+template<size_t NF, typename T, size_t BYTES>
+SVSIMD_INLINE void kernel_interleave(uint8_t* mem, const uint8_t* const* fields, const size_t n_segments) {
+	using V = typename vec<T, BYTES>::type;
+	constexpr size_t L = BYTES/sizeof(T);
+	V in[NF], out[NF];
+	size_t i_segment = 0;
+	for(; i_segment + L <= n_segments; i_segment += L) {
+		for(size_t f = 0; f < NF; ++f) {
+			std::memcpy(&in[f], fields[f] + i_segment*sizeof(T), BYTES);
+		}
+		transpose<NF, true, T, BYTES>(out, in, std::make_index_sequence<NF>{});
+		std::memcpy(mem + i_segment*NF*sizeof(T), out, NF*BYTES);
+	}
+	if(i_segment < n_segments) {
+		const size_t rest = (n_segments - i_segment)*sizeof(T);
+		for(size_t f = 0; f < NF; ++f) {
+			in[f] = V{};
+			std::memcpy(&in[f], fields[f] + i_segment*sizeof(T), rest);
+		}
+		transpose<NF, true, T, BYTES>(out, in, std::make_index_sequence<NF>{});
+		std::memcpy(mem + i_segment*NF*sizeof(T), out, NF*rest);
+	}
+}
+
+// Tier entry points
+struct V128 {
+	template<OP op, typename T>
+	SVSIMD_TARGET_V128 static void run(uint8_t* dst, const uint8_t* lhs, const uint8_t* rhs_mem, const uint64_t rhs_val, const size_t bytes) {
+		kernel<op, T, 16>(dst, lhs, rhs_mem, rhs_val, bytes);
+	}
+	template<OP op, typename T>
+	SVSIMD_TARGET_V128 static void run_masked(uint8_t* dst, const uint8_t* lhs, const uint8_t* rhs_mem, const uint64_t rhs_val, const uint8_t* mask, const size_t start_index, const size_t n_elements, const bool fill_ones) {
+		kernel_masked<op, T, 16>(dst, lhs, rhs_mem, rhs_val, mask, start_index, n_elements, fill_ones);
+	}
+	template<CMP op, typename T>
+	SVSIMD_TARGET_V128 static void run_compare(uint8_t* vd, const uint8_t* lhs, const uint8_t* rhs_mem, const uint64_t rhs_val, const uint8_t* mask, const size_t start_index, const size_t n_elements) {
+		kernel_compare<op, T, 16>(vd, lhs, rhs_mem, rhs_val, mask, start_index, n_elements);
+	}
+	template<size_t NF, typename T>
+	SVSIMD_TARGET_V128 static void run_deinterleave(uint8_t* const* fields, const uint8_t* mem, const size_t n_segments) {
+		kernel_deinterleave<NF, T, 16>(fields, mem, n_segments);
+	}
+	template<size_t NF, typename T>
+	SVSIMD_TARGET_V128 static void run_interleave(uint8_t* mem, const uint8_t* const* fields, const size_t n_segments) {
+		kernel_interleave<NF, T, 16>(mem, fields, n_segments);
+	}
+};
+
+#if defined(SVSIMD_X86)
+struct AVX2 {
+	template<OP op, typename T>
+	SVSIMD_TARGET_AVX2 static void run(uint8_t* dst, const uint8_t* lhs, const uint8_t* rhs_mem, const uint64_t rhs_val, const size_t bytes) {
+		kernel<op, T, 32>(dst, lhs, rhs_mem, rhs_val, bytes);
+	}
+	template<OP op, typename T>
+	SVSIMD_TARGET_AVX2 static void run_masked(uint8_t* dst, const uint8_t* lhs, const uint8_t* rhs_mem, const uint64_t rhs_val, const uint8_t* mask, const size_t start_index, const size_t n_elements, const bool fill_ones) {
+		kernel_masked<op, T, 32>(dst, lhs, rhs_mem, rhs_val, mask, start_index, n_elements, fill_ones);
+	}
+	template<CMP op, typename T>
+	SVSIMD_TARGET_AVX2 static void run_compare(uint8_t* vd, const uint8_t* lhs, const uint8_t* rhs_mem, const uint64_t rhs_val, const uint8_t* mask, const size_t start_index, const size_t n_elements) {
+		kernel_compare<op, T, 32>(vd, lhs, rhs_mem, rhs_val, mask, start_index, n_elements);
+	}
+	template<size_t NF, typename T>
+	SVSIMD_TARGET_AVX2 static void run_deinterleave(uint8_t* const* fields, const uint8_t* mem, const size_t n_segments) {
+		kernel_deinterleave<NF, T, 32>(fields, mem, n_segments);
+	}
+	template<size_t NF, typename T>
+	SVSIMD_TARGET_AVX2 static void run_interleave(uint8_t* mem, const uint8_t* const* fields, const size_t n_segments) {
+		kernel_interleave<NF, T, 32>(mem, fields, n_segments);
+	}
+};
+
+struct AVX512 {
+	template<OP op, typename T>
+	SVSIMD_TARGET_AVX512 static void run(uint8_t* dst, const uint8_t* lhs, const uint8_t* rhs_mem, const uint64_t rhs_val, const size_t bytes) {
+		kernel<op, T, 64>(dst, lhs, rhs_mem, rhs_val, bytes);
+	}
+	template<OP op, typename T>
+	SVSIMD_TARGET_AVX512 static void run_masked(uint8_t* dst, const uint8_t* lhs, const uint8_t* rhs_mem, const uint64_t rhs_val, const uint8_t* mask, const size_t start_index, const size_t n_elements, const bool fill_ones) {
+		kernel_masked<op, T, 64>(dst, lhs, rhs_mem, rhs_val, mask, start_index, n_elements, fill_ones);
+	}
+	template<CMP op, typename T>
+	SVSIMD_TARGET_AVX512 static void run_compare(uint8_t* vd, const uint8_t* lhs, const uint8_t* rhs_mem, const uint64_t rhs_val, const uint8_t* mask, const size_t start_index, const size_t n_elements) {
+		kernel_compare<op, T, 64>(vd, lhs, rhs_mem, rhs_val, mask, start_index, n_elements);
+	}
+	template<size_t NF, typename T>
+	SVSIMD_TARGET_AVX512 static void run_deinterleave(uint8_t* const* fields, const uint8_t* mem, const size_t n_segments) {
+		kernel_deinterleave<NF, T, 64>(fields, mem, n_segments);
+	}
+	template<size_t NF, typename T>
+	SVSIMD_TARGET_AVX512 static void run_interleave(uint8_t* mem, const uint8_t* const* fields, const size_t n_segments) {
+		kernel_interleave<NF, T, 64>(mem, fields, n_segments);
+	}
+};
+#endif
+
+template<typename I, OP op>
+inline void fill_op(table_t& t) {
+	constexpr size_t i_op = static_cast<size_t>(op);
+	t.k[i_op][0] = &I::template run<op, uint8_t>;
+	t.k[i_op][1] = &I::template run<op, uint16_t>;
+	t.k[i_op][2] = &I::template run<op, uint32_t>;
+	t.k[i_op][3] = &I::template run<op, uint64_t>;
+	t.k_masked[i_op][0] = &I::template run_masked<op, uint8_t>;
+	t.k_masked[i_op][1] = &I::template run_masked<op, uint16_t>;
+	t.k_masked[i_op][2] = &I::template run_masked<op, uint32_t>;
+	t.k_masked[i_op][3] = &I::template run_masked<op, uint64_t>;
+}
+
+template<typename I, CMP op>
+inline void fill_compare(table_t& t) {
+	constexpr size_t i_op = static_cast<size_t>(op);
+	t.k_compare[i_op][0] = &I::template run_compare<op, uint8_t>;
+	t.k_compare[i_op][1] = &I::template run_compare<op, uint16_t>;
+	t.k_compare[i_op][2] = &I::template run_compare<op, uint32_t>;
+	t.k_compare[i_op][3] = &I::template run_compare<op, uint64_t>;
+}
+
+template<typename I, size_t NF>
+inline void fill_segment(table_t& t) {
+	constexpr size_t i_nf = NF - min_fields;
+	t.k_deinterleave[i_nf][0] = &I::template run_deinterleave<NF, uint8_t>;
+	t.k_deinterleave[i_nf][1] = &I::template run_deinterleave<NF, uint16_t>;
+	t.k_deinterleave[i_nf][2] = &I::template run_deinterleave<NF, uint32_t>;
+	t.k_deinterleave[i_nf][3] = &I::template run_deinterleave<NF, uint64_t>;
+	t.k_interleave[i_nf][0] = &I::template run_interleave<NF, uint8_t>;
+	t.k_interleave[i_nf][1] = &I::template run_interleave<NF, uint16_t>;
+	t.k_interleave[i_nf][2] = &I::template run_interleave<NF, uint32_t>;
+	t.k_interleave[i_nf][3] = &I::template run_interleave<NF, uint64_t>;
+}
+
+template<typename I>
+inline table_t make_table(void) {
+	table_t t{};
+	fill_op<I, OP::ADD>(t);
+	fill_op<I, OP::SUB>(t);
+	fill_op<I, OP::AND>(t);
+	fill_op<I, OP::OR>(t);
+	fill_op<I, OP::XOR>(t);
+	fill_op<I, OP::SLL>(t);
+	fill_op<I, OP::SRL>(t);
+	fill_op<I, OP::SRA>(t);
+	fill_op<I, OP::MUL>(t);
+	fill_compare<I, CMP::EQ>(t);
+	fill_compare<I, CMP::NE>(t);
+	fill_compare<I, CMP::LTU>(t);
+	fill_compare<I, CMP::LEU>(t);
+	fill_compare<I, CMP::GTU>(t);
+	fill_compare<I, CMP::GEU>(t);
+	fill_compare<I, CMP::LT>(t);
+	fill_compare<I, CMP::LE>(t);
+	fill_compare<I, CMP::GT>(t);
+	fill_compare<I, CMP::GE>(t);
+	fill_segment<I, 2>(t);
+	fill_segment<I, 3>(t);
+	fill_segment<I, 4>(t);
+	fill_segment<I, 5>(t);
+	fill_segment<I, 6>(t);
+	fill_segment<I, 7>(t);
+	fill_segment<I, 8>(t);
+	return(t);
+}
+#endif
+
+// Best tier supported by the host
+inline TIER detect(void) {
+#if defined(SVSIMD_X86)
+	__builtin_cpu_init();
+	if(__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) {
+		return(TIER::AVX512);
+	}
+	if(__builtin_cpu_supports("avx2")) {
+		return(TIER::AVX2);
+	}
+	if(__builtin_cpu_supports("sse4.2")) {
+		return(TIER::V128);
+	}
+	return(TIER::SCALAR);
+#elif defined(SVSIMD_KERNELS)
+	return(SVNATIVE::enabled ? TIER::V128 : TIER::SCALAR);
+#else
+	return(TIER::SCALAR);
+#endif
+}
+
+// Detected tier, capped by SOFTVECTOR_SIMD
+inline TIER select(void) {
+	TIER t = detect();
+	const char* env = std::getenv("SOFTVECTOR_SIMD");
+	if(env) {
+		for(TIER cap: {TIER::SCALAR, TIER::V128, TIER::AVX2, TIER::AVX512}) {
+			if(!std::strcmp(env, tier_name(cap)) || ((cap == TIER::V128) && !std::strcmp(env, "v128"))) {
+				t = (cap < t) ? cap : t;
+				break;
+			}
+		}
+	}
+	return(t);
+}
+
+// SOFTVECTOR_BLEND_DENSITY in percent, 0 always blends, above 100 never
+inline unsigned select_blend_density(void) {
+	const char* env = std::getenv("SOFTVECTOR_BLEND_DENSITY");
+	if(env && *env) {
+		char* end = nullptr;
+		const unsigned long val = std::strtoul(env, &end, 10);
+		if(!*end) {
+			return((val > 101) ? 101 : static_cast<unsigned>(val));
+		}
+	}
+	return(default_blend_density);
+}
+
+struct dispatch_t {
+	TIER tier;
+	unsigned blend_density;
+	table_t table;
+};
+
+inline const dispatch_t& dispatch(void) {
+	static const dispatch_t d = [] {
+		dispatch_t ret{select(), select_blend_density(), {}};
+#if defined(SVSIMD_KERNELS)
+		switch(ret.tier) {
+		case TIER::V128: ret.table = make_table<V128>(); break;
+#if defined(SVSIMD_X86)
+		case TIER::AVX2: ret.table = make_table<AVX2>(); break;
+		case TIER::AVX512: ret.table = make_table<AVX512>(); break;
+#endif
+		default: break;
+		}
+#endif
+		return(ret);
+	}();
+	return(d);
+}
+
+TIER tier(void) {
+	return(dispatch().tier);
+}
+
+const char* tier_name(const TIER t) {
+	switch(t) {
+	case TIER::V128:
+#if defined(SVSIMD_X86)
+		return("sse4.2");
+#else
+		return("v128");
+#endif
+	case TIER::AVX2: return("avx2");
+	case TIER::AVX512: return("avx512");
+	default: return("scalar");
+	}
+}
+
+unsigned blend_density(void) {
+	return(dispatch().blend_density);
+}
+
+// Active elements of mask in [start_index, n_elements)
+inline size_t count_active(const uint8_t* mask, const size_t start_index, const size_t n_elements) {
+	const size_t n_bytes = (n_elements + 7)/8;
+	size_t ret = 0;
+	for(size_t i_word = start_index/64; 64*i_word < n_elements; ++i_word) {
+		ret += SVNATIVE::popcount(load_word(mask, i_word, n_bytes) & range_word(i_word, start_index, n_elements));
+	}
+	return(ret);
+}
+
+// Table column of a lane width, n_lanes if there is none
+inline size_t lane_index(const size_t lane_bits) {
+	switch(lane_bits) {
+	case 8: return(0);
+	case 16: return(1);
+	case 32: return(2);
+	case 64: return(3);
+	default: return(n_lanes);
+	}
+}
+
+bool run(const OP op, const size_t width_in_bits, const size_t lane_bits, uint8_t* dst, const uint8_t* lhs, const uint8_t* rhs_mem, const uint64_t rhs_val, const size_t n_elements, const uint8_t* mask, const size_t start_index, const bool fill_ones) {
+	const size_t i_lane = lane_index(lane_bits);
+	if(i_lane == n_lanes) {
+		return(false);
+	}
+	const dispatch_t& d = dispatch();
+	if(start_index >= n_elements) {
+		return(d.tier != TIER::SCALAR);
+	}
+	if(!mask) {
+		kernel_t k = d.table.k[static_cast<size_t>(op)][i_lane];
+		if(!k) {
+			return(false);
+		}
+		const size_t offset = start_index*width_in_bits/8;
+		k(dst + offset, lhs + offset, rhs_mem ? rhs_mem + offset : nullptr, rhs_val, (n_elements - start_index)*width_in_bits/8);
+		return(true);
+	}
+	masked_kernel_t k = d.table.k_masked[static_cast<size_t>(op)][i_lane];
+	if(!k || (lane_bits != width_in_bits)) {
+		return(false);
+	}
+	if(!fill_ones && d.blend_density && (100*count_active(mask, start_index, n_elements) < d.blend_density*(n_elements - start_index))) {
+		return(false);
+	}
+	k(dst, lhs, rhs_mem, rhs_val, mask, start_index, n_elements, fill_ones);
+	return(true);
+}
+
+kernel_t kernel(const OP op, const size_t lane_bits) {
+	const size_t i_lane = lane_index(lane_bits);
+	return((i_lane == n_lanes) ? nullptr : dispatch().table.k[static_cast<size_t>(op)][i_lane]);
+}
+
+compare_kernel_t compare_kernel(const CMP op, const size_t width_in_bits) {
+	const size_t i_lane = lane_index(width_in_bits);
+	return((i_lane == n_lanes) ? nullptr : dispatch().table.k_compare[static_cast<size_t>(op)][i_lane]);
+}
+
+bool compare(const CMP op, const size_t width_in_bits, uint8_t* vd, const uint8_t* lhs, const uint8_t* rhs_mem, const uint64_t rhs_val, const size_t n_elements, const uint8_t* mask, const size_t start_index) {
+	const size_t i_lane = lane_index(width_in_bits);
+	if(i_lane == n_lanes) {
+		return(false);
+	}
+	compare_kernel_t k = dispatch().table.k_compare[static_cast<size_t>(op)][i_lane];
+	if(!k) {
+		return(false);
+	}
+	if(start_index < n_elements) {
+		k(vd, lhs, rhs_mem, rhs_val, mask, start_index, n_elements);
+	}
+	return(true);
+}
+
+bool deinterleave(const size_t nf, const size_t width_in_bits, uint8_t* const* fields, const uint8_t* mem, const size_t n_segments) {
+	const size_t i_lane = lane_index(width_in_bits);
+	if((i_lane == n_lanes) || (nf < min_fields) || (nf > max_fields)) {
+		return(false);
+	}
+	deinterleave_kernel_t k = dispatch().table.k_deinterleave[nf - min_fields][i_lane];
+	if(!k) {
+		return(false);
+	}
+	if(n_segments) {
+		k(fields, mem, n_segments);
+	}
+	return(true);
+}
+
+bool interleave(const size_t nf, const size_t width_in_bits, uint8_t* mem, const uint8_t* const* fields, const size_t n_segments) {
+	const size_t i_lane = lane_index(width_in_bits);
+	if((i_lane == n_lanes) || (nf < min_fields) || (nf > max_fields)) {
+		return(false);
+	}
+	interleave_kernel_t k = dispatch().table.k_interleave[nf - min_fields][i_lane];
+	if(!k) {
+		return(false);
+	}
+	if(n_segments) {
+		k(mem, fields, n_segments);
+	}
+	return(true);
+}
+
+} // namespace SVSIMD
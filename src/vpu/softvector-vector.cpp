@@ -20,6 +20,18 @@
 //////////////////////////////////////////////////////////////////////////////////////
 
 #include "vpu/softvector-types.hpp"
+#include "vpu/softvector-simd.hpp"
+
+#include <cstdlib>
+#include <cstring>
+
+bool SVPolicy::enabled(void) {
+	static const bool ret = [] {
+		const char* env = std::getenv("SOFTVECTOR_AGNOSTIC");
+		return(env && !std::strcmp(env, "ones"));
+	}();
+	return(ret);
+}
 
 void SVector::assign(const SVector& vin, size_t start_index) {
 	for(size_t i_element = start_index; i_element < length_; ++i_element) {
@@ -34,592 +46,461 @@ SVector& SVector::operator=(const SVector& rhs) {
 	return (*this);
 }
 
-SVector SVector::operator+(const SVector& rhs) const {
-	SVector ret(length_, elements_[0]->width_in_bits_, start_reg_index_);
-	for(size_t i_element = 0; i_element < length_; ++i_element) {
-		ret[i_element] = (*this)[i_element] + rhs[i_element];
-	}
-	return(ret);
-}
-
-SVector SVector::operator+(const int64_t rhs) const {
-	SVector ret(length_, elements_[0]->width_in_bits_, start_reg_index_);
-	for(size_t i_element = 0; i_element < length_; ++i_element) {
-		ret[i_element] = (*this)[i_element] + rhs;
-	}
-	return(ret);
-}
-
-SVector SVector::operator&(const SVector& rhs) const {
-	SVector ret(length_, elements_[0]->width_in_bits_, start_reg_index_);
-	for(size_t i_element = 0; i_element < length_; ++i_element) {
-		ret[i_element] = (*this)[i_element] & rhs[i_element];
-	}
-	return(ret);
-}
-
-SVector SVector::operator&(const int64_t rhs) const {
-	SVector ret(length_, elements_[0]->width_in_bits_, start_reg_index_);
-	for(size_t i_element = 0; i_element < length_; ++i_element) {
-		ret[i_element] = (*this)[i_element] & rhs;
-	}
-	return(ret);
-}
-
-SVector SVector::operator|(const SVector& rhs) const {
-	SVector ret(length_, elements_[0]->width_in_bits_, start_reg_index_);
-	for(size_t i_element = 0; i_element < length_; ++i_element) {
-		ret[i_element] = (*this)[i_element] | rhs[i_element];
-	}
-	return(ret);
-}
-
-SVector SVector::operator|(const int64_t rhs) const {
-	SVector ret(length_, elements_[0]->width_in_bits_, start_reg_index_);
-	for(size_t i_element = 0; i_element < length_; ++i_element) {
-		ret[i_element] = (*this)[i_element] | rhs;
-	}
-	return(ret);
-}
-
-SVector SVector::operator^(const SVector& rhs) const {
-	SVector ret(length_, elements_[0]->width_in_bits_, start_reg_index_);
-	for(size_t i_element = 0; i_element < length_; ++i_element) {
-		ret[i_element] = (*this)[i_element] ^ rhs[i_element];
-	}
-	return(ret);
-}
-
-SVector SVector::operator^(const int64_t rhs) const {
-	SVector ret(length_, elements_[0]->width_in_bits_, start_reg_index_);
-	for(size_t i_element = 0; i_element < length_; ++i_element) {
-		ret[i_element] = (*this)[i_element] ^ rhs;
-	}
-	return(ret);
-}
-
-SVector SVector::operator-(const SVector& rhs) const {
-	SVector ret(length_, elements_[0]->width_in_bits_, start_reg_index_);
-	for(size_t i_element = 0; i_element < length_; ++i_element) {
-		ret[i_element] = (*this)[i_element] - rhs[i_element];
-	}
-	return(ret);
-}
-
-SVector SVector::operator-(const int64_t rhs) const {
-	SVector ret(length_, elements_[0]->width_in_bits_, start_reg_index_);
-	for(size_t i_element = 0; i_element < length_; ++i_element) {
-		ret[i_element] = (*this)[i_element] - rhs;
-	}
-	return(ret);
-}
-
-SVector SVector::operator<<(const SVector& rhs) const {
-	SVector ret(length_, elements_[0]->width_in_bits_, start_reg_index_);
-	for(size_t i_element = 0; i_element < length_; ++i_element) {
-		ret[i_element] = (*this)[i_element] << rhs[i_element];
-	}
-	return(ret);
-}
-
-SVector SVector::operator<<(const uint64_t rhs) const {
-	SVector ret(length_, elements_[0]->width_in_bits_, start_reg_index_);
-	for(size_t i_element = 0; i_element < length_; ++i_element) {
-		ret[i_element] = (*this)[i_element] << rhs;
-	}
-	return(ret);
-}
-
-SVector SVector::operator>>(const SVector& rhs) const {
-	SVector ret(length_, elements_[0]->width_in_bits_, start_reg_index_);
-	for(size_t i_element = 0; i_element < length_; ++i_element) {
-		ret[i_element] = (*this)[i_element] >> rhs[i_element];
-	}
-	return(ret);
-}
-
-SVector SVector::operator>>(const uint64_t rhs) const {
-	SVector ret(length_, elements_[0]->width_in_bits_, start_reg_index_);
-	for(size_t i_element = 0; i_element < length_; ++i_element) {
-		ret[i_element] = (*this)[i_element] >> rhs;
-	}
-	return(ret);
-}
-
-SVector SVector::srl(const SVector& rhs) const {
-	SVector ret(length_, elements_[0]->width_in_bits_, start_reg_index_);
-	for(size_t i_element = 0; i_element < length_; ++i_element) {
-		ret[i_element] = (*this)[i_element].srl(rhs[i_element]);
-	}
-	return(ret);
-}
-
-SVector SVector::srl(const uint64_t rhs) const {
-	SVector ret(length_, elements_[0]->width_in_bits_, start_reg_index_);
-	for(size_t i_element = 0; i_element < length_; ++i_element) {
-		ret[i_element] = (*this)[i_element].srl(rhs);
-	}
-	return(ret);
+// Comparisons write one bit per element into a zero initialized register of whole bytes. All elements are active, i.e. the mask operand is not read.
+inline size_t compare_bits(const SVector& v) {
+	return(8*((v.length_ + 7)/8));
 }
 
 SVRegister SVector::operator==(const SVector& rhs) const {
-	SVRegister ret(length_*(*this)[0].width_in_bits_/8);
-	for(size_t i_element = 0; i_element < length_; ++i_element) {
-		if((*this)[i_element] == rhs[i_element])
-			ret.toggle_bit(i_element);
-	}
+	SVRegister ret(compare_bits(*this));
+	ret.m_eq(*this, rhs, ret, false);
 	return(ret);
 }
 
 SVRegister SVector::operator==(const int64_t rhs) const {
-	SVRegister ret(length_*(*this)[0].width_in_bits_/8);
-	for(size_t i_element = 0; i_element < length_; ++i_element) {
-		if((*this)[i_element] == rhs)
-			ret.toggle_bit(i_element);
-	}
+	SVRegister ret(compare_bits(*this));
+	ret.m_eq(*this, rhs, ret, false);
 	return(ret);
 }
 
 SVRegister SVector::operator!=(const SVector& rhs) const {
-	SVRegister ret(length_*(*this)[0].width_in_bits_/8);
-	for(size_t i_element = 0; i_element < length_; ++i_element) {
-		if((*this)[i_element] != rhs[i_element])
-			ret.toggle_bit(i_element);
-	}
+	SVRegister ret(compare_bits(*this));
+	ret.m_neq(*this, rhs, ret, false);
 	return(ret);
 }
 
 SVRegister SVector::operator!=(const int64_t rhs) const {
-	SVRegister ret(length_*(*this)[0].width_in_bits_/8);
-	for(size_t i_element = 0; i_element < length_; ++i_element) {
-		if((*this)[i_element] != rhs)
-			ret.toggle_bit(i_element);
-	}
+	SVRegister ret(compare_bits(*this));
+	ret.m_neq(*this, rhs, ret, false);
 	return(ret);
 }
 
 // signed comparisons
 SVRegister SVector::operator<(const SVector& rhs) const {
-	SVRegister ret(length_*(*this)[0].width_in_bits_/8);
-	for(size_t i_element = 0; i_element < length_; ++i_element) {
-		if((*this)[i_element] < rhs[i_element])
-			ret.toggle_bit(i_element);
-	}
+	SVRegister ret(compare_bits(*this));
+	ret.m_s_lt(*this, rhs, ret, false);
 	return(ret);
 }
 
 SVRegister SVector::operator<(const int64_t rhs) const {
-	SVRegister ret(length_*(*this)[0].width_in_bits_/8);
-	for(size_t i_element = 0; i_element < length_; ++i_element) {
-		if((*this)[i_element] < rhs)
-			ret.toggle_bit(i_element);
-	}
+	SVRegister ret(compare_bits(*this));
+	ret.m_s_lt(*this, rhs, ret, false);
 	return(ret);
 }
 
 SVRegister SVector::operator<=(const SVector& rhs) const {
-	SVRegister ret(length_*(*this)[0].width_in_bits_/8);
-	for(size_t i_element = 0; i_element < length_; ++i_element) {
-		if((*this)[i_element] <= rhs[i_element])
-			ret.toggle_bit(i_element);
-	}
+	SVRegister ret(compare_bits(*this));
+	ret.m_s_lte(*this, rhs, ret, false);
 	return(ret);
 }
 
 SVRegister SVector::operator<=(const int64_t rhs) const {
-	SVRegister ret(length_*(*this)[0].width_in_bits_/8);
-	for(size_t i_element = 0; i_element < length_; ++i_element) {
-		if((*this)[i_element] <= rhs)
-			ret.toggle_bit(i_element);
-	}
+	SVRegister ret(compare_bits(*this));
+	ret.m_s_lte(*this, rhs, ret, false);
 	return(ret);
 }
 
 SVRegister SVector::operator>(const SVector& rhs) const {
-	return(rhs < *this);
+	SVRegister ret(compare_bits(*this));
+	ret.m_s_gt(*this, rhs, ret, false);
+	return(ret);
 }
 
 SVRegister SVector::operator>(const int64_t rhs) const {
-	SVRegister ret(length_*(*this)[0].width_in_bits_/8);
-	for(size_t i_element = 0; i_element < length_; ++i_element) {
-		if((*this)[i_element] > rhs)
-			ret.toggle_bit(i_element);
-	}
+	SVRegister ret(compare_bits(*this));
+	ret.m_s_gt(*this, rhs, ret, false);
 	return(ret);
 }
 
 SVRegister SVector::operator>=(const SVector& rhs) const {
-	return(rhs <= *this);
+	SVRegister ret(compare_bits(*this));
+	ret.m_s_gte(*this, rhs, ret, false);
+	return(ret);
 }
 
 SVRegister SVector::operator>=(const int64_t rhs) const {
-	SVRegister ret(length_*(*this)[0].width_in_bits_/8);
-	for(size_t i_element = 0; i_element < length_; ++i_element) {
-		if((*this)[i_element] >= rhs)
-			ret.toggle_bit(i_element);
-	}
+	SVRegister ret(compare_bits(*this));
+	ret.m_s_gte(*this, rhs, ret, false);
 	return(ret);
 }
 
 // unsigned comparisons
 SVRegister SVector::op_u_lt(const SVector& rhs) const {
-	SVRegister ret(length_*(*this)[0].width_in_bits_/8);
-	for(size_t i_element = 0; i_element < length_; ++i_element) {
-		if( (*this)[i_element].op_u_lt(rhs[i_element]))
-			ret.toggle_bit(i_element);
-	}
+	SVRegister ret(compare_bits(*this));
+	ret.m_u_lt(*this, rhs, ret, false);
 	return(ret);
 }
 
 SVRegister SVector::op_u_lt(const uint64_t rhs) const {
-	SVRegister ret(length_*(*this)[0].width_in_bits_/8);
-	for(size_t i_element = 0; i_element < length_; ++i_element) {
-		if( (*this)[i_element].op_u_lt(rhs))
-			ret.toggle_bit(i_element);
-	}
+	SVRegister ret(compare_bits(*this));
+	ret.m_u_lt(*this, rhs, ret, false);
 	return(ret);
 }
 
 SVRegister SVector::op_u_lte(const SVector& rhs) const {
-	SVRegister ret(length_*(*this)[0].width_in_bits_/8);
-	for(size_t i_element = 0; i_element < length_; ++i_element) {
-		if( (*this)[i_element].op_u_lte(rhs[i_element]))
-			ret.toggle_bit(i_element);
-	}
+	SVRegister ret(compare_bits(*this));
+	ret.m_u_lte(*this, rhs, ret, false);
 	return(ret);
 }
 
 SVRegister SVector::op_u_lte(const uint64_t rhs) const {
-	SVRegister ret(length_*(*this)[0].width_in_bits_/8);
-	for(size_t i_element = 0; i_element < length_; ++i_element) {
-		if( (*this)[i_element].op_u_lte(rhs))
-			ret.toggle_bit(i_element);
-	}
+	SVRegister ret(compare_bits(*this));
+	ret.m_u_lte(*this, rhs, ret, false);
 	return(ret);
 }
 
 SVRegister SVector::op_u_gt(const SVector& rhs) const {
-	return ( rhs.op_u_lt(*this));
+	SVRegister ret(compare_bits(*this));
+	ret.m_u_gt(*this, rhs, ret, false);
+	return(ret);
 }
 
 SVRegister SVector::op_u_gt(const uint64_t rhs) const {
-	SVRegister ret(length_*(*this)[0].width_in_bits_/8);
-	for(size_t i_element = 0; i_element < length_; ++i_element) {
-		if( (*this)[i_element].op_u_gt(rhs))
-			ret.toggle_bit(i_element);
-	}
+	SVRegister ret(compare_bits(*this));
+	ret.m_u_gt(*this, rhs, ret, false);
 	return(ret);
 }
 
 SVRegister SVector::op_u_gte(const SVector& rhs) const {
-	return ( rhs.op_u_lte(*this));
+	SVRegister ret(compare_bits(*this));
+	ret.m_u_gte(*this, rhs, ret, false);
+	return(ret);
 }
 
 SVRegister SVector::op_u_gte(const uint64_t rhs) const {
-	SVRegister ret(length_*(*this)[0].width_in_bits_/8);
-	for(size_t i_element = 0; i_element < length_; ++i_element) {
-		if( (*this)[i_element].op_u_gte(rhs))
-			ret.toggle_bit(i_element);
-	}
+	SVRegister ret(compare_bits(*this));
+	ret.m_u_gte(*this, rhs, ret, false);
 	return(ret);
 }
 
 // masked ops
 void SVector::m_assign(const SVector& vin, const SVRegister& vm, bool mask, size_t start_index) {
-	for(size_t i_element = start_index; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			(*this)[i_element] = vin[i_element];
-	}
+	vm.for_each_active(start_index, length_, mask, [&](size_t i_element) {
+		(*this)[i_element] = vin[i_element];
+	});
 }
 
 void SVector::m_assign(const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index) {
-	for(size_t i_element = start_index; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			(*this)[i_element] = rhs;
-	}
+	vm.for_each_active(start_index, length_, mask, [&](size_t i_element) {
+		(*this)[i_element] = rhs;
+	});
 }
 
-SVector& SVector::m_add(const SVector& opL, const SVector& rhs,  const SVRegister& vm, bool mask, size_t start_index) {
-	for(size_t i_element = start_index; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			(*this)[i_element].s_add(opL[i_element], rhs[i_element]);
+SVector& SVector::fill_agnostic(const SVRegister& vm, bool mask, size_t start_index, const SVPolicy& policy) {
+	if(start_index >= length_) {
+		return(*this);
+	}
+	const size_t element_bytes = single_element_width_bits_/8;
+	if(mask && policy.mask_agnostic_) {
+		vm.for_each_run(start_index, length_, false, [&](size_t i_element, size_t n_elements) {
+			std::memset(mem_ + i_element*element_bytes, 0xFF, n_elements*element_bytes);
+		});
+	}
+	if(policy.tail_end_ > length_) {
+		std::memset(mem_ + length_*element_bytes, 0xFF, (policy.tail_end_ - length_)*element_bytes);
 	}
 	return(*this);
 }
 
+SVector& SVector::m_add(const SVector& opL, const SVector& rhs,  const SVRegister& vm, bool mask, size_t start_index, const SVPolicy& policy) {
+	if(SVSIMD::vv<SVSIMD::OP::ADD>(single_element_width_bits_, mem_, opL.mem_, rhs.mem_, length_, mask ? vm.mem_ : nullptr, start_index, policy.mask_agnostic_)) {
+		return(fill_agnostic(vm, false, start_index, policy));
+	}
+	vm.for_each_active(start_index, length_, mask, [&](size_t i_element) {
+		(*this)[i_element].s_add(opL[i_element], rhs[i_element]);
+	});
+	return(fill_agnostic(vm, mask, start_index, policy));
+}
 
-SVector& SVector::m_add(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index ) {
-	for(size_t i_element = start_index; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			(*this)[i_element].s_add(opL[i_element], rhs);
+
+SVector& SVector::m_add(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index, const SVPolicy& policy) {
+	if(SVSIMD::vx<SVSIMD::OP::ADD>(single_element_width_bits_, mem_, opL.mem_, rhs, length_, mask ? vm.mem_ : nullptr, start_index, policy.mask_agnostic_)) {
+		return(fill_agnostic(vm, false, start_index, policy));
 	}
-	return(*this);
+	vm.for_each_active(start_index, length_, mask, [&](size_t i_element) {
+		(*this)[i_element].s_add(opL[i_element], rhs);
+	});
+	return(fill_agnostic(vm, mask, start_index, policy));
 }
 
-SVector& SVector::m_sub(const SVector& opL, const SVector& rhs,  const SVRegister& vm, bool mask, size_t start_index) {
-	for(size_t i_element = start_index; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			(*this)[i_element].s_sub(opL[i_element], rhs[i_element]);
+SVector& SVector::m_sub(const SVector& opL, const SVector& rhs,  const SVRegister& vm, bool mask, size_t start_index, const SVPolicy& policy) {
+	if(SVSIMD::vv<SVSIMD::OP::SUB>(single_element_width_bits_, mem_, opL.mem_, rhs.mem_, length_, mask ? vm.mem_ : nullptr, start_index, policy.mask_agnostic_)) {
+		return(fill_agnostic(vm, false, start_index, policy));
 	}
-	return(*this);
+	vm.for_each_active(start_index, length_, mask, [&](size_t i_element) {
+		(*this)[i_element].s_sub(opL[i_element], rhs[i_element]);
+	});
+	return(fill_agnostic(vm, mask, start_index, policy));
 }
 
-SVector& SVector::m_sub(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index ) {
-	for(size_t i_element = start_index; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			(*this)[i_element].s_sub(opL[i_element], rhs);
+SVector& SVector::m_sub(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index, const SVPolicy& policy) {
+	if(SVSIMD::vx<SVSIMD::OP::SUB>(single_element_width_bits_, mem_, opL.mem_, rhs, length_, mask ? vm.mem_ : nullptr, start_index, policy.mask_agnostic_)) {
+		return(fill_agnostic(vm, false, start_index, policy));
 	}
-	return(*this);
+	vm.for_each_active(start_index, length_, mask, [&](size_t i_element) {
+		(*this)[i_element].s_sub(opL[i_element], rhs);
+	});
+	return(fill_agnostic(vm, mask, start_index, policy));
 }
 
 SVector& SVector::m_rsub(const int64_t lhs, const SVector& opR, const SVRegister& vm, bool mask, size_t start_index ) {
-	for(size_t i_element = start_index; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			(*this)[i_element].s_rsub(lhs, opR[i_element]);
-	}
+	vm.for_each_active(start_index, length_, mask, [&](size_t i_element) {
+		(*this)[i_element].s_rsub(lhs, opR[i_element]);
+	});
 	return(*this);
 }
 
 SVector& SVector::m_waddu(const SVector& opL, const SVector& rhs,  const SVRegister& vm, bool mask, size_t start_index) {
-	for(size_t i_element = start_index; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			(*this)[i_element].s_waddu(opL[i_element], rhs[i_element]);
-	}
+	vm.for_each_active(start_index, length_, mask, [&](size_t i_element) {
+		(*this)[i_element].s_waddu(opL[i_element], rhs[i_element]);
+	});
 	return(*this);
 }
 
 SVector& SVector::m_waddu(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index ) {
-	for(size_t i_element = start_index; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			(*this)[i_element].s_waddu(opL[i_element], rhs);
-	}
+	vm.for_each_active(start_index, length_, mask, [&](size_t i_element) {
+		(*this)[i_element].s_waddu(opL[i_element], rhs);
+	});
 	return(*this);
 }
 
 SVector& SVector::m_wsubu(const SVector& opL, const SVector& rhs,  const SVRegister& vm, bool mask, size_t start_index) {
-	for(size_t i_element = start_index; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			(*this)[i_element].s_wsubu(opL[i_element], rhs[i_element]);
-	}
+	vm.for_each_active(start_index, length_, mask, [&](size_t i_element) {
+		(*this)[i_element].s_wsubu(opL[i_element], rhs[i_element]);
+	});
 	return(*this);
 }
 
 SVector& SVector::m_wsubu(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index ) {
-	for(size_t i_element = start_index; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			(*this)[i_element].s_wsubu(opL[i_element], rhs);
-	}
+	vm.for_each_active(start_index, length_, mask, [&](size_t i_element) {
+		(*this)[i_element].s_wsubu(opL[i_element], rhs);
+	});
 	return(*this);
 }
 
 SVector& SVector::m_wadd(const SVector& opL, const SVector& rhs,  const SVRegister& vm, bool mask, size_t start_index) {
-	for(size_t i_element = start_index; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			(*this)[i_element].s_wadd(opL[i_element], rhs[i_element]);
-	}
+	vm.for_each_active(start_index, length_, mask, [&](size_t i_element) {
+		(*this)[i_element].s_wadd(opL[i_element], rhs[i_element]);
+	});
 	return(*this);
 }
 
 SVector& SVector::m_wadd(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index ) {
-	for(size_t i_element = start_index; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			(*this)[i_element].s_wadd(opL[i_element], rhs);
-	}
+	vm.for_each_active(start_index, length_, mask, [&](size_t i_element) {
+		(*this)[i_element].s_wadd(opL[i_element], rhs);
+	});
 	return(*this);
 }
 
 SVector& SVector::m_wsub(const SVector& opL, const SVector& rhs,  const SVRegister& vm, bool mask, size_t start_index) {
-	for(size_t i_element = start_index; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			(*this)[i_element].s_wsub(opL[i_element], rhs[i_element]);
-	}
+	vm.for_each_active(start_index, length_, mask, [&](size_t i_element) {
+		(*this)[i_element].s_wsub(opL[i_element], rhs[i_element]);
+	});
 	return(*this);
 }
 
 SVector& SVector::m_wsub(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index ) {
-	for(size_t i_element = start_index; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			(*this)[i_element].s_wsub(opL[i_element], rhs);
-	}
+	vm.for_each_active(start_index, length_, mask, [&](size_t i_element) {
+		(*this)[i_element].s_wsub(opL[i_element], rhs);
+	});
 	return(*this);
 }
 //12.10 Multiplikation
-SVector& SVector::m_ssmul(const SVector& opL, const SVector& rhs, const SVRegister& vm, bool mask, size_t start_index ) {
-	for(size_t i_element = start_index; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			(*this)[i_element].s_ssmul(opL[i_element], rhs[i_element]);
+SVector& SVector::m_ssmul(const SVector& opL, const SVector& rhs, const SVRegister& vm, bool mask, size_t start_index, const SVPolicy& policy) {
+	if(SVSIMD::vv<SVSIMD::OP::MUL>(single_element_width_bits_, mem_, opL.mem_, rhs.mem_, length_, mask ? vm.mem_ : nullptr, start_index, policy.mask_agnostic_)) {
+		return(fill_agnostic(vm, false, start_index, policy));
 	}
-	return(*this);
+	vm.for_each_active(start_index, length_, mask, [&](size_t i_element) {
+		(*this)[i_element].s_ssmul(opL[i_element], rhs[i_element]);
+	});
+	return(fill_agnostic(vm, mask, start_index, policy));
 }
-SVector& SVector::m_ssmul(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index) {
-	for(size_t i_element = start_index; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			(*this)[i_element].s_ssmul(opL[i_element], rhs);
+SVector& SVector::m_ssmul(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index, const SVPolicy& policy) {
+	if(SVSIMD::vx<SVSIMD::OP::MUL>(single_element_width_bits_, mem_, opL.mem_, rhs, length_, mask ? vm.mem_ : nullptr, start_index, policy.mask_agnostic_)) {
+		return(fill_agnostic(vm, false, start_index, policy));
 	}
-	return(*this);
+	vm.for_each_active(start_index, length_, mask, [&](size_t i_element) {
+		(*this)[i_element].s_ssmul(opL[i_element], rhs);
+	});
+	return(fill_agnostic(vm, mask, start_index, policy));
 }
 SVector& SVector::m_ssmulh(const SVector& opL, const SVector& rhs, const SVRegister& vm, bool mask, size_t start_index ) {
-	for(size_t i_element = start_index; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			(*this)[i_element].s_ssmulh(opL[i_element], rhs[i_element]);
-	}
+	vm.for_each_active(start_index, length_, mask, [&](size_t i_element) {
+		(*this)[i_element].s_ssmulh(opL[i_element], rhs[i_element]);
+	});
 	return(*this);
 }
 SVector& SVector::m_ssmulh(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index) {
-	for(size_t i_element = start_index; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			(*this)[i_element].s_ssmulh(opL[i_element], rhs);
-	}
+	vm.for_each_active(start_index, length_, mask, [&](size_t i_element) {
+		(*this)[i_element].s_ssmulh(opL[i_element], rhs);
+	});
 	return(*this);
 }
 SVector& SVector::m_uumulh(const SVector& opL, const SVector& rhs, const SVRegister& vm, bool mask, size_t start_index ) {
-	for(size_t i_element = start_index; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			(*this)[i_element].s_uumulh(opL[i_element], rhs[i_element]);
-	}
+	vm.for_each_active(start_index, length_, mask, [&](size_t i_element) {
+		(*this)[i_element].s_uumulh(opL[i_element], rhs[i_element]);
+	});
 	return(*this);
 }
 SVector& SVector::m_uumulh(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index) {
-	for(size_t i_element = start_index; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			(*this)[i_element].s_uumulh(opL[i_element], rhs);
-	}
+	vm.for_each_active(start_index, length_, mask, [&](size_t i_element) {
+		(*this)[i_element].s_uumulh(opL[i_element], rhs);
+	});
 	return(*this);
 }
 SVector& SVector::m_sumulh(const SVector& opL, const SVector& rhs, const SVRegister& vm, bool mask, size_t start_index ) {
-	for(size_t i_element = start_index; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			(*this)[i_element].s_sumulh(opL[i_element], rhs[i_element]);
-	}
+	vm.for_each_active(start_index, length_, mask, [&](size_t i_element) {
+		(*this)[i_element].s_sumulh(opL[i_element], rhs[i_element]);
+	});
 	return(*this);
 }
 SVector& SVector::m_sumulh(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index) {
-	for(size_t i_element = start_index; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			(*this)[i_element].s_sumulh(opL[i_element], rhs);
-	}
+	vm.for_each_active(start_index, length_, mask, [&](size_t i_element) {
+		(*this)[i_element].s_sumulh(opL[i_element], rhs);
+	});
 	return(*this);
 }
 
-SVector& SVector::m_and(const SVector& opL, const SVector& rhs,  const SVRegister& vm, bool mask, size_t start_index) {
-	for(size_t i_element = start_index; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			(*this)[i_element].s_and(opL[i_element], rhs[i_element]);
+SVector& SVector::m_and(const SVector& opL, const SVector& rhs,  const SVRegister& vm, bool mask, size_t start_index, const SVPolicy& policy) {
+	if(SVSIMD::vv<SVSIMD::OP::AND>(single_element_width_bits_, mem_, opL.mem_, rhs.mem_, length_, mask ? vm.mem_ : nullptr, start_index, policy.mask_agnostic_)) {
+		return(fill_agnostic(vm, false, start_index, policy));
 	}
-	return(*this);
+	vm.for_each_active(start_index, length_, mask, [&](size_t i_element) {
+		(*this)[i_element].s_and(opL[i_element], rhs[i_element]);
+	});
+	return(fill_agnostic(vm, mask, start_index, policy));
 }
 
-SVector& SVector::m_and(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index ) {
-	for(size_t i_element = start_index; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			(*this)[i_element].s_and(opL[i_element], rhs);
+SVector& SVector::m_and(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index, const SVPolicy& policy) {
+	if(SVSIMD::vx<SVSIMD::OP::AND>(single_element_width_bits_, mem_, opL.mem_, rhs, length_, mask ? vm.mem_ : nullptr, start_index, policy.mask_agnostic_)) {
+		return(fill_agnostic(vm, false, start_index, policy));
 	}
-	return(*this);
+	vm.for_each_active(start_index, length_, mask, [&](size_t i_element) {
+		(*this)[i_element].s_and(opL[i_element], rhs);
+	});
+	return(fill_agnostic(vm, mask, start_index, policy));
 }
 
-SVector& SVector::m_or(const SVector& opL, const SVector& rhs,  const SVRegister& vm, bool mask, size_t start_index) {
-	for(size_t i_element = start_index; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			(*this)[i_element].s_or(opL[i_element], rhs[i_element]);
+SVector& SVector::m_or(const SVector& opL, const SVector& rhs,  const SVRegister& vm, bool mask, size_t start_index, const SVPolicy& policy) {
+	if(SVSIMD::vv<SVSIMD::OP::OR>(single_element_width_bits_, mem_, opL.mem_, rhs.mem_, length_, mask ? vm.mem_ : nullptr, start_index, policy.mask_agnostic_)) {
+		return(fill_agnostic(vm, false, start_index, policy));
 	}
-	return(*this);
+	vm.for_each_active(start_index, length_, mask, [&](size_t i_element) {
+		(*this)[i_element].s_or(opL[i_element], rhs[i_element]);
+	});
+	return(fill_agnostic(vm, mask, start_index, policy));
 }
 
-SVector& SVector::m_or(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index ) {
-	for(size_t i_element = start_index; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			(*this)[i_element].s_or(opL[i_element], rhs);
+SVector& SVector::m_or(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index, const SVPolicy& policy) {
+	if(SVSIMD::vx<SVSIMD::OP::OR>(single_element_width_bits_, mem_, opL.mem_, rhs, length_, mask ? vm.mem_ : nullptr, start_index, policy.mask_agnostic_)) {
+		return(fill_agnostic(vm, false, start_index, policy));
 	}
-	return(*this);
+	vm.for_each_active(start_index, length_, mask, [&](size_t i_element) {
+		(*this)[i_element].s_or(opL[i_element], rhs);
+	});
+	return(fill_agnostic(vm, mask, start_index, policy));
 }
 
-SVector& SVector::m_xor(const SVector& opL, const SVector& rhs,  const SVRegister& vm, bool mask, size_t start_index) {
-	for(size_t i_element = start_index; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			(*this)[i_element].s_xor(opL[i_element], rhs[i_element]);
+SVector& SVector::m_xor(const SVector& opL, const SVector& rhs,  const SVRegister& vm, bool mask, size_t start_index, const SVPolicy& policy) {
+	if(SVSIMD::vv<SVSIMD::OP::XOR>(single_element_width_bits_, mem_, opL.mem_, rhs.mem_, length_, mask ? vm.mem_ : nullptr, start_index, policy.mask_agnostic_)) {
+		return(fill_agnostic(vm, false, start_index, policy));
 	}
-	return(*this);
+	vm.for_each_active(start_index, length_, mask, [&](size_t i_element) {
+		(*this)[i_element].s_xor(opL[i_element], rhs[i_element]);
+	});
+	return(fill_agnostic(vm, mask, start_index, policy));
 }
 
-SVector& SVector::m_xor(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index ) {
-	for(size_t i_element = start_index; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			(*this)[i_element].s_xor(opL[i_element], rhs);
+SVector& SVector::m_xor(const SVector& opL, const int64_t rhs, const SVRegister& vm, bool mask, size_t start_index, const SVPolicy& policy) {
+	if(SVSIMD::vx<SVSIMD::OP::XOR>(single_element_width_bits_, mem_, opL.mem_, rhs, length_, mask ? vm.mem_ : nullptr, start_index, policy.mask_agnostic_)) {
+		return(fill_agnostic(vm, false, start_index, policy));
 	}
-	return(*this);
+	vm.for_each_active(start_index, length_, mask, [&](size_t i_element) {
+		(*this)[i_element].s_xor(opL[i_element], rhs);
+	});
+	return(fill_agnostic(vm, mask, start_index, policy));
 }
 
-SVector& SVector::m_sll(const SVector& opL, const SVector& rhs,  const SVRegister& vm, bool mask, size_t start_index) {
-	for(size_t i_element = start_index; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			(*this)[i_element].s_sll(opL[i_element], rhs[i_element]);
+SVector& SVector::m_sll(const SVector& opL, const SVector& rhs,  const SVRegister& vm, bool mask, size_t start_index, const SVPolicy& policy) {
+	if(SVSIMD::vv<SVSIMD::OP::SLL>(single_element_width_bits_, mem_, opL.mem_, rhs.mem_, length_, mask ? vm.mem_ : nullptr, start_index, policy.mask_agnostic_)) {
+		return(fill_agnostic(vm, false, start_index, policy));
 	}
-	return(*this);
+	vm.for_each_active(start_index, length_, mask, [&](size_t i_element) {
+		(*this)[i_element].s_sll(opL[i_element], rhs[i_element]);
+	});
+	return(fill_agnostic(vm, mask, start_index, policy));
 }
 
-SVector& SVector::m_sll(const SVector& opL, const uint64_t rhs, const SVRegister& vm, bool mask, size_t start_index ) {
-	for(size_t i_element = start_index; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			(*this)[i_element].s_sll(opL[i_element], rhs);
+SVector& SVector::m_sll(const SVector& opL, const uint64_t rhs, const SVRegister& vm, bool mask, size_t start_index, const SVPolicy& policy) {
+	if(SVSIMD::vx<SVSIMD::OP::SLL>(single_element_width_bits_, mem_, opL.mem_, rhs, length_, mask ? vm.mem_ : nullptr, start_index, policy.mask_agnostic_)) {
+		return(fill_agnostic(vm, false, start_index, policy));
 	}
-	return(*this);
+	vm.for_each_active(start_index, length_, mask, [&](size_t i_element) {
+		(*this)[i_element].s_sll(opL[i_element], rhs);
+	});
+	return(fill_agnostic(vm, mask, start_index, policy));
 }
 
-SVector& SVector::m_sra(const SVector& opL, const SVector& rhs,  const SVRegister& vm, bool mask, size_t start_index) {
-	for(size_t i_element = start_index; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			(*this)[i_element].s_sra(opL[i_element], rhs[i_element]);
+SVector& SVector::m_sra(const SVector& opL, const SVector& rhs,  const SVRegister& vm, bool mask, size_t start_index, const SVPolicy& policy) {
+	if(SVSIMD::vv<SVSIMD::OP::SRA>(single_element_width_bits_, mem_, opL.mem_, rhs.mem_, length_, mask ? vm.mem_ : nullptr, start_index, policy.mask_agnostic_)) {
+		return(fill_agnostic(vm, false, start_index, policy));
 	}
-	return(*this);
+	vm.for_each_active(start_index, length_, mask, [&](size_t i_element) {
+		(*this)[i_element].s_sra(opL[i_element], rhs[i_element]);
+	});
+	return(fill_agnostic(vm, mask, start_index, policy));
 }
 
-SVector& SVector::m_sra(const SVector& opL, const uint64_t rhs, const SVRegister& vm, bool mask, size_t start_index ) {
-	for(size_t i_element = start_index; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			(*this)[i_element].s_sra(opL[i_element], rhs);
+SVector& SVector::m_sra(const SVector& opL, const uint64_t rhs, const SVRegister& vm, bool mask, size_t start_index, const SVPolicy& policy) {
+	if(SVSIMD::vx<SVSIMD::OP::SRA>(single_element_width_bits_, mem_, opL.mem_, rhs, length_, mask ? vm.mem_ : nullptr, start_index, policy.mask_agnostic_)) {
+		return(fill_agnostic(vm, false, start_index, policy));
 	}
-	return(*this);
+	vm.for_each_active(start_index, length_, mask, [&](size_t i_element) {
+		(*this)[i_element].s_sra(opL[i_element], rhs);
+	});
+	return(fill_agnostic(vm, mask, start_index, policy));
 }
 
-SVector& SVector::m_srl(const SVector& opL, const SVector& rhs,  const SVRegister& vm, bool mask, size_t start_index) {
-	for(size_t i_element = start_index; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			(*this)[i_element].s_srl(opL[i_element], rhs[i_element]);
+SVector& SVector::m_srl(const SVector& opL, const SVector& rhs,  const SVRegister& vm, bool mask, size_t start_index, const SVPolicy& policy) {
+	if(SVSIMD::vv<SVSIMD::OP::SRL>(single_element_width_bits_, mem_, opL.mem_, rhs.mem_, length_, mask ? vm.mem_ : nullptr, start_index, policy.mask_agnostic_)) {
+		return(fill_agnostic(vm, false, start_index, policy));
 	}
-	return(*this);
+	vm.for_each_active(start_index, length_, mask, [&](size_t i_element) {
+		(*this)[i_element].s_srl(opL[i_element], rhs[i_element]);
+	});
+	return(fill_agnostic(vm, mask, start_index, policy));
 }
 
-SVector& SVector::m_srl(const SVector& opL, const uint64_t rhs, const SVRegister& vm, bool mask, size_t start_index ) {
-	for(size_t i_element = start_index; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			(*this)[i_element].s_srl(opL[i_element], rhs);
+SVector& SVector::m_srl(const SVector& opL, const uint64_t rhs, const SVRegister& vm, bool mask, size_t start_index, const SVPolicy& policy) {
+	if(SVSIMD::vx<SVSIMD::OP::SRL>(single_element_width_bits_, mem_, opL.mem_, rhs, length_, mask ? vm.mem_ : nullptr, start_index, policy.mask_agnostic_)) {
+		return(fill_agnostic(vm, false, start_index, policy));
 	}
-	return(*this);
+	vm.for_each_active(start_index, length_, mask, [&](size_t i_element) {
+		(*this)[i_element].s_srl(opL[i_element], rhs);
+	});
+	return(fill_agnostic(vm, mask, start_index, policy));
 }
 
 SVector& SVector::m_slideup(const SVector& opL, const uint64_t rhs, const SVRegister& vm, bool mask, size_t start_index ) {
 	size_t max = rhs > start_index ? rhs : start_index;
-	for(size_t i_element = max; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element))
-			(*this)[i_element] = opL[i_element];
-	}
+	vm.for_each_active(max, length_, mask, [&](size_t i_element) {
+		(*this)[i_element] = opL[i_element];
+	});
 	return(*this);
 }
 
 SVector& SVector::m_slidedown(const SVector& opL, const uint64_t rhs, const SVRegister& vm, bool mask, size_t vlmax, size_t start_index ) {
-	for(size_t i_element = start_index; i_element < length_; ++i_element) {
-		if(!mask || vm.get_bit(i_element)) {
-			size_t i_src_element = i_element + rhs;
-			if(i_src_element < length_) {
-				(*this)[i_element] = opL[i_element + rhs];
+	vm.for_each_active(start_index, length_, mask, [&](size_t i_element) {
+		size_t i_src_element = i_element + rhs;
+		if(i_src_element < length_) {
+			(*this)[i_element] = opL[i_element + rhs];
+		} else {
+			if (i_src_element < vlmax) {
+				(*this)[i_element] = SVElement(opL[0].width_in_bits_ , opL[0].mem_ + i_src_element*opL[0].width_in_bits_/8);
 			} else {
-				if (i_src_element < vlmax) {
-					(*this)[i_element] = SVElement(opL[0].width_in_bits_ , opL[0].mem_ + i_src_element*opL[0].width_in_bits_/8);
-				} else {
-					(*this)[i_element] = 0;
-				}
+				(*this)[i_element] = 0;
 			}
 		}
-	}
+	});
 	return(*this);
 }
@@ -1322,6 +1322,159 @@ public:
 };
 
 
+//12.8
+class Cvmseq_vv final
+	: public VCase {
+public:
+	uint8_t _vs1{};
+	uint8_t _vs2{};
+
+	Cvmseq_vv(std::string& path_to_golden_file)
+	:	VCase(path_to_golden_file) {
+		mPars.push_back(new IntegerParameter<uint8_t>("VS2", _vs2, CaseParameter::DATT::UINT8));
+		mPars.push_back(new IntegerParameter<uint8_t>("VS1", _vs1, CaseParameter::DATT::UINT8));
+		init();
+		if(initdone > 0) {
+			run_return = run();
+			compare_return = compare_outputs(run_return);
+		}
+	}
+
+	virtual ~Cvmseq_vv(void) {}
+
+	bool run(void) {
+		uint16_t vtype = VTYPE::encode(_sew, _Zlmul, _Nlmul, 0, 0);
+		rep_ISET();
+
+		auto ret = vmseq_vv(
+			_V,
+			vtype,
+			_vm,
+			_vd,
+			_vs1,
+			_vs2,
+			_vstart,
+			_vlen,
+			_vl);
+
+		return (ret);
+	}
+};
+
+class Cvmseq_vi final
+	: public VCase {
+public:
+	uint8_t _vs2{};
+	int8_t _vimm{};
+
+	Cvmseq_vi(std::string& path_to_golden_file)
+	:	VCase(path_to_golden_file) {
+		mPars.push_back(new IntegerParameter<uint8_t>("VS2", _vs2, CaseParameter::DATT::UINT8));
+		mPars.push_back(new IntegerParameter<int8_t>("VIMM", _vimm, CaseParameter::DATT::INT8));
+		init();
+		if(initdone > 0) {
+			run_return = run();
+			compare_return = compare_outputs(run_return);
+		}
+	}
+
+	virtual ~Cvmseq_vi(void) {}
+
+	bool run(void) {
+		uint16_t vtype = VTYPE::encode(_sew, _Zlmul, _Nlmul, 0, 0);
+		rep_ISET();
+
+		auto ret = vmseq_vi(
+			_V,
+			vtype,
+			_vm,
+			_vd,
+			_vs2,
+			_vimm,
+			_vstart,
+			_vlen,
+			_vl);
+
+		return (ret);
+	}
+};
+
+class Cvmslt_vv final
+	: public VCase {
+public:
+	uint8_t _vs1{};
+	uint8_t _vs2{};
+
+	Cvmslt_vv(std::string& path_to_golden_file)
+	:	VCase(path_to_golden_file) {
+		mPars.push_back(new IntegerParameter<uint8_t>("VS2", _vs2, CaseParameter::DATT::UINT8));
+		mPars.push_back(new IntegerParameter<uint8_t>("VS1", _vs1, CaseParameter::DATT::UINT8));
+		init();
+		if(initdone > 0) {
+			run_return = run();
+			compare_return = compare_outputs(run_return);
+		}
+	}
+
+	virtual ~Cvmslt_vv(void) {}
+
+	bool run(void) {
+		uint16_t vtype = VTYPE::encode(_sew, _Zlmul, _Nlmul, 0, 0);
+		rep_ISET();
+
+		auto ret = vmslt_vv(
+			_V,
+			vtype,
+			_vm,
+			_vd,
+			_vs1,
+			_vs2,
+			_vstart,
+			_vlen,
+			_vl);
+
+		return (ret);
+	}
+};
+
+class Cvmsleu_vi final
+	: public VCase {
+public:
+	uint8_t _vs2{};
+	int8_t _vimm{};
+
+	Cvmsleu_vi(std::string& path_to_golden_file)
+	:	VCase(path_to_golden_file) {
+		mPars.push_back(new IntegerParameter<uint8_t>("VS2", _vs2, CaseParameter::DATT::UINT8));
+		mPars.push_back(new IntegerParameter<int8_t>("VIMM", _vimm, CaseParameter::DATT::INT8));
+		init();
+		if(initdone > 0) {
+			run_return = run();
+			compare_return = compare_outputs(run_return);
+		}
+	}
+
+	virtual ~Cvmsleu_vi(void) {}
+
+	bool run(void) {
+		uint16_t vtype = VTYPE::encode(_sew, _Zlmul, _Nlmul, 0, 0);
+		rep_ISET();
+
+		auto ret = vmsleu_vi(
+			_V,
+			vtype,
+			_vm,
+			_vd,
+			_vs2,
+			_vimm,
+			_vstart,
+			_vlen,
+			_vl);
+
+		return (ret);
+	}
+};
+
 class Cvload_encoded_unitstride final
 	: public VCase {
 public:
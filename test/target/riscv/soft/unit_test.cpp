@@ -16,12 +16,19 @@
 
 #include "cases.hpp"
 #include "softvector.h"
+#include "vpu/softvector-types.hpp"
 #include "gtest/gtest.h"
 #include <stdio.h>
 #include "stdint.h"
 #include <cstdlib>
 #include <iostream>
+#include <cstring>
+#include <vector>
+#include <functional>
 #include <ctime>
+#include <algorithm>
+#include <random>
+#include <string>
 #include <dirent.h>
 #include <sys/types.h>
 
@@ -784,6 +791,99 @@ public:
 		}
 	}
 };
+//12.8 compare
+class Cvmseq_vvTest
+	: public ::testing::Test {
+public:
+	std::vector<Cvmseq_vv*> cases;
+	Cvmseq_vvTest(void) {
+
+		std::vector<std::string> golden_files;
+		std::vector<std::string> case_files;
+
+		read_directory(gGoldenDir.c_str(), golden_files);
+		for (auto& _f: golden_files) {
+			if(_f.find("vmseq_vv") != std::string::npos) {
+				std::string fp = gGoldenDir + _f;
+				cases.push_back(new Cvmseq_vv(fp));
+			}
+		}
+	}
+	virtual ~Cvmseq_vvTest(void) {
+		for(auto & _case: cases) {
+			delete _case;
+		}
+	}
+};
+class Cvmseq_viTest
+	: public ::testing::Test {
+public:
+	std::vector<Cvmseq_vi*> cases;
+	Cvmseq_viTest(void) {
+
+		std::vector<std::string> golden_files;
+		std::vector<std::string> case_files;
+
+		read_directory(gGoldenDir.c_str(), golden_files);
+		for (auto& _f: golden_files) {
+			if(_f.find("vmseq_vi") != std::string::npos) {
+				std::string fp = gGoldenDir + _f;
+				cases.push_back(new Cvmseq_vi(fp));
+			}
+		}
+	}
+	virtual ~Cvmseq_viTest(void) {
+		for(auto & _case: cases) {
+			delete _case;
+		}
+	}
+};
+class Cvmslt_vvTest
+	: public ::testing::Test {
+public:
+	std::vector<Cvmslt_vv*> cases;
+	Cvmslt_vvTest(void) {
+
+		std::vector<std::string> golden_files;
+		std::vector<std::string> case_files;
+
+		read_directory(gGoldenDir.c_str(), golden_files);
+		for (auto& _f: golden_files) {
+			if(_f.find("vmslt_vv") != std::string::npos) {
+				std::string fp = gGoldenDir + _f;
+				cases.push_back(new Cvmslt_vv(fp));
+			}
+		}
+	}
+	virtual ~Cvmslt_vvTest(void) {
+		for(auto & _case: cases) {
+			delete _case;
+		}
+	}
+};
+class Cvmsleu_viTest
+	: public ::testing::Test {
+public:
+	std::vector<Cvmsleu_vi*> cases;
+	Cvmsleu_viTest(void) {
+
+		std::vector<std::string> golden_files;
+		std::vector<std::string> case_files;
+
+		read_directory(gGoldenDir.c_str(), golden_files);
+		for (auto& _f: golden_files) {
+			if(_f.find("vmsleu_vi") != std::string::npos) {
+				std::string fp = gGoldenDir + _f;
+				cases.push_back(new Cvmsleu_vi(fp));
+			}
+		}
+	}
+	virtual ~Cvmsleu_viTest(void) {
+		for(auto & _case: cases) {
+			delete _case;
+		}
+	}
+};
 //12.10 mul
 class Cvmul_vvTest
 	: public ::testing::Test {
@@ -1114,6 +1214,1019 @@ TEST_F(Cvstore_segment_strideTest, VariousTestCases) {
 	}
 }
 
+struct PageQueries {
+	uint64_t invalid_page{~0ull};
+	std::vector<uint64_t> pages;
+};
+
+static uint8_t page_valid(void* user, uint64_t addr) {
+	PageQueries* q = static_cast<PageQueries*>(user);
+	q->pages.push_back(addr);
+	return (addr != q->invalid_page);
+}
+
+struct HostMemory {
+	uint8_t* mem{};
+	uint8_t fail{};
+	PageQueries pq;
+	size_t calls{};
+	std::vector<sv_mem_range> ranges;
+};
+
+static uint8_t host_read(void* user, const sv_mem_range* ranges, uint32_t n) {
+	HostMemory* h = static_cast<HostMemory*>(user);
+	++h->calls;
+	for(uint32_t i = 0; i < n; ++i) {
+		h->ranges.push_back(ranges[i]);
+		memcpy(ranges[i].data, h->mem + ranges[i].addr, ranges[i].len);
+	}
+	return (h->fail);
+}
+
+static uint8_t host_write(void* user, const sv_mem_range* ranges, uint32_t n) {
+	HostMemory* h = static_cast<HostMemory*>(user);
+	++h->calls;
+	for(uint32_t i = 0; i < n; ++i) {
+		h->ranges.push_back(ranges[i]);
+		memcpy(h->mem + ranges[i].addr, ranges[i].data, ranges[i].len);
+	}
+	return (h->fail);
+}
+
+static uint8_t host_page_valid(void* user, uint64_t addr) {
+	return (page_valid(&static_cast<HostMemory*>(user)->pq, addr));
+}
+
+TEST(vload_ff_unitstride, EmptyAccessDoesNotTrap) {
+	uint8_t V[32*16];
+	uint8_t M[64];
+	for(size_t i = 0; i < sizeof(V); ++i) V[i] = 0x55;
+	for(size_t i = 0; i < sizeof(M); ++i) M[i] = i;
+	PageQueries q;
+	q.invalid_page = 0;
+	uint16_t vl = 0;
+	EXPECT_EQ(vload_ff_unitstride(V, M, page_valid, &q, 16, vtype_encode(8, 1, 1, 0, 0), 1, 8, 1, 0, 128, &vl, 0), 0);
+	EXPECT_EQ(vl, 0);
+	EXPECT_TRUE(q.pages.empty());
+	for(size_t i = 0; i < sizeof(V); ++i) EXPECT_EQ(V[i], 0x55);
+
+	HostMemory h;
+	h.mem = M;
+	h.pq.invalid_page = 0;
+	EXPECT_EQ(vload_ranges_ff_unitstride(V, host_read, host_page_valid, &h, 16, vtype_encode(8, 1, 1, 0, 0), 1, 8, 1, 0, 128, &vl, 0), 0);
+	EXPECT_EQ(vl, 0);
+	EXPECT_TRUE(h.pq.pages.empty());
+	EXPECT_EQ(h.calls, 0);
+}
+
+class LSUHostTest
+	: public ::testing::Test {
+public:
+	static const uint16_t VLEN = 128;
+	uint8_t V[32*VLEN/8];
+	uint8_t M[256];
+	HostMemory h;
+
+	LSUHostTest(void) {
+		for(size_t i = 0; i < sizeof(V); ++i) V[i] = 0x55;
+		for(size_t i = 0; i < sizeof(M); ++i) M[i] = i;
+		h.mem = M;
+	}
+
+	// Expects bytes [from, to) of the register field to hold M[mstart...], all others 0x55 (v0 excluded)
+	void expect_loaded(size_t from, size_t to, size_t mstart) {
+		for(size_t i = VLEN/8; i < sizeof(V); ++i) {
+			if(i >= from && i < to) {
+				EXPECT_EQ(V[i], M[mstart + i - from]) << "byte " << i;
+			} else {
+				EXPECT_EQ(V[i], 0x55) << "byte " << i;
+			}
+		}
+	}
+};
+
+TEST_F(LSUHostTest, RangesUnmaskedSingleRange) {
+	EXPECT_EQ(vload_ranges_unitstride(V, host_read, &h, vtype_encode(8, 2, 1, 0, 0), 1, 8, 2, 0, VLEN, 32, 4), 0);
+	EXPECT_EQ(h.calls, 1);
+	ASSERT_EQ(h.ranges.size(), 1);
+	EXPECT_EQ(h.ranges[0].addr, 4);
+	EXPECT_EQ(h.ranges[0].data, V + 2*VLEN/8);
+	EXPECT_EQ(h.ranges[0].len, 32);
+	expect_loaded(32, 64, 4);
+
+	// Zero gap stride is unit-stride, i.e. a single range as well
+	h.ranges.clear();
+	EXPECT_EQ(vstore_ranges_stride(V, host_write, &h, vtype_encode(16, 1, 1, 0, 0), 1, 16, 2, 0, VLEN, 8, 32, 0), 0);
+	ASSERT_EQ(h.ranges.size(), 1);
+	EXPECT_EQ(h.ranges[0].addr, 32);
+	EXPECT_EQ(h.ranges[0].len, 16);
+	for(size_t i = 0; i < 16; ++i) EXPECT_EQ(M[32 + i], V[2*VLEN/8 + i]);
+
+	// Gaps between elements: one range per element
+	h.ranges.clear();
+	EXPECT_EQ(vload_ranges_stride(V, host_read, &h, vtype_encode(16, 1, 1, 0, 0), 1, 16, 3, 0, VLEN, 4, 0, 2), 0);
+	ASSERT_EQ(h.ranges.size(), 4);
+	for(size_t i = 0; i < 4; ++i) {
+		EXPECT_EQ(h.ranges[i].addr, 4*i);
+		EXPECT_EQ(h.ranges[i].data, V + 3*VLEN/8 + 2*i);
+		EXPECT_EQ(h.ranges[i].len, 2);
+	}
+}
+
+TEST_F(LSUHostTest, RangesMaskedRunsMerged) {
+	// Elements 0, 3..5, 14..15 active
+	V[0] = 0x39;
+	V[1] = 0xc0;
+	EXPECT_EQ(vload_ranges_unitstride(V, host_read, &h, vtype_encode(8, 1, 1, 0, 0), 0, 8, 1, 0, VLEN, 16, 0), 0);
+	EXPECT_EQ(h.calls, 1);
+	const uint64_t addr[3] = {0, 3, 14}, len[3] = {1, 3, 2};
+	ASSERT_EQ(h.ranges.size(), 3);
+	for(size_t i = 0; i < 3; ++i) {
+		EXPECT_EQ(h.ranges[i].addr, addr[i]);
+		EXPECT_EQ(h.ranges[i].data, V + VLEN/8 + addr[i]);
+		EXPECT_EQ(h.ranges[i].len, len[i]);
+	}
+
+	// A run across a 64 bit mask word: elements 60..67 of a LMUL=8 group
+	memset(V, 0, VLEN/8);
+	V[7] = 0xf0;
+	V[8] = 0x0f;
+	h.ranges.clear();
+	EXPECT_EQ(vstore_ranges_unitstride(V, host_write, &h, vtype_encode(8, 8, 1, 0, 0), 0, 8, 8, 0, VLEN, 128, 0), 0);
+	ASSERT_EQ(h.ranges.size(), 1);
+	EXPECT_EQ(h.ranges[0].addr, 60);
+	EXPECT_EQ(h.ranges[0].data, V + 8*VLEN/8 + 60);
+	EXPECT_EQ(h.ranges[0].len, 8);
+}
+
+TEST_F(LSUHostTest, RangesNoActiveElement) {
+	V[0] = 0;
+	V[1] = 0;
+	EXPECT_EQ(vload_ranges_unitstride(V, host_read, &h, vtype_encode(8, 1, 1, 0, 0), 0, 8, 1, 0, VLEN, 16, 0), 0);
+	EXPECT_EQ(vstore_ranges_stride(V, host_write, &h, vtype_encode(8, 1, 1, 0, 0), 1, 8, 1, 4, VLEN, 4, 0, 1), 0);
+	EXPECT_EQ(h.calls, 0);
+}
+
+TEST_F(LSUHostTest, RangesAccessFault) {
+	h.fail = 1;
+	EXPECT_EQ(vload_ranges_unitstride(V, host_read, &h, vtype_encode(8, 1, 1, 0, 0), 1, 8, 1, 0, VLEN, 16, 0), 1);
+	EXPECT_EQ(vstore_ranges_stride(V, host_write, &h, vtype_encode(8, 1, 1, 0, 0), 1, 8, 1, 0, VLEN, 16, 0, 1), 1);
+	EXPECT_EQ(h.calls, 2);
+}
+
+TEST_F(LSUHostTest, RangesMisalignedGroup) {
+	// LMUL=2 group at v1: all functions raise an exception, the ranges functions without a call
+	EXPECT_EQ(vload_ranges_unitstride(V, host_read, &h, vtype_encode(8, 2, 1, 0, 0), 1, 8, 1, 0, VLEN, 32, 0), 1);
+	EXPECT_EQ(vstore_ranges_unitstride(V, host_write, &h, vtype_encode(8, 2, 1, 0, 0), 1, 8, 1, 0, VLEN, 32, 0), 1);
+	EXPECT_EQ(h.calls, 0);
+	EXPECT_EQ(vload_encoded_unitstride(V, M, vtype_encode(8, 2, 1, 0, 0), 1, 8, 1, 0, VLEN, 32, 0), 1);
+	EXPECT_EQ(vstore_encoded_unitstride(V, M, vtype_encode(8, 2, 1, 0, 0), 1, 8, 1, 0, VLEN, 32, 0), 1);
+	expect_loaded(0, 0, 0);
+	for(size_t i = 0; i < sizeof(M); ++i) EXPECT_EQ(M[i], i);
+}
+
+TEST_F(LSUHostTest, IndexedNarrowIndex) {
+	// SEW=32 data, EEW=8 indices (index EMUL 1/4)
+	const uint8_t idx[4] = {12, 0, 40, 4};
+	for(int ordered = 0; ordered < 2; ++ordered) {
+		for(size_t i = VLEN/8; i < sizeof(V); ++i) V[i] = 0x55;
+		memcpy(V + 2*VLEN/8, idx, sizeof(idx));
+		auto f = ordered ? vload_indexed_ordered : vload_indexed_unordered;
+		EXPECT_EQ(f(V, M, vtype_encode(32, 1, 1, 0, 0), 1, 8, 1, 2, 0, VLEN, 4, 0), 0);
+		for(size_t i = 0; i < 4; ++i) {
+			for(size_t b = 0; b < 4; ++b) {
+				EXPECT_EQ(V[VLEN/8 + 4*i + b], M[idx[i] + b]) << "element " << i;
+			}
+		}
+	}
+}
+
+TEST_F(LSUHostTest, IndexedWideIndex) {
+	// SEW=8 data, EEW=32 indices (index EMUL 4, v4..v7)
+	uint32_t idx[16];
+	for(size_t i = 0; i < 16; ++i) {
+		idx[i] = (i*7) % 64;
+	}
+	memcpy(V + 4*VLEN/8, idx, sizeof(idx));
+	EXPECT_EQ(vload_indexed_ordered(V, M, vtype_encode(8, 1, 1, 0, 0), 1, 32, 1, 4, 0, VLEN, 16, 0), 0);
+	for(size_t i = 0; i < 16; ++i) {
+		EXPECT_EQ(V[VLEN/8 + i], M[idx[i]]) << "element " << i;
+	}
+
+	uint8_t S[32];
+	for(size_t i = 0; i < 16; ++i) {
+		V[VLEN/8 + i] = 0xa0 + i;
+	}
+	memset(M, 0, sizeof(M));
+	EXPECT_EQ(vstore_indexed_unordered(V, M, vtype_encode(8, 1, 1, 0, 0), 1, 32, 1, 4, 0, VLEN, 16, 0), 0);
+	for(size_t i = 0; i < 16; ++i) {
+		EXPECT_EQ(M[idx[i]], 0xa0 + i) << "element " << i;
+	}
+
+	// Index group misaligned (v2 with index EMUL 4): exception, nothing accessed
+	memcpy(S, V + VLEN/8, sizeof(S));
+	EXPECT_EQ(vload_indexed_ordered(V, M, vtype_encode(8, 1, 1, 0, 0), 1, 32, 1, 2, 0, VLEN, 16, 0), 1);
+	EXPECT_EQ(memcmp(S, V + VLEN/8, sizeof(S)), 0);
+	EXPECT_EQ(vload_ranges_indexed_unordered(V, host_read, &h, vtype_encode(8, 1, 1, 0, 0), 1, 32, 1, 2, 0, VLEN, 16, 0), 1);
+	EXPECT_EQ(h.calls, 0);
+}
+
+TEST_F(LSUHostTest, IndexedMisalignedData) {
+	// LMUL=2 data group at v1
+	V[2*VLEN/8] = 3;
+	EXPECT_EQ(vload_indexed_ordered(V, M, vtype_encode(8, 2, 1, 0, 0), 1, 8, 1, 2, 0, VLEN, 1, 0), 1);
+	EXPECT_EQ(vstore_indexed_unordered(V, M, vtype_encode(8, 2, 1, 0, 0), 1, 8, 1, 2, 0, VLEN, 1, 0), 1);
+	EXPECT_EQ(vstore_ranges_indexed_ordered(V, host_write, &h, vtype_encode(8, 2, 1, 0, 0), 1, 8, 1, 2, 0, VLEN, 1, 0), 1);
+	EXPECT_EQ(h.calls, 0);
+	for(size_t i = 0; i < sizeof(M); ++i) EXPECT_EQ(M[i], i);
+	V[2*VLEN/8] = 0x55;
+	expect_loaded(0, 0, 0);
+}
+
+TEST_F(LSUHostTest, IndexedInvalidIndexWidth) {
+	// SEW=64 data at v1, zero indices at v2: index EEW other than 8, 16, 32, 64 raises an exception
+	memset(V + 2*VLEN/8, 0, 2*VLEN/8);
+	for(const uint16_t eew : {128, 256, 24}) {
+		EXPECT_EQ(vload_indexed_ordered(V, M, vtype_encode(64, 1, 1, 0, 0), 1, eew, 1, 2, 0, VLEN, 2, 0), 1) << "EEW " << eew;
+		EXPECT_EQ(vload_indexed_unordered(V, M, vtype_encode(64, 1, 1, 0, 0), 1, eew, 1, 2, 0, VLEN, 2, 0), 1) << "EEW " << eew;
+		EXPECT_EQ(vstore_indexed_ordered(V, M, vtype_encode(64, 1, 1, 0, 0), 1, eew, 1, 2, 0, VLEN, 2, 0), 1) << "EEW " << eew;
+		EXPECT_EQ(vstore_indexed_unordered(V, M, vtype_encode(64, 1, 1, 0, 0), 1, eew, 1, 2, 0, VLEN, 2, 0), 1) << "EEW " << eew;
+		EXPECT_EQ(vload_ranges_indexed_unordered(V, host_read, &h, vtype_encode(64, 1, 1, 0, 0), 1, eew, 1, 2, 0, VLEN, 2, 0), 1) << "EEW " << eew;
+		EXPECT_EQ(vstore_ranges_indexed_ordered(V, host_write, &h, vtype_encode(64, 1, 1, 0, 0), 1, eew, 1, 2, 0, VLEN, 2, 0), 1) << "EEW " << eew;
+	}
+	EXPECT_EQ(h.calls, 0);
+	for(size_t i = 0; i < sizeof(M); ++i) EXPECT_EQ(M[i], i);
+	memset(V + 2*VLEN/8, 0x55, 2*VLEN/8);
+	expect_loaded(0, 0, 0);
+
+	// EEW=64 is valid
+	memset(V + 2*VLEN/8, 0, VLEN/8);
+	EXPECT_EQ(vload_indexed_ordered(V, M, vtype_encode(64, 1, 1, 0, 0), 1, 64, 1, 2, 0, VLEN, 2, 0), 0);
+	for(size_t i = 0; i < 16; ++i) EXPECT_EQ(V[VLEN/8 + i], M[i % 8]);
+}
+
+TEST_F(LSUHostTest, IndexedVstartAndMask) {
+	// Elements 0, 1 below vstart, element 3 masked off
+	V[0] = 0xf7;
+	for(size_t i = 0; i < 8; ++i) V[2*VLEN/8 + i] = 8*i;
+	EXPECT_EQ(vload_indexed_unordered(V, M, vtype_encode(8, 1, 1, 0, 0), 0, 8, 1, 2, 2, VLEN, 8, 0), 0);
+	for(size_t i = 0; i < 8; ++i) {
+		EXPECT_EQ(V[VLEN/8 + i], ((i < 2) || (i == 3)) ? 0x55 : 8*i) << "element " << i;
+	}
+}
+
+TEST_F(LSUHostTest, IndexedStoreDuplicateIndices) {
+	// Elements 0..2 store to M[5], the last one wins
+	const uint8_t idx[4] = {5, 5, 5, 9};
+	memcpy(V + 2*VLEN/8, idx, sizeof(idx));
+	for(size_t i = 0; i < 4; ++i) V[VLEN/8 + i] = 0xa0 + i;
+	EXPECT_EQ(vstore_indexed_ordered(V, M, vtype_encode(8, 1, 1, 0, 0), 1, 8, 1, 2, 0, VLEN, 4, 0), 0);
+	EXPECT_EQ(M[5], 0xa2);
+	EXPECT_EQ(M[9], 0xa3);
+
+	for(int ordered = 0; ordered < 2; ++ordered) {
+		for(size_t i = 0; i < sizeof(M); ++i) M[i] = i;
+		h.ranges.clear();
+		auto f = ordered ? vstore_ranges_indexed_ordered : vstore_ranges_indexed_unordered;
+		EXPECT_EQ(f(V, host_write, &h, vtype_encode(8, 1, 1, 0, 0), 1, 8, 1, 2, 0, VLEN, 4, 0), 0);
+		ASSERT_EQ(h.ranges.size(), 4);
+		for(size_t i = 0; i < 4; ++i) {
+			EXPECT_EQ(h.ranges[i].addr, idx[i]);
+			EXPECT_EQ(h.ranges[i].data, V + VLEN/8 + i);
+		}
+		EXPECT_EQ(M[5], 0xa2);
+		EXPECT_EQ(M[9], 0xa3);
+	}
+}
+
+TEST_F(LSUHostTest, IndexedRangesSortedAndMerged) {
+	// Element 0 at M+3, elements 1..3 at M+0..2
+	const uint8_t idx[4] = {3, 0, 1, 2};
+	memcpy(V + 2*VLEN/8, idx, sizeof(idx));
+	EXPECT_EQ(vload_ranges_indexed_unordered(V, host_read, &h, vtype_encode(8, 1, 1, 0, 0), 1, 8, 1, 2, 0, VLEN, 4, 0), 0);
+	EXPECT_EQ(h.calls, 1);
+	ASSERT_EQ(h.ranges.size(), 2);
+	EXPECT_EQ(h.ranges[0].addr, 0);
+	EXPECT_EQ(h.ranges[0].data, V + VLEN/8 + 1);
+	EXPECT_EQ(h.ranges[0].len, 3);
+	EXPECT_EQ(h.ranges[1].addr, 3);
+	EXPECT_EQ(h.ranges[1].data, V + VLEN/8);
+	EXPECT_EQ(h.ranges[1].len, 1);
+	for(size_t i = 0; i < 4; ++i) EXPECT_EQ(V[VLEN/8 + i], idx[i]);
+
+	// Ordered: element order, elements 1..3 merged
+	h.ranges.clear();
+	EXPECT_EQ(vload_ranges_indexed_ordered(V, host_read, &h, vtype_encode(8, 1, 1, 0, 0), 1, 8, 1, 2, 0, VLEN, 4, 0), 0);
+	ASSERT_EQ(h.ranges.size(), 2);
+	EXPECT_EQ(h.ranges[0].addr, 3);
+	EXPECT_EQ(h.ranges[0].len, 1);
+	EXPECT_EQ(h.ranges[1].addr, 0);
+	EXPECT_EQ(h.ranges[1].len, 3);
+}
+
+TEST_F(LSUHostTest, FaultOnlyFirstElementZeroTraps) {
+	uint16_t vl = 16;
+	h.pq.invalid_page = 16;
+	EXPECT_EQ(vload_ff_unitstride(V, M, page_valid, &h.pq, 16, vtype_encode(8, 1, 1, 0, 0), 1, 8, 1, 0, VLEN, &vl, 16), 1);
+	EXPECT_EQ(vl, 16);
+	EXPECT_EQ(h.pq.pages, std::vector<uint64_t>({16}));
+	expect_loaded(0, 0, 0);
+}
+
+TEST_F(LSUHostTest, FaultOnlyFirstTrimsVl) {
+	uint16_t vl = 16;
+	h.pq.invalid_page = 16;
+	EXPECT_EQ(vload_ff_unitstride(V, M, page_valid, &h.pq, 16, vtype_encode(8, 1, 1, 0, 0), 1, 8, 1, 0, VLEN, &vl, 8), 0);
+	EXPECT_EQ(vl, 8);
+	EXPECT_EQ(h.pq.pages, std::vector<uint64_t>({0, 16}));
+	expect_loaded(16, 24, 8);
+}
+
+TEST_F(LSUHostTest, FaultOnlyFirstStraddlingElement) {
+	// Element 1 (bytes 14..17) spans pages 0 and 16
+	uint16_t vl = 4;
+	h.pq.invalid_page = 16;
+	EXPECT_EQ(vload_ff_unitstride(V, M, page_valid, &h.pq, 16, vtype_encode(32, 1, 1, 0, 0), 1, 32, 1, 0, VLEN, &vl, 10), 0);
+	EXPECT_EQ(vl, 1);
+	EXPECT_EQ(h.pq.pages, std::vector<uint64_t>({0, 16}));
+	expect_loaded(16, 20, 10);
+}
+
+TEST_F(LSUHostTest, FaultOnlyFirstSkipsInactiveElements) {
+	// Elements 0..7 active, elements 8..15 (page 16) masked off
+	V[0] = 0xff;
+	V[1] = 0x00;
+	uint16_t vl = 16;
+	h.pq.invalid_page = 16;
+	EXPECT_EQ(vload_ff_unitstride(V, M, page_valid, &h.pq, 16, vtype_encode(8, 1, 1, 0, 0), 0, 8, 1, 0, VLEN, &vl, 8), 0);
+	EXPECT_EQ(vl, 16);
+	EXPECT_EQ(h.pq.pages, std::vector<uint64_t>({0}));
+	expect_loaded(16, 24, 8);
+
+	// Element 15 active again: it faults, the inactive elements 8..14 are left undisturbed
+	V[1] = 0x80;
+	for(size_t i = 16; i < 32; ++i) V[i] = 0x55;
+	h.pq.pages.clear();
+	EXPECT_EQ(vload_ff_unitstride(V, M, page_valid, &h.pq, 16, vtype_encode(8, 1, 1, 0, 0), 0, 8, 1, 0, VLEN, &vl, 8), 0);
+	EXPECT_EQ(vl, 15);
+	EXPECT_EQ(h.pq.pages, std::vector<uint64_t>({0, 16}));
+	expect_loaded(16, 24, 8);
+}
+
+TEST_F(LSUHostTest, FaultOnlyFirstProbesEachPageOnce) {
+	uint16_t vl = 64;
+	EXPECT_EQ(vload_ff_unitstride(V, M, page_valid, &h.pq, 16, vtype_encode(8, 4, 1, 0, 0), 1, 8, 4, 0, VLEN, &vl, 0), 0);
+	EXPECT_EQ(vl, 64);
+	EXPECT_EQ(h.pq.pages, std::vector<uint64_t>({0, 16, 32, 48}));
+	expect_loaded(64, 128, 0);
+
+	// Page size not a power of two, unaligned start
+	for(size_t i = 64; i < 128; ++i) V[i] = 0x55;
+	h.pq.pages.clear();
+	vl = 40;
+	EXPECT_EQ(vload_ff_unitstride(V, M, page_valid, &h.pq, 12, vtype_encode(8, 4, 1, 0, 0), 1, 8, 4, 0, VLEN, &vl, 5), 0);
+	EXPECT_EQ(vl, 40);
+	EXPECT_EQ(h.pq.pages, std::vector<uint64_t>({0, 12, 24, 36}));
+	expect_loaded(64, 104, 5);
+}
+
+TEST_F(LSUHostTest, FaultOnlyFirstRanges) {
+	uint16_t vl = 16;
+	h.pq.invalid_page = 16;
+	EXPECT_EQ(vload_ranges_ff_unitstride(V, host_read, host_page_valid, &h, 16, vtype_encode(8, 1, 1, 0, 0), 1, 8, 1, 0, VLEN, &vl, 8), 0);
+	EXPECT_EQ(vl, 8);
+	EXPECT_EQ(h.pq.pages, std::vector<uint64_t>({0, 16}));
+	ASSERT_EQ(h.calls, 1);
+	ASSERT_EQ(h.ranges.size(), 1);
+	EXPECT_EQ(h.ranges[0].addr, 8);
+	EXPECT_EQ(h.ranges[0].data, V + 16);
+	EXPECT_EQ(h.ranges[0].len, 8);
+	expect_loaded(16, 24, 8);
+
+	// Element 0 faults: no memory access
+	vl = 16;
+	h.calls = 0;
+	EXPECT_EQ(vload_ranges_ff_unitstride(V, host_read, host_page_valid, &h, 16, vtype_encode(8, 1, 1, 0, 0), 1, 8, 1, 0, VLEN, &vl, 16), 1);
+	EXPECT_EQ(vl, 16);
+	EXPECT_EQ(h.calls, 0);
+}
+
+TEST(sv_context, RebuildsViewsOnVtypeChange) {
+	const uint16_t VLEN = 256;
+	std::mt19937 rng(16);
+	std::vector<uint8_t> V(32*VLEN/8), W;
+	uint8_t R[32*8];
+	for(auto& b: V) b = rng();
+	for(auto& b: R) b = rng();
+	W = V;
+
+	sv_context* ctx = sv_context_create(V.data(), R, VLEN, 64);
+	ASSERT_NE(ctx, nullptr);
+	const struct { uint16_t sew; uint8_t z_lmul; uint8_t n_lmul; } config[] = {{8, 1, 1}, {32, 2, 1}, {8, 1, 1}, {64, 8, 1}, {16, 1, 2}, {32, 2, 1}, {64, 1, 1}};
+	for(auto& c: config) {
+		const uint16_t vt = vtype_encode(c.sew, c.z_lmul, c.n_lmul, 0, 0);
+		const uint16_t vlmax = VLEN*c.z_lmul/c.n_lmul/c.sew;
+		SCOPED_TRACE("SEW=" + std::to_string(c.sew) + " LMUL=" + std::to_string(c.z_lmul) + "/" + std::to_string(c.n_lmul));
+		EXPECT_EQ(sv_vadd_vv(ctx, vt, 1, 8, 16, 24, 0, vlmax), vadd_vv(W.data(), vt, 1, 8, 16, 24, 0, VLEN, vlmax));
+		EXPECT_EQ(sv_vsll_vx(ctx, vt, 0, 16, 8, 3, 1, vlmax - 1), vsll_vx(W.data(), R, vt, 0, 16, 8, 3, 1, VLEN, vlmax - 1, 64));
+		EXPECT_EQ(sv_vmslt_vv(ctx, vt, 1, 1, 8, 16, 0, vlmax), vmslt_vv(W.data(), vt, 1, 1, 8, 16, 0, VLEN, vlmax));
+		EXPECT_EQ(V, W);
+	}
+	sv_context_destroy(ctx);
+}
+
+TEST(sv_context, ReadsXlen32Scalars) {
+	const uint16_t VLEN = 128;
+	uint8_t V[32*VLEN/8] = {};
+	uint32_t R[32] = {};
+	R[3] = 0xFFFFFFFF;
+	R[4] = 5;
+	uint64_t vs2[2] = {100, 0x123456789ull};
+	memcpy(V + 2*VLEN/8, vs2, sizeof(vs2));
+
+	sv_context* ctx = sv_context_create(V, R, VLEN, 32);
+	ASSERT_NE(ctx, nullptr);
+	uint64_t vd[2];
+	// x3 = -1 is sign extended to SEW=64
+	EXPECT_EQ(sv_vadd_vx(ctx, vtype_encode(64, 1, 1, 0, 0), 1, 1, 2, 3, 0, 2), 0);
+	memcpy(vd, V + VLEN/8, sizeof(vd));
+	EXPECT_EQ(vd[0], 99);
+	EXPECT_EQ(vd[1], 0x123456788ull);
+	EXPECT_EQ(sv_vadd_vx(ctx, vtype_encode(64, 1, 1, 0, 0), 1, 1, 2, 4, 0, 2), 0);
+	memcpy(vd, V + VLEN/8, sizeof(vd));
+	EXPECT_EQ(vd[0], 105);
+	EXPECT_EQ(vd[1], 0x12345678Eull);
+	// Truncated to SEW=8
+	EXPECT_EQ(sv_vadd_vx(ctx, vtype_encode(8, 1, 1, 0, 0), 1, 1, 2, 3, 0, 16), 0);
+	for(size_t i = 0; i < 16; ++i) {
+		EXPECT_EQ(V[VLEN/8 + i], uint8_t(V[2*VLEN/8 + i] - 1)) << "element " << i;
+	}
+	sv_context_destroy(ctx);
+}
+
+// Context free function of an instruction descriptor
+static uint8_t sv_legacy(void* V, void* R, const sv_insn& i, uint16_t VLEN, uint8_t XLEN) {
+	const uint16_t vt = i.vtype->vtype;
+#define SV_LEGACY_VV(OPCODE, F) case OPCODE: return (F(V, vt, i.vm, i.vd, i.src1, i.vs2, i.vstart, VLEN, i.vl));
+#define SV_LEGACY_VI(OPCODE, F) case OPCODE: return (F(V, vt, i.vm, i.vd, i.vs2, i.src1, i.vstart, VLEN, i.vl));
+#define SV_LEGACY_VX(OPCODE, F) case OPCODE: return (F(V, R, vt, i.vm, i.vd, i.vs2, i.src1, i.vstart, VLEN, i.vl, XLEN));
+	switch(i.opcode) {
+	SV_LEGACY_VV(SV_VADD_VV, vadd_vv)
+	SV_LEGACY_VI(SV_VADD_VI, vadd_vi)
+	SV_LEGACY_VX(SV_VADD_VX, vadd_vx)
+	SV_LEGACY_VV(SV_VSUB_VV, vsub_vv)
+	SV_LEGACY_VX(SV_VSUB_VX, vsub_vx)
+	SV_LEGACY_VV(SV_VAND_VV, vand_vv)
+	SV_LEGACY_VI(SV_VAND_VI, vand_vi)
+	SV_LEGACY_VX(SV_VAND_VX, vand_vx)
+	SV_LEGACY_VV(SV_VOR_VV, vor_vv)
+	SV_LEGACY_VI(SV_VOR_VI, vor_vi)
+	SV_LEGACY_VX(SV_VOR_VX, vor_vx)
+	SV_LEGACY_VV(SV_VXOR_VV, vxor_vv)
+	SV_LEGACY_VI(SV_VXOR_VI, vxor_vi)
+	SV_LEGACY_VX(SV_VXOR_VX, vxor_vx)
+	SV_LEGACY_VV(SV_VSLL_VV, vsll_vv)
+	SV_LEGACY_VI(SV_VSLL_VI, vsll_vi)
+	SV_LEGACY_VX(SV_VSLL_VX, vsll_vx)
+	SV_LEGACY_VV(SV_VSRL_VV, vsrl_vv)
+	SV_LEGACY_VI(SV_VSRL_VI, vsrl_vi)
+	SV_LEGACY_VX(SV_VSRL_VX, vsrl_vx)
+	SV_LEGACY_VV(SV_VSRA_VV, vsra_vv)
+	SV_LEGACY_VI(SV_VSRA_VI, vsra_vi)
+	SV_LEGACY_VX(SV_VSRA_VX, vsra_vx)
+	SV_LEGACY_VV(SV_VMSEQ_VV, vmseq_vv)
+	SV_LEGACY_VI(SV_VMSEQ_VI, vmseq_vi)
+	SV_LEGACY_VX(SV_VMSEQ_VX, vmseq_vx)
+	SV_LEGACY_VV(SV_VMSNE_VV, vmsne_vv)
+	SV_LEGACY_VI(SV_VMSNE_VI, vmsne_vi)
+	SV_LEGACY_VX(SV_VMSNE_VX, vmsne_vx)
+	SV_LEGACY_VV(SV_VMSLTU_VV, vmsltu_vv)
+	SV_LEGACY_VX(SV_VMSLTU_VX, vmsltu_vx)
+	SV_LEGACY_VV(SV_VMSLT_VV, vmslt_vv)
+	SV_LEGACY_VX(SV_VMSLT_VX, vmslt_vx)
+	SV_LEGACY_VV(SV_VMSLEU_VV, vmsleu_vv)
+	SV_LEGACY_VI(SV_VMSLEU_VI, vmsleu_vi)
+	SV_LEGACY_VX(SV_VMSLEU_VX, vmsleu_vx)
+	SV_LEGACY_VV(SV_VMSLE_VV, vmsle_vv)
+	SV_LEGACY_VI(SV_VMSLE_VI, vmsle_vi)
+	SV_LEGACY_VX(SV_VMSLE_VX, vmsle_vx)
+	SV_LEGACY_VV(SV_VMSGTU_VV, vmsgtu_vv)
+	SV_LEGACY_VX(SV_VMSGTU_VX, vmsgtu_vx)
+	SV_LEGACY_VV(SV_VMSGT_VV, vmsgt_vv)
+	SV_LEGACY_VX(SV_VMSGT_VX, vmsgt_vx)
+	case SV_VMV_VV: return (vmv_vv(V, vt, i.vd, i.src1, i.vstart, VLEN, i.vl));
+	case SV_VMV_VI: return (vmv_vi(V, vt, i.vd, i.src1, i.vstart, VLEN, i.vl));
+	case SV_VMV_VX: return (vmv_vx(V, R, vt, i.vd, i.src1, i.vstart, VLEN, i.vl, XLEN));
+	SV_LEGACY_VV(SV_VMUL_VV, vmul_vv)
+	SV_LEGACY_VX(SV_VMUL_VX, vmul_vx)
+	SV_LEGACY_VV(SV_VMULH_VV, vmulh_vv)
+	SV_LEGACY_VX(SV_VMULH_VX, vmulh_vx)
+	SV_LEGACY_VV(SV_VMULHU_VV, vmulhu_vv)
+	SV_LEGACY_VX(SV_VMULHU_VX, vmulhu_vx)
+	SV_LEGACY_VV(SV_VMULHSU_VV, vmulhsu_vv)
+	SV_LEGACY_VX(SV_VMULHSU_VX, vmulhsu_vx)
+	default: break;
+	}
+#undef SV_LEGACY_VV
+#undef SV_LEGACY_VI
+#undef SV_LEGACY_VX
+	return (1);
+}
+
+static std::string sv_insn_str(const sv_insn& i) {
+	std::stringstream ss;
+	ss << "opcode " << i.opcode << " SEW=" << i.vtype->sew << " LMUL=" << int(i.vtype->z_lmul) << "/" << int(i.vtype->n_lmul)
+		<< " ta=" << int(i.vtype->ta) << " ma=" << int(i.vtype->ma) << " vm=" << int(i.vm) << " vd=" << int(i.vd) << " vs2=" << int(i.vs2)
+		<< " src1=" << int(i.src1) << " vstart=" << i.vstart << " vl=" << i.vl;
+	return (ss.str());
+}
+
+// Executes insn through sv_execute() on the context's field and through the context free function on a copy, the fields must match afterwards
+class SVExecuteTest
+	: public ::testing::TestWithParam<int> {
+public:
+	static const uint16_t VLEN = 256;
+	std::mt19937 rng{19};
+	std::vector<uint8_t> V, W;
+	uint8_t R[32*8];
+	sv_context* ctx{}; //!< XLEN=64
+	sv_context* ctx32{}; //!< XLEN=32 on the same fields
+
+	SVExecuteTest(void)
+	: V(32*VLEN/8), W(32*VLEN/8) {
+		for(auto& b: V) b = rng();
+		for(auto& b: R) b = rng();
+		W = V;
+		ctx = sv_context_create(V.data(), R, VLEN, 64);
+		ctx32 = sv_context_create(V.data(), R, VLEN, 32);
+	}
+	virtual ~SVExecuteTest(void) {
+		sv_context_destroy(ctx);
+		sv_context_destroy(ctx32);
+	}
+
+	// Random operands with vd and vs2 groups aligned, vd not overlapping v0 if masked, vl <= VLMAX
+	sv_insn random_insn(uint16_t opcode) {
+		static const uint8_t lmul[][2] = {{1, 2}, {1, 1}, {2, 1}, {4, 1}, {8, 1}};
+		const uint16_t sew = 8 << (rng() % 4);
+		const uint8_t* l = lmul[rng() % 5];
+		const uint8_t group = l[0];
+		const uint16_t vlmax = VLEN*l[0]/l[1]/sew;
+		sv_insn i{};
+		i.vtype = vtype_config(vtype_encode(sew, l[0], l[1], rng() % 2, rng() % 2));
+		i.opcode = opcode;
+		i.vm = rng() % 2;
+		i.vd = group*(i.vm ? rng() % (32/group) : 1 + rng() % (32/group - 1));
+		i.vs2 = group*(rng() % (32/group));
+		// Mostly aligned, as vs1 of the .vv forms
+		i.src1 = (rng() % 4) ? group*(rng() % (32/group)) : rng() % 32;
+		i.vl = rng() % (vlmax + 1);
+		i.vstart = (rng() % 4) ? 0 : rng() % (i.vl + 1);
+		return (i);
+	}
+
+	void expect_legacy(const sv_insn& i, uint8_t xlen = 64) {
+		SCOPED_TRACE(sv_insn_str(i) + " XLEN=" + std::to_string(xlen));
+		EXPECT_EQ(sv_execute((xlen == 32) ? ctx32 : ctx, &i), sv_legacy(W.data(), R, i, VLEN, xlen));
+		EXPECT_EQ(V, W);
+	}
+};
+
+TEST_P(SVExecuteTest, MatchesLegacy) {
+	for(int n = 0; n < 200 && !HasFailure(); ++n) {
+		expect_legacy(random_insn(GetParam()), (n % 2) ? 32 : 64);
+	}
+}
+
+INSTANTIATE_TEST_SUITE_P(AllOpcodes, SVExecuteTest, ::testing::Range(0, int(SV_OPCODE_COUNT)));
+
+TEST_F(SVExecuteTest, PlanCacheCollisions) {
+	// 540 (opcode, vtype, vm) keys on a 64 entry cache, twice, the second time in reverse order
+	const uint16_t vtypes[] = {vtype_encode(8, 1, 1, 0, 0), vtype_encode(16, 8, 1, 1, 0), vtype_encode(32, 2, 1, 0, 1), vtype_encode(64, 1, 2, 1, 1), vtype_encode(64, 4, 1, 0, 0)};
+	std::vector<sv_insn> insns;
+	for(uint16_t opcode = 0; opcode < SV_OPCODE_COUNT; ++opcode) {
+		for(uint16_t vt: vtypes) {
+			for(uint8_t vm = 0; vm < 2; ++vm) {
+				const sv_vtype* c = vtype_config(vt);
+				const uint16_t vlmax = VLEN*c->z_lmul/c->n_lmul/c->sew;
+				insns.push_back(sv_insn{c, opcode, 1, vlmax, vm, 8, 16, 24});
+			}
+		}
+	}
+	for(int round = 0; round < 2 && !HasFailure(); ++round) {
+		for(auto& i: insns) {
+			expect_legacy(i);
+			if(HasFailure()) break;
+		}
+		std::reverse(insns.begin(), insns.end());
+	}
+}
+
+TEST_F(SVExecuteTest, PlanCacheVtypeChange) {
+	// Same instruction, alternating vtype between calls
+	const uint16_t vtypes[] = {vtype_encode(8, 1, 1, 0, 0), vtype_encode(32, 2, 1, 0, 0), vtype_encode(64, 8, 1, 1, 0), vtype_encode(16, 1, 2, 0, 1)};
+	for(int n = 0; n < 12 && !HasFailure(); ++n) {
+		for(uint16_t opcode: {SV_VADD_VV, SV_VSRA_VX, SV_VMSLEU_VI}) {
+			const sv_vtype* c = vtype_config(vtypes[n % 4]);
+			const uint16_t vlmax = VLEN*c->z_lmul/c->n_lmul/c->sew;
+			expect_legacy(sv_insn{c, opcode, 0, vlmax, 1, 8, 16, 24}, (n % 3) ? 64 : 32);
+		}
+	}
+}
+
+TEST_F(SVExecuteTest, PlanCacheMaskedUnmasked) {
+	// Dense and sparse masks, alternating with the unmasked plan of the same opcode and vtype
+	const sv_vtype* c = vtype_config(vtype_encode(16, 2, 1, 0, 0));
+	for(int n = 0; n < 8 && !HasFailure(); ++n) {
+		for(size_t k = 0; k < VLEN/8; ++k) {
+			V[k] = (n % 4 < 2) ? uint8_t(rng() | rng()) : uint8_t(rng() & rng() & rng());
+			W[k] = V[k];
+		}
+		for(uint16_t opcode: {SV_VADD_VX, SV_VAND_VV, SV_VSLL_VI, SV_VMSLTU_VV, SV_VMSNE_VX}) {
+			expect_legacy(sv_insn{c, opcode, uint16_t(n), 32, uint8_t(n % 2), 2, 4, 6});
+		}
+	}
+}
+
+TEST_F(SVExecuteTest, PlanCacheVlAboveVlmax) {
+	const sv_vtype* c = vtype_config(vtype_encode(32, 1, 1, 0, 0));
+	for(uint16_t opcode: {SV_VADD_VV, SV_VXOR_VI, SV_VMSEQ_VX}) {
+		expect_legacy(sv_insn{c, opcode, 0, 8, 1, 8, 16, 24});
+		expect_legacy(sv_insn{c, opcode, 0, 13, 1, 8, 16, 24});
+		expect_legacy(sv_insn{c, opcode, 2, 13, 0, 8, 16, 24});
+		expect_legacy(sv_insn{c, opcode, 0, 8, 1, 8, 16, 24});
+	}
+}
+
+TEST_F(SVExecuteTest, PlanCacheMisalignedGroups) {
+	// Plans compiled by aligned instructions, then hit with misaligned vd, vs2 or vs1
+	const sv_vtype* c = vtype_config(vtype_encode(8, 4, 1, 0, 0));
+	for(uint16_t opcode: {SV_VSUB_VV, SV_VMUL_VX, SV_VMSGT_VV, SV_VMULH_VV}) {
+		for(uint8_t vm = 0; vm < 2; ++vm) {
+			expect_legacy(sv_insn{c, opcode, 0, 128, vm, 8, 16, 24});
+			expect_legacy(sv_insn{c, opcode, 0, 128, vm, 10, 16, 24});
+			expect_legacy(sv_insn{c, opcode, 0, 128, vm, 8, 17, 24});
+			expect_legacy(sv_insn{c, opcode, 0, 128, vm, 8, 16, 27});
+			expect_legacy(sv_insn{c, opcode, 0, 128, vm, 8, 16, 24});
+		}
+	}
+}
+
+TEST(sv_execute, RejectsUnknownOpcodeAndVill) {
+	const uint16_t VLEN = 128;
+	uint8_t V[32*VLEN/8];
+	uint8_t R[32*8] = {};
+	for(size_t i = 0; i < sizeof(V); ++i) V[i] = i;
+	sv_context* ctx = sv_context_create(V, R, VLEN, 64);
+	ASSERT_NE(ctx, nullptr);
+
+	sv_insn i = { vtype_config(vtype_encode(8, 1, 1, 0, 0)), SV_OPCODE_COUNT, 0, 16, 1, 1, 2, 3 };
+	EXPECT_EQ(sv_execute(ctx, &i), 1);
+	i.opcode = 0xFFFF;
+	EXPECT_EQ(sv_execute(ctx, &i), 1);
+
+	// Reserved LMUL encodings
+	i.opcode = SV_VADD_VV;
+	size_t n_vill = 0;
+	for(uint16_t vt = 0; vt < 256; ++vt) {
+		i.vtype = vtype_config(vt);
+		if(i.vtype->vill) {
+			EXPECT_EQ(sv_execute(ctx, &i), 1) << "vtype " << vt;
+			++n_vill;
+		}
+	}
+	EXPECT_GT(n_vill, 0);
+
+	for(size_t k = 0; k < sizeof(V); ++k) EXPECT_EQ(V[k], uint8_t(k));
+	sv_context_destroy(ctx);
+}
+
+TEST(varith, MisalignedGroupLeavesRegisters) {
+	// LMUL=2: odd vd, vs1 or vs2 raise an exception, golden cases only check EXCEPTION:1
+	const uint16_t VLEN = 128;
+	uint8_t V[32*VLEN/8];
+	uint8_t R[32*8] = {};
+	for(size_t i = 0; i < sizeof(V); ++i) V[i] = i;
+	const uint16_t vt = vtype_encode(8, 2, 1, 0, 0);
+
+	EXPECT_EQ(vadd_vv(V, vt, 1, 3, 4, 6, 0, VLEN, 32), 1);
+	EXPECT_EQ(vadd_vv(V, vt, 0, 2, 5, 6, 0, VLEN, 32), 1);
+	EXPECT_EQ(vadd_vv(V, vt, 1, 2, 4, 7, 0, VLEN, 32), 1);
+	EXPECT_EQ(vmul_vx(V, R, vt, 1, 9, 4, 1, 0, VLEN, 32, 64), 1);
+	EXPECT_EQ(vmseq_vv(V, vt, 1, 2, 4, 7, 0, VLEN, 32), 1);
+	EXPECT_EQ(vwaddu_vv(V, vt, 1, 6, 4, 2, 0, VLEN, 32), 1);
+	EXPECT_EQ(vslideup_vi(V, vt, 1, 3, 4, 1, 0, VLEN, 32), 1);
+
+	sv_context* ctx = sv_context_create(V, R, VLEN, 64);
+	ASSERT_NE(ctx, nullptr);
+	sv_insn i = { vtype_config(vt), SV_VADD_VV, 0, 32, 1, 2, 4, 6 };
+	EXPECT_EQ(sv_execute(ctx, &i), 0);
+	for(size_t k = 0; k < sizeof(V); ++k) V[k] = k;
+	i.vd = 3;
+	EXPECT_EQ(sv_execute(ctx, &i), 1);
+	sv_context_destroy(ctx);
+
+	for(size_t k = 0; k < sizeof(V); ++k) EXPECT_EQ(V[k], uint8_t(k));
+
+	// Fractional LMUL: every register is aligned
+	EXPECT_EQ(vadd_vv(V, vtype_encode(16, 1, 2, 0, 0), 1, 3, 5, 7, 0, VLEN, 4), 0);
+}
+
+TEST(vlsu, MisalignedGroupLeavesRegisters) {
+	// EMUL=2: odd vd raises an exception for every load/store on pM, registers and memory unchanged
+	const uint16_t VLEN = 128;
+	uint8_t V[32*VLEN/8];
+	uint8_t M[256];
+	for(size_t i = 0; i < sizeof(V); ++i) V[i] = i;
+	for(size_t i = 0; i < sizeof(M); ++i) M[i] = ~i;
+	const uint16_t vt = vtype_encode(8, 2, 1, 0, 0);
+
+	EXPECT_EQ(vload_encoded_unitstride(V, M, vt, 1, 8, 3, 0, VLEN, 32, 0), 1);
+	EXPECT_EQ(vload_encoded_unitstride(V, M, vt, 0, 8, 3, 0, VLEN, 32, 0), 1);
+	EXPECT_EQ(vstore_encoded_unitstride(V, M, vt, 1, 8, 3, 0, VLEN, 32, 0), 1);
+	EXPECT_EQ(vstore_encoded_unitstride(V, M, vt, 0, 8, 3, 0, VLEN, 32, 0), 1);
+	EXPECT_EQ(vload_encoded_stride(V, M, vt, 1, 8, 3, 0, VLEN, 32, 0, 2), 1);
+	EXPECT_EQ(vstore_encoded_stride(V, M, vt, 1, 8, 3, 0, VLEN, 32, 0, 2), 1);
+	EXPECT_EQ(vload_segment_unitstride(V, M, vt, 1, 8, 2, 3, 0, VLEN, 32, 0), 1);
+	EXPECT_EQ(vstore_segment_unitstride(V, M, vt, 1, 8, 2, 3, 0, VLEN, 32, 0), 1);
+	EXPECT_EQ(vload_segment_stride(V, M, vt, 1, 8, 2, 3, 0, VLEN, 32, 0, 1), 1);
+	EXPECT_EQ(vstore_segment_stride(V, M, vt, 1, 8, 2, 3, 0, VLEN, 32, 0, 1), 1);
+	EXPECT_EQ(vload_segment_stride(V, M, vt, 1, 8, 2, 3, 0, VLEN, 32, 0, 4), 1);
+	EXPECT_EQ(vstore_segment_stride(V, M, vt, 1, 8, 2, 3, 0, VLEN, 32, 0, 4), 1);
+
+	for(size_t i = 0; i < sizeof(V); ++i) EXPECT_EQ(V[i], uint8_t(i));
+	for(size_t i = 0; i < sizeof(M); ++i) EXPECT_EQ(M[i], uint8_t(~i));
+
+	// Aligned vd
+	EXPECT_EQ(vload_encoded_unitstride(V, M, vt, 1, 8, 2, 0, VLEN, 32, 0), 0);
+	for(size_t i = 0; i < 32; ++i) EXPECT_EQ(V[2*VLEN/8 + i], M[i]);
+}
+
+// As read by SVPolicy::enabled(). ctest runs the binary with and without it, see unit_test_agnostic
+static bool agnostic_ones(void) {
+	const char* env = std::getenv("SOFTVECTOR_AGNOSTIC");
+	return(env && !strcmp(env, "ones"));
+}
+
+class PolicyTest : public ::testing::Test {
+protected:
+	// SEW=16, LMUL=1: VLMAX 8, vl 5, vstart 1. v0 enables 1, 2 and 4, i.e. element 3 is masked off and 0 prestart
+	static constexpr uint16_t VLEN = 128;
+	static constexpr uint16_t VL = 5;
+	static constexpr uint16_t VSTART = 1;
+	static constexpr uint8_t V0 = 0x16;
+	uint8_t V[32*VLEN/8];
+	uint8_t R[32*8] = {};
+
+	void SetUp(void) override {
+		std::mt19937 rng(14);
+		for(auto& b: V) b = rng();
+		V[0] = V0;
+	}
+
+	bool agnostic(size_t element) const {
+		return((element >= VL) || ((element >= VSTART) && !((V0 >> element) & 1)));
+	}
+
+	// Runs op with vtype(ta, ma) and compares v1 against a run with ta=ma=0, element-wise
+	void expect_policy(const std::function<uint8_t(uint8_t*, uint16_t)>& op, uint8_t ta, uint8_t ma, bool fills) {
+		std::vector<uint8_t> ref(V, V + sizeof(V));
+		ASSERT_EQ(op(ref.data(), vtype_encode(16, 1, 1, 0, 0)), 0);
+		ASSERT_EQ(op(V, vtype_encode(16, 1, 1, ta, ma)), 0);
+		for(size_t k = 0; k < sizeof(V); ++k) {
+			const size_t e = (k - VLEN/8)/2;
+			const bool filled = fills && (k/(VLEN/8) == 1) && agnostic(e) && ((e >= VL) ? ta : ma);
+			EXPECT_EQ(V[k], filled ? 0xFF : ref[k]) << "v" << k/(VLEN/8) << " byte " << k%(VLEN/8);
+		}
+	}
+
+	std::function<uint8_t(uint8_t*, uint16_t)> legacy_vv(uint8_t (*f)(void*, uint16_t, uint8_t, uint8_t, uint8_t, uint8_t, uint16_t, uint16_t, uint16_t)) {
+		return([f](uint8_t* v, uint16_t vt) { return(f(v, vt, 0, 1, 3, 2, VSTART, VLEN, VL)); });
+	}
+
+	std::function<uint8_t(uint8_t*, uint16_t)> execute(uint16_t opcode) {
+		return([this, opcode](uint8_t* v, uint16_t vt) {
+			sv_context* ctx = sv_context_create(v, R, VLEN, 64);
+			sv_insn i = { vtype_config(vt), opcode, VSTART, VL, 0, 1, 2, 3 };
+			uint8_t ret = sv_execute(ctx, &i);
+			sv_context_destroy(ctx);
+			return(ret);
+		});
+	}
+};
+
+TEST_F(PolicyTest, AgnosticElementsFilled) {
+	const bool ones = agnostic_ones();
+	const std::vector<uint8_t (*)(void*, uint16_t, uint8_t, uint8_t, uint8_t, uint8_t, uint16_t, uint16_t, uint16_t)> legacy = {
+		vadd_vv, vsub_vv, vmul_vv, vand_vv, vor_vv, vxor_vv, vsll_vv, vsrl_vv, vsra_vv};
+	for(size_t k = 0; k < legacy.size(); ++k) {
+		SCOPED_TRACE(k);
+		expect_policy(legacy_vv(legacy[k]), 1, 1, ones);
+		expect_policy(legacy_vv(legacy[k]), 1, 0, ones);
+		expect_policy(legacy_vv(legacy[k]), 0, 1, ones);
+	}
+	for(uint16_t opcode: {SV_VADD_VV, SV_VSUB_VX, SV_VMUL_VV, SV_VAND_VI, SV_VOR_VV, SV_VXOR_VX, SV_VSLL_VI, SV_VSRL_VV, SV_VSRA_VX}) {
+		SCOPED_TRACE(opcode);
+		expect_policy(execute(opcode), 1, 1, ones);
+		expect_policy(execute(opcode), 0, 1, ones);
+	}
+}
+
+TEST(policy, MaskAgnosticRunsAcrossWords) {
+	// VLMAX 256, i.e. four mask words. Masked-off runs span the word boundaries at 64 and 128.
+	// SEW=8 (LMUL=1/2) takes the SIMD blend, SEW=128 (LMUL=8) the element-wise path
+	const uint16_t VLEN = 4096;
+	const uint16_t VL = 250;
+	const uint16_t VSTART = 3;
+	const bool ones = agnostic_ones();
+	std::vector<uint8_t> V(32*VLEN/8);
+	for(const uint16_t sew : {8, 128}) {
+		SCOPED_TRACE(sew);
+		std::mt19937 rng(14);
+		for(auto& b: V) b = rng();
+		for(size_t i = 6; i < 17; ++i) V[i] = (i == 12) ? 0x81 : 0;
+		V[24] = 0xFF;
+		std::vector<uint8_t> ref(V);
+		const uint8_t z_lmul = (sew == 8) ? 1 : 8;
+		const uint8_t n_lmul = (sew == 8) ? 2 : 1;
+		ASSERT_EQ(vadd_vv(ref.data(), vtype_encode(sew, z_lmul, n_lmul, 0, 0), 0, 8, 16, 24, VSTART, VLEN, VL), 0);
+		ASSERT_EQ(vadd_vv(V.data(), vtype_encode(sew, z_lmul, n_lmul, 1, 1), 0, 8, 16, 24, VSTART, VLEN, VL), 0);
+
+		const size_t element_bytes = sew/8;
+		for(size_t e = 0; e < 256; ++e) {
+			const bool agnostic = (e >= VL) || ((e >= VSTART) && !((V[e/8] >> (e%8)) & 1));
+			for(size_t b = 0; b < element_bytes; ++b) {
+				const size_t k = 8*VLEN/8 + e*element_bytes + b;
+				EXPECT_EQ(V[k], (ones && agnostic) ? 0xFF : ref[k]) << "element " << e;
+			}
+		}
+		for(size_t k = 0; k < V.size(); ++k) {
+			if((k/(VLEN/8) < 8) || (k/(VLEN/8) >= 16)) {
+				EXPECT_EQ(V[k], ref[k]) << "byte " << k;
+			}
+		}
+	}
+}
+
+TEST_F(PolicyTest, UndisturbedByDefault) {
+	// ta=ma=0 leaves tail and masked-off elements as they are, independent of SOFTVECTOR_AGNOSTIC
+	const std::vector<uint8_t> in(V, V + sizeof(V));
+	EXPECT_EQ(vadd_vv(V, vtype_encode(16, 1, 1, 0, 0), 0, 1, 3, 2, VSTART, VLEN, VL), 0);
+	for(size_t e = 0; e < VLEN/16; ++e) {
+		if(agnostic(e) || (e < VSTART)) {
+			EXPECT_EQ(V[VLEN/8 + 2*e], in[VLEN/8 + 2*e]) << "element " << e;
+			EXPECT_EQ(V[VLEN/8 + 2*e + 1], in[VLEN/8 + 2*e + 1]) << "element " << e;
+		} else {
+			const uint16_t sum = (in[2*VLEN/8 + 2*e] | in[2*VLEN/8 + 2*e + 1] << 8) + (in[3*VLEN/8 + 2*e] | in[3*VLEN/8 + 2*e + 1] << 8);
+			EXPECT_EQ(V[VLEN/8 + 2*e] | V[VLEN/8 + 2*e + 1] << 8, sum) << "element " << e;
+		}
+	}
+	expect_policy(execute(SV_VADD_VV), 0, 0, true);
+}
+
+TEST_F(PolicyTest, OtherInstructionsUndisturbed) {
+	// Agnostic elements of instructions without fill are left undisturbed, also with SOFTVECTOR_AGNOSTIC=ones
+	expect_policy(legacy_vv(vmulh_vv), 1, 1, false);
+	expect_policy(legacy_vv(vmulhsu_vv), 1, 1, false);
+	expect_policy(execute(SV_VMULHU_VX), 1, 1, false);
+	expect_policy([](uint8_t* v, uint16_t vt) { return(vmv_vv(v, vt, 1, 3, VSTART, VLEN, VL)); }, 1, 1, false);
+	expect_policy(execute(SV_VMV_VI), 1, 1, false);
+}
+
+// Reference arithmetic on SEW-bit elements as little-endian byte strings
+typedef std::vector<uint8_t> ref_elem;
+
+static ref_elem ref_add(const ref_elem& a, const ref_elem& b) {
+	ref_elem ret(a.size());
+	unsigned carry = 0;
+	for(size_t i = 0; i < a.size(); ++i) {
+		carry += a[i] + b[i];
+		ret[i] = carry;
+		carry >>= 8;
+	}
+	return(ret);
+}
+
+static ref_elem ref_sub(const ref_elem& a, const ref_elem& b) {
+	ref_elem nb(b.size()), one(b.size());
+	for(size_t i = 0; i < b.size(); ++i) nb[i] = ~b[i];
+	one[0] = 1;
+	return(ref_add(a, ref_add(nb, one)));
+}
+
+static ref_elem ref_bitwise(const ref_elem& a, const ref_elem& b, char op) {
+	ref_elem ret(a.size());
+	for(size_t i = 0; i < a.size(); ++i) ret[i] = (op == '&') ? (a[i] & b[i]) : (op == '|') ? (a[i] | b[i]) : (a[i] ^ b[i]);
+	return(ret);
+}
+
+// Shift by the low log2(SEW) bits of b, bit by bit. op: 'l' SLL, 'r' SRL, 'a' SRA
+static ref_elem ref_shift(const ref_elem& a, const ref_elem& b, char op) {
+	const size_t sew = 8*a.size();
+	const size_t amount = (b[0] | ((sew > 8) ? b[1] << 8 : 0)) & (sew - 1);
+	auto bit = [&](size_t j) { return((a[j/8] >> (j%8)) & 1); };
+	ref_elem ret(a.size());
+	for(size_t j = 0; j < sew; ++j) {
+		unsigned v;
+		if(op == 'l') v = (j >= amount) ? bit(j - amount) : 0;
+		else v = (j + amount < sew) ? bit(j + amount) : ((op == 'a') ? bit(sew - 1) : 0);
+		ret[j/8] |= v << (j%8);
+	}
+	return(ret);
+}
+
+class SVExprTest : public ::testing::TestWithParam<size_t> {
+protected:
+	static constexpr size_t N = 13;
+	size_t sew{}, nb{};
+	std::vector<uint8_t> A, B, C, D;
+
+	void SetUp(void) override {
+		sew = GetParam();
+		nb = sew/8;
+		std::mt19937 rng(9 + sew);
+		for(auto* M: {&A, &B, &C, &D}) {
+			M->resize(N*nb);
+			for(auto& b: *M) b = rng();
+		}
+	}
+
+	ref_elem at(const std::vector<uint8_t>& M, size_t i) const {
+		return(ref_elem(M.begin() + i*nb, M.begin() + (i + 1)*nb));
+	}
+
+	ref_elem ext(uint64_t x, bool sign) const {
+		ref_elem ret(nb);
+		for(size_t i = 0; i < nb; ++i) ret[i] = (i < 8) ? (x >> 8*i) : ((sign && (x >> 63)) ? 0xFF : 0);
+		return(ret);
+	}
+
+	void expect_vec(const SVector& v, const std::function<ref_elem(size_t)>& ref) const {
+		ASSERT_EQ(v.length_, N);
+		ASSERT_EQ(v.single_element_width_bits_, sew);
+		for(size_t i = 0; i < N; ++i) {
+			EXPECT_EQ(ref_elem(v.mem_ + i*nb, v.mem_ + (i + 1)*nb), ref(i)) << "SEW " << sew << " element " << i;
+		}
+	}
+};
+
+TEST_P(SVExprTest, ChainedExpression) {
+	const std::vector<uint8_t> a0 = A;
+	SVector a(N, sew, 1, A.data()), b(N, sew, 2, B.data()), c(N, sew, 3, C.data()), d(N, sew, 4, D.data());
+	std::vector<uint8_t> R(N*nb);
+	SVector r(N, sew, 5, R.data());
+	const int64_t s = -0x1234;
+	r = (((a + b) & c) - s) ^ (a << d);
+	expect_vec(r, [&](size_t i) {
+		const ref_elem lhs = ref_sub(ref_bitwise(ref_add(at(A, i), at(B, i)), at(C, i), '&'), ext(s, true));
+		return(ref_bitwise(lhs, ref_shift(at(A, i), at(D, i), 'l'), '^'));
+	});
+	EXPECT_EQ(A, a0);
+
+	r = a.srl(b) | (c >> d);
+	expect_vec(r, [&](size_t i) { return(ref_bitwise(ref_shift(at(A, i), at(B, i), 'r'), ref_shift(at(C, i), at(D, i), 'a'), '|')); });
+}
+
+TEST_P(SVExprTest, AliasedDestination) {
+	const std::vector<uint8_t> a0 = A, b0 = B;
+	SVector a(N, sew, 1, A.data()), b(N, sew, 2, B.data());
+	a = (a + b) & a;
+	expect_vec(a, [&](size_t i) { return(ref_bitwise(ref_add(at(a0, i), at(b0, i)), at(a0, i), '&')); });
+	const std::vector<uint8_t> a1 = A;
+	b = (a - b) ^ (b << a);
+	expect_vec(b, [&](size_t i) { return(ref_bitwise(ref_sub(at(a1, i), at(b0, i)), ref_shift(at(b0, i), at(a1, i), 'l'), '^')); });
+}
+
+TEST_P(SVExprTest, ScalarRhs) {
+	SVector a(N, sew, 1, A.data());
+	std::vector<uint8_t> R(N*nb);
+	SVector r(N, sew, 5, R.data());
+	// Sign extended to SEW: -1 and -2 reach all bytes of wide elements
+	r = a + int64_t(-1);
+	expect_vec(r, [&](size_t i) { return(ref_add(at(A, i), ext(-1, true))); });
+	r = a & -2;
+	expect_vec(r, [&](size_t i) { return(ref_bitwise(at(A, i), ext(-2, true), '&')); });
+	r = (a | 0x7F) - 0x80;
+	expect_vec(r, [&](size_t i) { return(ref_sub(ref_bitwise(at(A, i), ext(0x7F, true), '|'), ext(0x80, true))); });
+	// Zero extended: the shift amount is taken from the low bits only
+	r = a.srl(~uint64_t(0));
+	expect_vec(r, [&](size_t i) { return(ref_shift(at(A, i), ext(~uint64_t(0), false), 'r')); });
+	r = (a << 3) >> (sew + 1);
+	expect_vec(r, [&](size_t i) { return(ref_shift(ref_shift(at(A, i), ext(3, false), 'l'), ext(sew + 1, false), 'a')); });
+}
+
+TEST_P(SVExprTest, ConvertingConstructor) {
+	SVector a(N, sew, 6, A.data()), b(N, sew, 7, B.data()), c(N, sew, 8, C.data());
+	const SVector r((a + b) & c);
+	EXPECT_EQ(r.start_reg_index_, 6u);
+	EXPECT_NE(r.mem_, A.data());
+	expect_vec(r, [&](size_t i) { return(ref_bitwise(ref_add(at(A, i), at(B, i)), at(C, i), '&')); });
+	const SVector s(a ^ 5);
+	expect_vec(s, [&](size_t i) { return(ref_bitwise(at(A, i), ext(5, true), '^')); });
+}
+
+INSTANTIATE_TEST_SUITE_P(SEW, SVExprTest, ::testing::Values(8, 16, 32, 64, 128, 256, 512, 1024));
+
 TEST_F(Cvadd_vvTest, VariousTestCases) {
 
 	for(auto & _case: cases) {
@@ -1275,6 +2388,34 @@ TEST_F(Cvsra_vxTest, VariousTestCases) {
 	}
 }
 
+TEST_F(Cvmseq_vvTest, VariousTestCases) {
+
+	for(auto & _case: cases) {
+		EXPECT_EQ(_case->compare_return, 0) << 	"Fail at golden compare " << _case->identity;
+	}
+}
+
+TEST_F(Cvmseq_viTest, VariousTestCases) {
+
+	for(auto & _case: cases) {
+		EXPECT_EQ(_case->compare_return, 0) << 	"Fail at golden compare " << _case->identity;
+	}
+}
+
+TEST_F(Cvmslt_vvTest, VariousTestCases) {
+
+	for(auto & _case: cases) {
+		EXPECT_EQ(_case->compare_return, 0) << 	"Fail at golden compare " << _case->identity;
+	}
+}
+
+TEST_F(Cvmsleu_viTest, VariousTestCases) {
+
+	for(auto & _case: cases) {
+		EXPECT_EQ(_case->compare_return, 0) << 	"Fail at golden compare " << _case->identity;
+	}
+}
+
 TEST_F(Cvmul_vvTest, VariousTestCases) {
 
 	for(auto & _case: cases) {